@@ -16,11 +16,60 @@
 #include "melty_config.h"
 #include "accel_handler.h"
 #include "debug_handler.h"
+#include "telemetry_registry.h"
 #include <Wire.h>
+#include <atomic>
 #include "src/SparkFun_LIS331/src/SparkFun_LIS331.h"
 
+static_assert((ACCEL_SAMPLE_BUFFER_SIZE & (ACCEL_SAMPLE_BUFFER_SIZE - 1)) == 0, "ACCEL_SAMPLE_BUFFER_SIZE must be a power of 2");
+
 LIS331 xl;
 
+//recent readings - sample n is in samples[n % ACCEL_SAMPLE_BUFFER_SIZE]
+//one writer (control loop) - sample_count is increased after the sample is filled in, readers check it again after copying
+//to find samples overwritten while they were copied
+static accel_sample_t samples[ACCEL_SAMPLE_BUFFER_SIZE];
+static std::atomic<uint32_t> sample_count(0);
+
+static void store_sample(int16_t x, int16_t y, int16_t z) {
+  uint32_t count = sample_count.load(std::memory_order_relaxed);
+  accel_sample_t *sample = &samples[count & (ACCEL_SAMPLE_BUFFER_SIZE - 1)];
+  sample->time_us = micros();
+  sample->x = x;
+  sample->y = y;
+  sample->z = z;
+  sample_count.store(count + 1, std::memory_order_release);
+}
+
+//latest sample (all zero before first read)
+static accel_sample_t get_last_sample() {
+  accel_sample_t sample = {};
+  uint32_t count;
+  do {
+    count = sample_count.load(std::memory_order_acquire);
+    if (count == 0) return sample;
+    sample = samples[(count - 1) & (ACCEL_SAMPLE_BUFFER_SIZE - 1)];
+    std::atomic_thread_fence(std::memory_order_acquire);
+  } while (sample_count.load(std::memory_order_relaxed) - count >= ACCEL_SAMPLE_BUFFER_SIZE - 1);
+  return sample;
+}
+
+float accel_counts_to_g(int counts) {
+  return xl.convertToG(ACCEL_MAX_SCALE, counts);
+}
+
+static float get_last_x_g() {
+  return accel_counts_to_g(get_last_sample().x);
+}
+
+static float get_last_y_g() {
+  return accel_counts_to_g(get_last_sample().y);
+}
+
+static float get_last_z_g() {
+  return accel_counts_to_g(get_last_sample().z);
+}
+
 void init_accel() {
 
   Wire.begin(I2C_SDA_PIN, I2C_SCL_PIN);  // Initialize I2C with the pins defined in melty_config.h
@@ -36,7 +85,13 @@ void init_accel() {
   //sets accelerometer to specified scale (100, 200, 400g)
   xl.setFullScale(ACCEL_RANGE);
 
-  debug_printf("ACCEL", "Accelerometer initialized with range: %d g", ACCEL_MAX_SCALE);
+  //X axis is the one used for RPM
+  telemetry_register_float("gForce", "g", 2, get_last_x_g);
+  telemetry_register_float("accelX", "g", 3, get_last_x_g);
+  telemetry_register_float("accelY", "g", 3, get_last_y_g);
+  telemetry_register_float("accelZ", "g", 3, get_last_z_g);
+
+  LOG_INFO(ACCEL, "Accelerometer initialized with range: %d g", ACCEL_MAX_SCALE);
 }
 
 //reads accel and converts to G's
@@ -44,19 +99,45 @@ void init_accel() {
 float get_accel_force_g() {
   int16_t x, y, z;
   xl.readAxes(x, y, z);
+  store_sample(x, y, z);
+
+  // Debug output for raw accelerometer readings (conversions only run when enabled)
+  LOG_EVERY_MS(DEBUG_VERBOSE, ACCEL, 2000, "Raw Accel - X: %.2fg, Y: %.2fg, Z: %.2fg, Used value: %.2fg",
+               xl.convertToG(ACCEL_MAX_SCALE, x), xl.convertToG(ACCEL_MAX_SCALE, y), xl.convertToG(ACCEL_MAX_SCALE, z),
+               xl.convertToG(ACCEL_MAX_SCALE, x));
 
-  // Debug output for raw accelerometer readings
-  static unsigned long last_accel_debug = 0;
-  if (millis() - last_accel_debug > 2000) {  // Every 2 seconds to reduce spam
-    float x_g = xl.convertToG(ACCEL_MAX_SCALE, x);
-    float y_g = xl.convertToG(ACCEL_MAX_SCALE, y);
-    float z_g = xl.convertToG(ACCEL_MAX_SCALE, z);
+  return xl.convertToG(ACCEL_MAX_SCALE,x);
+}
 
-    debug_printf("ACCEL", "Raw Accel - X: %.2fg, Y: %.2fg, Z: %.2fg, Used value: %.2fg",
-                x_g, y_g, z_g, xl.convertToG(ACCEL_MAX_SCALE, x));
+void get_last_accel_g(float *x_g, float *y_g, float *z_g) {
+  accel_sample_t sample = get_last_sample();
+  *x_g = accel_counts_to_g(sample.x);
+  *y_g = accel_counts_to_g(sample.y);
+  *z_g = accel_counts_to_g(sample.z);
+}
 
-    last_accel_debug = millis();
+int accel_read_samples(accel_sample_t *copied_samples, int max_samples, uint32_t *next_sample) {
+  uint32_t count = sample_count.load(std::memory_order_acquire);
+  uint32_t first = *next_sample;
+
+  //oldest sample still in buffer
+  if (count - first > ACCEL_SAMPLE_BUFFER_SIZE) first = count - ACCEL_SAMPLE_BUFFER_SIZE;
+  int copied = (int)(count - first);
+  if (copied > max_samples) copied = max_samples;
+
+  for (int i = 0; i < copied; i++) {
+    copied_samples[i] = samples[(first + i) & (ACCEL_SAMPLE_BUFFER_SIZE - 1)];
   }
 
-  return xl.convertToG(ACCEL_MAX_SCALE,x);
+  //leave off samples the control loop overwrote while they were being copied
+  std::atomic_thread_fence(std::memory_order_acquire);
+  uint32_t count_after = sample_count.load(std::memory_order_relaxed);
+  int overwritten = 0;
+  while (overwritten < copied && count_after - (first + overwritten) >= ACCEL_SAMPLE_BUFFER_SIZE) overwritten++;
+  if (overwritten > 0) {
+    memmove(copied_samples, copied_samples + overwritten, (copied - overwritten) * sizeof(accel_sample_t));
+  }
+
+  *next_sample = first + copied;
+  return copied - overwritten;
 }
@@ -1,3 +1,6 @@
+#ifndef ACCEL_HANDLER_H
+#define ACCEL_HANDLER_H
+
 #include "src/SparkFun_LIS331/src/SparkFun_LIS331.h"
 
 //Set high enough to allow for G forces at top RPM
@@ -21,7 +24,29 @@
 //(Adafuit breakout default is 0x18, Sparkfun default is 0x19)
 #define ACCEL_I2C_ADDRESS 0x19
 
+//recent readings kept for other tasks (web UI gets each sample - see accel_read_samples) - power of 2
+#define ACCEL_SAMPLE_BUFFER_SIZE 64
+
+//one accelerometer reading - raw counts (accel_counts_to_g converts)
+typedef struct accel_sample_t {
+  uint32_t time_us;             //micros() when read
+  int16_t x;
+  int16_t y;
+  int16_t z;
+} accel_sample_t;
+
 void init_accel();
 
 float get_accel_force_g();
 
+//returns the axes from the latest get_accel_force_g call (doesn't read accelerometer - safe from other tasks)
+void get_last_accel_g(float *x_g, float *y_g, float *z_g);
+
+//copies samples read since *next_sample (oldest first) and advances it past them - returns number copied
+//start with *next_sample = 0 - samples overwritten before they were copied are skipped (*next_sample jumps ahead)
+//safe from other tasks / cores (samples are only written by get_accel_force_g in the control loop)
+int accel_read_samples(accel_sample_t *samples, int max_samples, uint32_t *next_sample);
+
+float accel_counts_to_g(int counts);
+
+#endif // ACCEL_HANDLER_H
@@ -0,0 +1,186 @@
+//this module samples analog inputs in the background so the rotation loop never waits on the ADC
+//ADC1 inputs: continuous conversion at ADC_SAMPLE_RATE_HZ - results are written to memory by DMA and averaged per block
+//ADC2 inputs (ie. GPIO14 on M5 Stamp S3): DMA not supported - polled with analogReadMilliVolts every ADC_POLL_INTERVAL_MS
+//(ADC2 is shared with WiFi - reads fail while WiFi is using it, failed reads are skipped)
+
+#include <Arduino.h>
+#include "melty_config.h"
+#include "adc_sampler.h"
+#include "debug_handler.h"
+#include "driver/adc.h"
+#include "esp_adc_cal.h"
+
+#define ADC1_CHANNEL_COUNT 10                 //ESP32-S3 ADC1 is GPIO1-10
+#define ADC_DMA_FRAME_BYTES 128               //bytes per DMA transfer (4 bytes per conversion - 3.2ms at 10kHz)
+#define ADC_DMA_BUFFER_BYTES 1024             //driver buffer - conversions are dropped if task falls this far behind
+#define ADC_ATTENUATION ADC_ATTEN_DB_11       //full range (up to ~3.1V)
+#define ADC_DEFAULT_VREF_MV 1100              //only used if chip has no eFuse calibration
+
+static const int input_pins[ADC_INPUT_COUNT] = {
+  BATTERY_ADC_PIN,
+  MOTOR_1_CURRENT_ADC_PIN,
+  MOTOR_2_CURRENT_ADC_PIN
+};
+
+static volatile float input_millivolts[ADC_INPUT_COUNT] = {};
+static volatile bool input_sampled[ADC_INPUT_COUNT] = {};
+
+static bool input_uses_dma[ADC_INPUT_COUNT] = {};
+static bool input_polled[ADC_INPUT_COUNT] = {};
+static int8_t channel_inputs[ADC1_CHANNEL_COUNT];       //ADC1 channel -> input (-1 if not sampled)
+
+static bool dma_running = false;
+static esp_adc_cal_characteristics_t adc1_characteristics;
+static uint8_t dma_frame[ADC_DMA_FRAME_BYTES];
+
+bool adc_input_available(adc_input_t input) {
+  return input_sampled[input];
+}
+
+float adc_get_millivolts(adc_input_t input) {
+  return input_millivolts[input];
+}
+
+//single float store - readers on the other core see either the old or new value
+static void filter_reading(int input, float millivolts) {
+  if (!input_sampled[input]) {
+    input_millivolts[input] = millivolts;
+    input_sampled[input] = true;
+  } else {
+    input_millivolts[input] = input_millivolts[input] + ((millivolts - input_millivolts[input]) * ADC_FILTER_WEIGHT);
+  }
+}
+
+//averages each channel's conversions in a DMA frame - one filter step per channel per frame
+static void process_dma_frame(const uint8_t *frame, uint32_t length) {
+  uint32_t totals[ADC_INPUT_COUNT] = {};
+  uint32_t counts[ADC_INPUT_COUNT] = {};
+
+  for (uint32_t offset = 0; offset + SOC_ADC_DIGI_RESULT_BYTES <= length; offset += SOC_ADC_DIGI_RESULT_BYTES) {
+    const adc_digi_output_data_t *result = (const adc_digi_output_data_t *)&frame[offset];
+    if (result->type2.unit != 0 || result->type2.channel >= ADC1_CHANNEL_COUNT) continue;
+
+    int input = channel_inputs[result->type2.channel];
+    if (input < 0) continue;
+    totals[input] += result->type2.data;
+    counts[input]++;
+  }
+
+  for (int input = 0; input < ADC_INPUT_COUNT; input++) {
+    if (counts[input] == 0) continue;
+    filter_reading(input, esp_adc_cal_raw_to_voltage(totals[input] / counts[input], &adc1_characteristics));
+  }
+}
+
+static void poll_inputs() {
+  for (int input = 0; input < ADC_INPUT_COUNT; input++) {
+    if (!input_polled[input]) continue;
+
+    uint32_t millivolts = analogReadMilliVolts(input_pins[input]);
+    if (millivolts == 0) continue;    //ADC2 read failed (WiFi)
+    filter_reading(input, millivolts);
+  }
+}
+
+static void adc_sampler_task(void *parameter) {
+  unsigned long last_poll = 0;
+
+  while (true) {
+    if (dma_running) {
+      uint32_t length = 0;
+      esp_err_t result = adc_digi_read_bytes(dma_frame, sizeof(dma_frame), &length, ADC_POLL_INTERVAL_MS);
+      //ESP_ERR_INVALID_STATE - driver buffer overflowed (older conversions dropped) but data returned is valid
+      if (result == ESP_OK || result == ESP_ERR_INVALID_STATE) process_dma_frame(dma_frame, length);
+    } else {
+      vTaskDelay(pdMS_TO_TICKS(ADC_POLL_INTERVAL_MS));
+    }
+
+    if (millis() - last_poll >= ADC_POLL_INTERVAL_MS) {
+      poll_inputs();
+      last_poll = millis();
+    }
+  }
+}
+
+static esp_err_t start_dma(uint32_t channel_mask, adc_digi_pattern_config_t *patterns, int pattern_count) {
+  adc_digi_init_config_t init_config = {};
+  init_config.max_store_buf_size = ADC_DMA_BUFFER_BYTES;
+  init_config.conv_num_each_intr = ADC_DMA_FRAME_BYTES;
+  init_config.adc1_chan_mask = channel_mask;
+  init_config.adc2_chan_mask = 0;
+
+  esp_err_t result = adc_digi_initialize(&init_config);
+  if (result != ESP_OK) return result;
+
+  adc_digi_configuration_t config = {};
+  config.conv_limit_en = false;
+  config.conv_limit_num = 250;
+  config.pattern_num = pattern_count;
+  config.adc_pattern = patterns;
+  config.sample_freq_hz = ADC_SAMPLE_RATE_HZ;
+  config.conv_mode = ADC_CONV_SINGLE_UNIT_1;
+  config.format = ADC_DIGI_OUTPUT_FORMAT_TYPE2;
+
+  result = adc_digi_controller_configure(&config);
+  if (result != ESP_OK) return result;
+
+  return adc_digi_start();
+}
+
+void init_adc_sampler() {
+  for (int channel = 0; channel < ADC1_CHANNEL_COUNT; channel++) channel_inputs[channel] = -1;
+
+  uint32_t channel_mask = 0;
+  adc_digi_pattern_config_t patterns[ADC_INPUT_COUNT] = {};
+  int pattern_count = 0;
+
+  for (int input = 0; input < ADC_INPUT_COUNT; input++) {
+    if (input_pins[input] < 0) continue;
+
+    int8_t channel = digitalPinToAnalogChannel(input_pins[input]);
+    if (channel < 0) {
+      LOG_ERROR(ADC, "Pin %d is not an analog pin - input %d not sampled", input_pins[input], input);
+      continue;
+    }
+
+    //ADC1 channels go to DMA - ADC2 channels (Arduino numbers them from 10) are polled
+    if (channel < ADC1_CHANNEL_COUNT && (channel_mask & (1UL << channel)) == 0) {
+      channel_mask |= 1UL << channel;
+      channel_inputs[channel] = input;
+      patterns[pattern_count].atten = ADC_ATTENUATION;
+      patterns[pattern_count].channel = channel;
+      patterns[pattern_count].unit = 0;
+      patterns[pattern_count].bit_width = SOC_ADC_DIGI_MAX_BITWIDTH;
+      pattern_count++;
+      input_uses_dma[input] = true;
+    } else {
+      analogSetPinAttenuation(input_pins[input], ADC_11db);
+      input_polled[input] = true;
+    }
+  }
+
+  if (pattern_count > 0) {
+    esp_adc_cal_value_t calibration = esp_adc_cal_characterize(ADC_UNIT_1, ADC_ATTENUATION, ADC_WIDTH_BIT_12, ADC_DEFAULT_VREF_MV, &adc1_characteristics);
+    if (calibration == ESP_ADC_CAL_VAL_DEFAULT_VREF) LOG_WARNING(ADC, "No eFuse ADC calibration - readings may be off by up to ~10%%");
+
+    esp_err_t result = start_dma(channel_mask, patterns, pattern_count);
+    if (result == ESP_OK) {
+      dma_running = true;
+    } else {
+      //fall back to polling these inputs
+      LOG_ERROR(ADC, "Continuous ADC init failed (%s) - polling inputs instead", esp_err_to_name(result));
+      for (int input = 0; input < ADC_INPUT_COUNT; input++) {
+        if (input_uses_dma[input]) input_polled[input] = true;
+        input_uses_dma[input] = false;
+      }
+    }
+  }
+
+  xTaskCreatePinnedToCore(adc_sampler_task, "adc_sampler", 3072, NULL, 1, NULL, 0);
+
+  for (int input = 0; input < ADC_INPUT_COUNT; input++) {
+    if (input_pins[input] < 0) continue;
+    LOG_INFO(ADC, "Input %d on pin %d - %s", input, input_pins[input],
+                 input_uses_dma[input] ? "continuous (DMA)" : input_polled[input] ? "polled" : "not sampled");
+  }
+}
@@ -0,0 +1,24 @@
+#ifndef ADC_SAMPLER_H
+#define ADC_SAMPLER_H
+
+//analog inputs (battery voltage / optional motor current sense) sampled continuously in the background
+//ADC1 pins are converted by the ADC in continuous (DMA) mode - pins on ADC2 (not supported by DMA) are polled by the same task
+//readings are calibrated (eFuse) and filtered - getters return the latest value without touching the ADC
+
+enum adc_input_t {
+  ADC_INPUT_BATTERY = 0,          //BATTERY_ADC_PIN (before voltage divider scaling)
+  ADC_INPUT_MOTOR_1_CURRENT,      //MOTOR_1_CURRENT_ADC_PIN
+  ADC_INPUT_MOTOR_2_CURRENT,      //MOTOR_2_CURRENT_ADC_PIN
+  ADC_INPUT_COUNT
+};
+
+//configures ADC and starts sampling task (core 0)
+void init_adc_sampler();
+
+//returns true if input pin is configured and has been sampled
+bool adc_input_available(adc_input_t input);
+
+//returns latest filtered voltage at an input pin in mV (0 if not available)
+float adc_get_millivolts(adc_input_t input);
+
+#endif // ADC_SAMPLER_H
@@ -1,15 +1,42 @@
-
 #include "Arduino.h"
 #include "melty_config.h"
+#include "battery_monitor.h"
+#include "adc_sampler.h"
+#include "telemetry_registry.h"
 
-//returns battery voltage
+//returns battery voltage (latest filtered ADC reading - doesn't touch the ADC)
 float get_battery_voltage() {
-  return (analogRead(BATTERY_ADC_PIN) * (ARDUINIO_VOLTAGE / 1023.0)) * VOLTAGE_DIVIDER;
+  return (adc_get_millivolts(ADC_INPUT_BATTERY) / 1000.0f) * VOLTAGE_DIVIDER;
+}
+
+//returns motor current (0 if current sense pin not fitted)
+float get_motor_current(int motor_index) {
+  adc_input_t input = (motor_index == 0) ? ADC_INPUT_MOTOR_1_CURRENT : ADC_INPUT_MOTOR_2_CURRENT;
+  if (!adc_input_available(input)) return 0.0f;
+  return (adc_get_millivolts(input) - CURRENT_SENSE_ZERO_MV) / CURRENT_SENSE_MV_PER_AMP;
+}
+
+static float get_motor_1_current() {
+  return get_motor_current(0);
+}
+
+static float get_motor_2_current() {
+  return get_motor_current(1);
+}
+
+void init_battery_monitor() {
+#ifdef BATTERY_ALERT_ENABLED
+  telemetry_register_float("battery", "V", 2, get_battery_voltage);
+#endif
+  if (MOTOR_1_CURRENT_ADC_PIN >= 0 || MOTOR_2_CURRENT_ADC_PIN >= 0) {
+    telemetry_register_float("motor1Current", "A", 1, get_motor_1_current);
+    telemetry_register_float("motor2Current", "A", 1, get_motor_2_current);
+  }
 }
 
 //check for low battery - but only alarm after certain number of low reads in a row (prevents ADC noise from alarming)
 //(settings in melty_config.h)
-int battery_voltage_low(){
+bool battery_voltage_low(){
   static int low_bat_count = 0;
   if (get_battery_voltage() < BATTERY_ADC_WARN_VOLTAGE_THRESHOLD) {
     low_bat_count++;
@@ -1,6 +1,12 @@
+//registers battery voltage / motor current telemetry - call after init_adc_sampler
+void init_battery_monitor();
+
 //check for low battery - but only alarm after certain number of low reads in a row (prevents ADC noise from alarming)
 //(settings in melty_config.h)
 bool battery_voltage_low();
 
 //returns battery voltage
-float get_battery_voltage();
\ No newline at end of file
+float get_battery_voltage();
+
+//returns current drawn by a motor (motor_index 0 or 1) in amps - 0 if MOTOR_X_CURRENT_ADC_PIN not fitted
+float get_motor_current(int motor_index);
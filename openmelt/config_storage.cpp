@@ -16,7 +16,7 @@
 #include "debug_handler.h"
 
 // For ESP32, we need to define EEPROM size
-#define EEPROM_SIZE 32
+#define EEPROM_SIZE 128
 
 #define EEPROM_WRITTEN_SENTINEL1_VALUE EEPROM_WRITTEN_SENTINEL_VALUE
 #define EEPROM_WRITTEN_SENTINEL2_VALUE EEPROM_WRITTEN_SENTINEL_VALUE
@@ -38,6 +38,12 @@
 #define EEPROM_ACCEL_OFFSET_BYTE3_LOC 9
 #define EEPROM_ACCEL_OFFSET_BYTE4_LOC 10
 
+//RC curves are saved separately (web UI) - so have their own sentinel
+//size byte invalidates stored curves if rc_curve_t layout changes
+#define EEPROM_RC_CURVES_SENTINEL_LOC 12
+#define EEPROM_RC_CURVES_SIZE_LOC 13
+#define EEPROM_RC_CURVES_LOC 16
+
 static bool eeprom_initialized = false;
 
 // Initialize EEPROM for ESP32
@@ -45,9 +51,9 @@ void init_eeprom() {
   if (!eeprom_initialized) {
     if (EEPROM.begin(EEPROM_SIZE)) {
       eeprom_initialized = true;
-      debug_printf("EEPROM", "EEPROM initialized with size %d bytes", EEPROM_SIZE);
+      LOG_INFO(EEPROM, "EEPROM initialized with size %d bytes", EEPROM_SIZE);
     } else {
-      debug_print_level(DEBUG_ERROR, "EEPROM", "Failed to initialize EEPROM");
+      LOG_ERROR(EEPROM, "Failed to initialize EEPROM");
     }
   }
 }
@@ -75,10 +81,10 @@ void save_settings_to_eeprom(int led_offset, float accel_radius, float accel_zer
 
   // ESP32 requires explicit commit to save EEPROM data to flash
   if (EEPROM.commit()) {
-    debug_printf("EEPROM", "Settings saved: LED offset=%d, accel_radius=%.2f, zero_g=%.2f",
+    LOG_INFO(EEPROM, "Settings saved: LED offset=%d, accel_radius=%.2f, zero_g=%.2f",
                 led_offset, accel_radius, accel_zero_g_offset);
   } else {
-    debug_print_level(DEBUG_ERROR, "EEPROM", "Failed to commit EEPROM data");
+    LOG_ERROR(EEPROM, "Failed to commit EEPROM data");
   }
 }
 
@@ -107,4 +113,34 @@ float load_accel_mount_radius() {
   return accel_radius;
 }
 
+void save_rc_curves(const rc_curve_t *curves, int count) {
+  init_eeprom();
+  if (EEPROM_RC_CURVES_LOC + (int)sizeof(rc_curve_t) * count > EEPROM_SIZE) {
+    LOG_ERROR(EEPROM, "RC curves do not fit in EEPROM");
+    return;
+  }
+  for (int i = 0; i < count; i++) {
+    EEPROM.put(EEPROM_RC_CURVES_LOC + (i * sizeof(rc_curve_t)), curves[i]);
+  }
+  EEPROM.write(EEPROM_RC_CURVES_SENTINEL_LOC, EEPROM_WRITTEN_SENTINEL_VALUE);
+  EEPROM.write(EEPROM_RC_CURVES_SIZE_LOC, sizeof(rc_curve_t));
+
+  if (EEPROM.commit()) {
+    LOG_INFO(EEPROM, "RC curves saved");
+  } else {
+    LOG_ERROR(EEPROM, "Failed to commit EEPROM data");
+  }
+}
+
+bool load_rc_curves(rc_curve_t *curves, int count) {
+  init_eeprom();
+  //if curves haven't been saved previously - caller keeps defaults
+  if (EEPROM.read(EEPROM_RC_CURVES_SENTINEL_LOC) != EEPROM_WRITTEN_SENTINEL_VALUE) return false;
+  if (EEPROM.read(EEPROM_RC_CURVES_SIZE_LOC) != sizeof(rc_curve_t)) return false;
+  for (int i = 0; i < count; i++) {
+    EEPROM.get(EEPROM_RC_CURVES_LOC + (i * sizeof(rc_curve_t)), curves[i]);
+  }
+  return true;
+}
+
 #endif
@@ -1,4 +1,5 @@
 #include "melty_config.h"
+#include "rc_curves.h"
 
 #ifdef ENABLE_EEPROM_STORAGE
 
@@ -17,4 +18,10 @@ int load_heading_led_offset();
 //saves all settings to EEPROM
 void save_settings_to_eeprom(int led_offset, float accel_radius, float accel_zero_g_offset);
 
+//saves RC input curves to EEPROM
+void save_rc_curves(const rc_curve_t *curves, int count);
+
+//retrieves RC input curves from EEPROM (returns false if none saved)
+bool load_rc_curves(rc_curve_t *curves, int count);
+
 #endif
@@ -1,35 +1,66 @@
 #include "debug_handler.h"
-#include "rc_handler.h"
-#include "accel_handler.h"
-#include "motor_driver.h"
-#include "spin_control.h"
-#include "config_storage.h"
-#include "battery_monitor.h"
 #include "web_server.h"
-#include <stdarg.h>
+#include "telemetry_registry.h"
+#include <atomic>
 
-// Time-based buffer to avoid flooding
-#define MIN_MS_BETWEEN_ENTRIES 50
-static unsigned long last_debug_entry_time = 0;
+// Log task (core 0) - formats queued messages, prints them and updates the web log
+#define DEBUG_LOG_TASK_STACK_SIZE 4096
+#define DEBUG_LOG_TASK_PRIORITY 1
+#define DEBUG_LOG_DRAIN_INTERVAL_MS 10
+#define DEBUG_WEB_UPDATE_INTERVAL_MS 250
+
+// debug_log_benchmark - batches stay well inside the ring and the log task drains it between batches
+#define DEBUG_LOG_BENCHMARK_BATCH (DEBUG_LOG_RING_SIZE / 2)
+#define DEBUG_LOG_BENCHMARK_BATCHES 16                // ~1.3s in total (inside the watchdog timeout)
+
+static_assert((DEBUG_LOG_RING_SIZE & (DEBUG_LOG_RING_SIZE - 1)) == 0, "DEBUG_LOG_RING_SIZE must be a power of 2");
 
 // Circular buffer for debug entries
 typedef struct {
   char message[DEBUG_ENTRY_LENGTH];
   DebugLevel level;
-  unsigned long timestamp;
+  unsigned long timestamp_us;
   bool used;
 } DebugEntry;
 
 static DebugEntry debug_entries[DEBUG_MAX_ENTRIES];
 static int debug_write_index = 0;
 
-// Standard telemetry string
-static char telemetry_data[512] = "";
-// Store the latest accelerometer values
-static float latest_accel_x = 0.0f;
-static float latest_accel_y = 0.0f;
-static float latest_accel_z = 0.0f;
-static float latest_accel_used = 0.0f;
+// Message waiting in the log ring - arguments are kept raw and formatted by the log task
+// sequence == position: free for the writer claiming that position / position + 1: holds a message for the log task
+typedef struct {
+  std::atomic<uint32_t> sequence;
+  unsigned long timestamp_us;
+  const char* format;
+  uint8_t level;
+  uint8_t arg_count;
+  const char* module;                             // literal, or a copy at the start of strings (String module)
+  uint8_t arg_types[DEBUG_LOG_MAX_ARGS];
+  debug_arg_value_t arg_values[DEBUG_LOG_MAX_ARGS];
+  char strings[DEBUG_LOG_STRING_SPACE];
+} LogRecord;
+
+// Multiple writers (either core / ISRs) claim positions with a compare and swap - only the log task reads
+static LogRecord log_ring[DEBUG_LOG_RING_SIZE];
+static std::atomic<uint32_t> log_write_position(0);
+static uint32_t log_read_position = 0;
+static std::atomic<uint32_t> log_dropped_messages(0);
+
+volatile uint32_t debug_module_mask = DEBUG_MODULE_MASK_DEFAULT;
+
+// Format used by debug_log_benchmark - its messages are only timed (the log task drops them unformatted)
+static const char log_benchmark_format[] = "benchmark";
+
+// Indexed by debug_module_t - names match the LOG_* module argument
+static const char* const module_names[DEBUG_MODULE_COUNT] = {
+  "SYSTEM", "MOTOR", "RC", "ACCEL", "LED", "POV", "ADC", "EEPROM", "SPIN", "TELEMETRY", "WEB", "WIFI", "FLIGHTLOG"
+};
+
+static const DebugLevel module_compile_levels[DEBUG_MODULE_COUNT] = {
+  DEBUG_LEVEL_SYSTEM, DEBUG_LEVEL_MOTOR, DEBUG_LEVEL_RC, DEBUG_LEVEL_ACCEL, DEBUG_LEVEL_LED, DEBUG_LEVEL_POV,
+  DEBUG_LEVEL_ADC, DEBUG_LEVEL_EEPROM, DEBUG_LEVEL_SPIN, DEBUG_LEVEL_TELEMETRY, DEBUG_LEVEL_WEB, DEBUG_LEVEL_WIFI,
+  DEBUG_LEVEL_FLIGHTLOG
+};
 
 // Mutex for protecting access to the debug data
 portMUX_TYPE debugMux = portMUX_INITIALIZER_UNLOCKED;
@@ -41,6 +72,8 @@ volatile bool debug_initialized = false;
 static bool web_update_needed = false;
 static unsigned long last_web_update = 0;
 
+static void debug_log_task(void *parameter);
+
 void init_debug_handler() {
   // Initialize the debug entries
   portENTER_CRITICAL(&debugMux);
@@ -48,119 +81,388 @@ void init_debug_handler() {
     debug_entries[i].used = false;
     debug_entries[i].message[0] = '\0';
   }
-  telemetry_data[0] = '\0';
-  debug_initialized = true;
   portEXIT_CRITICAL(&debugMux);
-  
+
+  for (uint32_t i = 0; i < DEBUG_LOG_RING_SIZE; i++) {
+    log_ring[i].sequence.store(i, std::memory_order_relaxed);
+  }
+  log_write_position.store(0, std::memory_order_relaxed);
+  log_read_position = 0;
+
+  telemetry_register_ulong("logDrops", "", debug_get_dropped_messages);
+
+  xTaskCreatePinnedToCore(debug_log_task, "debug_log", DEBUG_LOG_TASK_STACK_SIZE, NULL, DEBUG_LOG_TASK_PRIORITY, NULL, 0);
+  debug_initialized = true;
+
   Serial.println("Debug handler initialized");
 }
 
-// Update the latest accelerometer values
-void update_accel_values(float x, float y, float z, float used) {
-  portENTER_CRITICAL(&debugMux);
-  latest_accel_x = x;
-  latest_accel_y = y;
-  latest_accel_z = z;
-  latest_accel_used = used;
-  portEXIT_CRITICAL(&debugMux);
-  
-  // Mark that we need a web update with the new accel data
-  web_update_needed = true;
+static long long arg_as_signed(uint8_t type, const debug_arg_value_t *value) {
+  switch (type) {
+    case DEBUG_ARG_INT: return value->i;
+    case DEBUG_ARG_UINT: return (long long)value->u;
+    case DEBUG_ARG_DOUBLE: return (long long)value->d;
+    default: return (long long)(intptr_t)value->p;
+  }
+}
+
+static double arg_as_double(uint8_t type, const debug_arg_value_t *value) {
+  switch (type) {
+    case DEBUG_ARG_INT: return (double)value->i;
+    case DEBUG_ARG_UINT: return (double)value->u;
+    case DEBUG_ARG_DOUBLE: return value->d;
+    default: return 0.0;
+  }
+}
+
+// Formats a message from captured arguments - one conversion at a time, so the conversion decides how each argument is printed
+// (length modifiers are applied by casting - integers are printed as long long)
+static void format_message(char* buffer, size_t buffer_size, const char* format,
+                           const uint8_t* arg_types, const debug_arg_value_t* arg_values, int arg_count) {
+  static const debug_arg_value_t missing_arg = {};
+  size_t length = 0;
+  int arg_index = 0;
+  const char* f = format;
+
+  while (*f != '\0' && length + 1 < buffer_size) {
+    if (*f != '%') {
+      buffer[length++] = *f++;
+      continue;
+    }
+
+    // Copy flags / width / precision - skip length modifiers - '*' takes its value from the next argument
+    char spec[24];
+    size_t spec_length = 0;
+    bool long_long = false;
+    spec[spec_length++] = *f++;
+    while (*f != '\0' && strchr("-+ #0123456789.*hlLqjzt", *f) != NULL) {
+      if (strchr("hlLqjzt", *f) != NULL) {
+        if (f[0] == 'l' && f[1] == 'l') long_long = true;
+      } else if (*f == '*') {
+        uint8_t type = (arg_index < arg_count) ? arg_types[arg_index] : DEBUG_ARG_INT;
+        const debug_arg_value_t* value = (arg_index < arg_count) ? &arg_values[arg_index] : &missing_arg;
+        arg_index++;
+        if (spec_length < sizeof(spec) - 16) spec_length += snprintf(spec + spec_length, sizeof(spec) - spec_length, "%d", (int)arg_as_signed(type, value));
+      } else if (spec_length < sizeof(spec) - 4) {
+        spec[spec_length++] = *f;
+      }
+      f++;
+    }
+
+    char conversion = *f;
+    if (conversion == '\0') break;
+    f++;
+
+    if (conversion == '%') {
+      buffer[length++] = '%';
+      continue;
+    }
+
+    uint8_t type = (arg_index < arg_count) ? arg_types[arg_index] : DEBUG_ARG_INT;
+    const debug_arg_value_t* value = (arg_index < arg_count) ? &arg_values[arg_index] : &missing_arg;
+    arg_index++;
+
+    char* out = buffer + length;
+    size_t space = buffer_size - length;
+    int written = 0;
+    switch (conversion) {
+      case 'd':
+      case 'i': {
+        long long signed_value = arg_as_signed(type, value);
+        if (!long_long) signed_value = (long)signed_value;
+        spec[spec_length++] = 'l';
+        spec[spec_length++] = 'l';
+        spec[spec_length++] = 'd';
+        spec[spec_length] = '\0';
+        written = snprintf(out, space, spec, signed_value);
+        break;
+      }
+      case 'u':
+      case 'o':
+      case 'x':
+      case 'X': {
+        unsigned long long unsigned_value = (unsigned long long)arg_as_signed(type, value);
+        if (!long_long) unsigned_value = (unsigned long)unsigned_value;
+        spec[spec_length++] = 'l';
+        spec[spec_length++] = 'l';
+        spec[spec_length++] = conversion;
+        spec[spec_length] = '\0';
+        written = snprintf(out, space, spec, unsigned_value);
+        break;
+      }
+      case 'c':
+        spec[spec_length++] = 'c';
+        spec[spec_length] = '\0';
+        written = snprintf(out, space, spec, (int)arg_as_signed(type, value));
+        break;
+      case 's':
+        spec[spec_length++] = 's';
+        spec[spec_length] = '\0';
+        written = snprintf(out, space, spec, (type == DEBUG_ARG_STRING && value->s != NULL) ? value->s : "");
+        break;
+      case 'p':
+        written = snprintf(out, space, "%p", (type == DEBUG_ARG_POINTER || type == DEBUG_ARG_STRING) ? value->p : NULL);
+        break;
+      case 'f':
+      case 'F':
+      case 'e':
+      case 'E':
+      case 'g':
+      case 'G':
+      case 'a':
+      case 'A':
+        spec[spec_length++] = conversion;
+        spec[spec_length] = '\0';
+        written = snprintf(out, space, spec, arg_as_double(type, value));
+        break;
+      default:
+        break;
+    }
+
+    if (written > 0) length += ((size_t)written < space) ? (size_t)written : space - 1;
+  }
+
+  buffer[length] = '\0';
+}
+
+// Copies a string (cut short to fit) - returns bytes used including the terminator
+static size_t copy_string(char* destination, const char* source, size_t space) {
+  if (space == 0) return 0;
+  size_t length = 0;
+  while (source[length] != '\0' && length + 1 < space) {
+    destination[length] = source[length];
+    length++;
+  }
+  destination[length] = '\0';
+  return length + 1;
 }
 
-// Internal helper to add a message to the buffer
-static void add_debug_entry(DebugLevel level, const char* module, const char* message) {
-  // Check if debug system is initialized
+// copy_module - module may not outlive the call (String module) and is copied like a string argument
+static void log_write(DebugLevel level, const char* module, bool copy_module, const char* format, const debug_arg_t* args, int arg_count) {
+  if (arg_count > DEBUG_LOG_MAX_ARGS) arg_count = DEBUG_LOG_MAX_ARGS;
+
+  // Before the log task is running - format and print here
   if (!debug_initialized) {
-    Serial.print("[");
-    Serial.print(module);
-    Serial.print("] ");
-    Serial.println(message);
+    uint8_t arg_types[DEBUG_LOG_MAX_ARGS];
+    debug_arg_value_t arg_values[DEBUG_LOG_MAX_ARGS];
+    for (int i = 0; i < arg_count; i++) {
+      arg_types[i] = args[i].type;
+      arg_values[i] = args[i].value;
+    }
+    char message[DEBUG_ENTRY_LENGTH];
+    format_message(message, sizeof(message), format, arg_types, arg_values, arg_count);
+    Serial.printf("[%s] %s\n", module, message);
     return;
   }
 
-  // Rate limit debug entries
-  unsigned long current_time = millis();
-  if (current_time - last_debug_entry_time < MIN_MS_BETWEEN_ENTRIES) {
-    return;
+  // Claim a position - the slot is free once the log task has released the message DEBUG_LOG_RING_SIZE positions back
+  uint32_t position = log_write_position.load(std::memory_order_relaxed);
+  LogRecord* record;
+  while (true) {
+    record = &log_ring[position & (DEBUG_LOG_RING_SIZE - 1)];
+    int32_t difference = (int32_t)(record->sequence.load(std::memory_order_acquire) - position);
+    if (difference == 0) {
+      if (log_write_position.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)) break;
+    } else if (difference < 0) {
+      // Ring full - log task is behind
+      log_dropped_messages.fetch_add(1, std::memory_order_relaxed);
+      return;
+    } else {
+      position = log_write_position.load(std::memory_order_relaxed);
+    }
   }
-  last_debug_entry_time = current_time;
-  
-  // Check for accelerometer raw data in the message
-  if (strcmp(module, "ACCEL") == 0) {
-    // Check if this is a raw accelerometer value message
-    if (strstr(message, "Raw Accel - X:") != NULL) {
-      // Parse accelerometer values
-      float x = 0.0f, y = 0.0f, z = 0.0f, used = 0.0f;
-      
-      // Very simple parsing - just extract the values
-      const char* x_pos = strstr(message, "X: ");
-      const char* y_pos = strstr(message, "Y: ");
-      const char* z_pos = strstr(message, "Z: ");
-      const char* used_pos = strstr(message, "Used value: ");
-      
-      if (x_pos && y_pos && z_pos && used_pos) {
-        x = atof(x_pos + 3);
-        y = atof(y_pos + 3);
-        z = atof(z_pos + 3);
-        used = atof(used_pos + 12);
-        
-        // Update the accelerometer values
-        update_accel_values(x, y, z, used);
+
+  record->timestamp_us = micros();
+  record->format = format;
+  record->level = level;
+  record->arg_count = arg_count;
+  record->module = module;
+
+  size_t strings_used = 0;
+  if (copy_module) {
+    record->module = record->strings;
+    strings_used = copy_string(record->strings, module, DEBUG_LOG_MODULE_LENGTH);
+  }
+  for (int i = 0; i < arg_count; i++) {
+    record->arg_types[i] = args[i].type;
+    record->arg_values[i] = args[i].value;
+    if (args[i].type == DEBUG_ARG_STRING && args[i].value.s != NULL) {
+      size_t space = sizeof(record->strings) - strings_used;
+      if (space == 0) {
+        record->arg_values[i].s = "";
+        continue;
       }
+      record->arg_values[i].s = record->strings + strings_used;
+      strings_used += copy_string(record->strings + strings_used, args[i].value.s, space);
     }
   }
-  
-  // Format the message with module name prefix
-  char formatted_message[DEBUG_ENTRY_LENGTH];
-  snprintf(formatted_message, DEBUG_ENTRY_LENGTH, "[%s] %s", module, message);
-  
-  // Output to serial immediately (doesn't need mutex protection)
-  Serial.println(formatted_message);
-  
-  // Store in circular buffer with critical section protection
+
+  // Hand the message to the log task
+  record->sequence.store(position + 1, std::memory_order_release);
+}
+
+void debug_log_write(DebugLevel level, const char* module, const char* format, const debug_arg_t* args, int arg_count) {
+  log_write(level, module, false, format, args, arg_count);
+}
+
+// module from a String - copied into the record
+static void print_copied_module(const char* module, const char* message) {
+  debug_arg_t arg = debug_arg(message);
+  log_write(DEBUG_INFO, module, true, "%s", &arg, 1);
+}
+
+void debug_print(const char* module, const char* message) {
+  debug_print_level(DEBUG_INFO, module, message);
+}
+
+void debug_print_level(DebugLevel level, const char* module, const char* message) {
+  debug_arg_t arg = debug_arg(message);
+  debug_log_write(level, module, "%s", &arg, 1);
+}
+
+void debug_set_module_enabled(debug_module_t module, bool enabled) {
+  if (module >= DEBUG_MODULE_COUNT) return;
+  portENTER_CRITICAL(&debugMux);
+  if (enabled) {
+    debug_module_mask |= (1UL << module);
+  } else {
+    debug_module_mask &= ~(1UL << module);
+  }
+  portEXIT_CRITICAL(&debugMux);
+}
+
+const char* debug_module_name(debug_module_t module) {
+  if (module >= DEBUG_MODULE_COUNT) return "";
+  return module_names[module];
+}
+
+debug_module_t debug_find_module(const char* name) {
+  int module = 0;
+  while (module < DEBUG_MODULE_COUNT && strcmp(name, module_names[module]) != 0) module++;
+  return (debug_module_t)module;
+}
+
+DebugLevel debug_module_compile_level(debug_module_t module) {
+  if (module >= DEBUG_MODULE_COUNT) return DEBUG_LEVEL_DEFAULT;
+  return module_compile_levels[module];
+}
+
+unsigned long debug_get_dropped_messages() {
+  return log_dropped_messages.load(std::memory_order_relaxed);
+}
+
+// Prints a formatted message and adds it to the web log (log task only)
+static void add_debug_entry(DebugLevel level, const char* message, unsigned long timestamp_us) {
+  Serial.println(message);
+
   portENTER_CRITICAL(&debugMux);
   debug_entries[debug_write_index].level = level;
-  debug_entries[debug_write_index].timestamp = current_time;
+  debug_entries[debug_write_index].timestamp_us = timestamp_us;
   debug_entries[debug_write_index].used = true;
-  strncpy(debug_entries[debug_write_index].message, formatted_message, DEBUG_ENTRY_LENGTH - 1);
+  strncpy(debug_entries[debug_write_index].message, message, DEBUG_ENTRY_LENGTH - 1);
   debug_entries[debug_write_index].message[DEBUG_ENTRY_LENGTH - 1] = '\0';
-  
+
   // Move to next slot in circular buffer
   debug_write_index = (debug_write_index + 1) % DEBUG_MAX_ENTRIES;
-  
-  // Mark that web data needs updating, but don't do it here
-  web_update_needed = true;
-  
   portEXIT_CRITICAL(&debugMux);
+
+  web_update_needed = true;
 }
 
-void debug_print(const char* module, const char* message) {
-  debug_print_level(DEBUG_INFO, module, message);
+// Formats / prints one queued message - returns false if there is none waiting
+static bool drain_log_record() {
+  LogRecord* record = &log_ring[log_read_position & (DEBUG_LOG_RING_SIZE - 1)];
+  if (record->sequence.load(std::memory_order_acquire) != log_read_position + 1) return false;
+
+  if (record->format == log_benchmark_format) {
+    record->sequence.store(log_read_position + DEBUG_LOG_RING_SIZE, std::memory_order_release);
+    log_read_position++;
+    return true;
+  }
+
+  char message[DEBUG_ENTRY_LENGTH];
+  int prefix_length = snprintf(message, sizeof(message), "[%s] ", record->module);
+  format_message(message + prefix_length, sizeof(message) - prefix_length, record->format,
+                 record->arg_types, record->arg_values, record->arg_count);
+  DebugLevel level = (DebugLevel)record->level;
+  unsigned long timestamp_us = record->timestamp_us;
+
+  // Free the slot for the writer that will claim it next time around the ring
+  record->sequence.store(log_read_position + DEBUG_LOG_RING_SIZE, std::memory_order_release);
+  log_read_position++;
+
+  add_debug_entry(level, message, timestamp_us);
+  return true;
 }
 
-void debug_printf(const char* module, const char* format, ...) {
-  char buffer[DEBUG_ENTRY_LENGTH];
-  va_list args;
-  va_start(args, format);
-  vsnprintf(buffer, DEBUG_ENTRY_LENGTH, format, args);
-  va_end(args);
-  
-  debug_print(module, buffer);
+// Benchmark batches - argument mixes match typical control loop messages (3 args includes a string copy)
+static void log_benchmark_no_args() {
+  for (int i = 0; i < DEBUG_LOG_BENCHMARK_BATCH; i++) LOG_INFO(SYSTEM, log_benchmark_format);
 }
 
-void debug_print_level(DebugLevel level, const char* module, const char* message) {
-  add_debug_entry(level, module, message);
+static void log_benchmark_3_args() {
+  for (int i = 0; i < DEBUG_LOG_BENCHMARK_BATCH; i++) LOG_INFO(SYSTEM, log_benchmark_format, i, 1.5f, "motor");
 }
 
-void debug_printf_level(DebugLevel level, const char* module, const char* format, ...) {
-  char buffer[DEBUG_ENTRY_LENGTH];
-  va_list args;
-  va_start(args, format);
-  vsnprintf(buffer, DEBUG_ENTRY_LENGTH, format, args);
-  va_end(args);
-  
-  debug_print_level(level, module, buffer);
+static void log_benchmark_10_args() {
+  for (int i = 0; i < DEBUG_LOG_BENCHMARK_BATCH; i++) {
+    LOG_INFO(SYSTEM, log_benchmark_format, i, 1.5f, "motor", 2UL, -3, 4.5, i, 6U, 7.5f, 8L);
+  }
+}
+
+// Average ns per call over all batches - waits for the log task to empty the ring after each batch
+static unsigned long time_log_batches(void (*batch)()) {
+  uint64_t cycles = 0;
+  for (int i = 0; i < DEBUG_LOG_BENCHMARK_BATCHES; i++) {
+    uint32_t start = ESP.getCycleCount();
+    batch();
+    cycles += ESP.getCycleCount() - start;
+    delay(DEBUG_LOG_DRAIN_INTERVAL_MS * 2);
+  }
+  return (unsigned long)((cycles * 1000) / ((uint64_t)DEBUG_LOG_BENCHMARK_BATCH * DEBUG_LOG_BENCHMARK_BATCHES * ESP.getCpuFreqMHz()));
+}
+
+void debug_log_benchmark() {
+  bool system_enabled = debug_module_enabled(DEBUG_MODULE_SYSTEM);
+  unsigned long drops_before = debug_get_dropped_messages();
+
+  debug_set_module_enabled(DEBUG_MODULE_SYSTEM, false);
+  unsigned long disabled_ns = time_log_batches(log_benchmark_3_args);
+  debug_set_module_enabled(DEBUG_MODULE_SYSTEM, true);
+  unsigned long no_args_ns = time_log_batches(log_benchmark_no_args);
+  unsigned long args_3_ns = time_log_batches(log_benchmark_3_args);
+  unsigned long args_10_ns = time_log_batches(log_benchmark_10_args);
+  debug_set_module_enabled(DEBUG_MODULE_SYSTEM, system_enabled);
+
+  // Drops mean the log task couldn't keep up - those calls took the (cheaper) ring full path
+  LOG_INFO(SYSTEM, "Log benchmark - ns per LOG_INFO call: module disabled %lu, 0 args %lu, 3 args %lu, 10 args %lu (%lu dropped)",
+           disabled_ns, no_args_ns, args_3_ns, args_10_ns, debug_get_dropped_messages() - drops_before);
+}
+
+static void debug_log_task(void *parameter) {
+  unsigned long reported_drops = 0;
+
+  while (true) {
+    while (drain_log_record()) {
+    }
+
+    unsigned long drops = debug_get_dropped_messages();
+    if (drops != reported_drops) {
+      char message[DEBUG_ENTRY_LENGTH];
+      snprintf(message, sizeof(message), "[DEBUG] %lu messages dropped (log ring full)", drops - reported_drops);
+      add_debug_entry(DEBUG_WARNING, message, micros());
+      reported_drops = drops;
+    }
+
+    // Web log text is only copied when it changed (at most every DEBUG_WEB_UPDATE_INTERVAL_MS)
+    if (web_update_needed && millis() - last_web_update >= DEBUG_WEB_UPDATE_INTERVAL_MS) {
+      last_web_update = millis();
+      web_update_needed = false;
+      update_web_logs(get_debug_data());
+    }
+
+    vTaskDelay(pdMS_TO_TICKS(DEBUG_LOG_DRAIN_INTERVAL_MS));
+  }
 }
 
 String get_debug_data() {
@@ -171,21 +473,8 @@ String get_debug_data() {
     return "Debug system not initialized";
   }
   
-  // Get telemetry data with mutex protection
+  // Add the most recent entries with mutex protection
   portENTER_CRITICAL(&debugMux);
-  result = telemetry_data;
-  
-  // Add accelerometer values explicitly to help parsing
-  if (latest_accel_x != 0.0f || latest_accel_y != 0.0f || latest_accel_z != 0.0f) {
-    char accelBuffer[128];
-    snprintf(accelBuffer, sizeof(accelBuffer), " X: %.2fg, Y: %.2fg, Z: %.2fg, Used value: %.2fg", 
-             latest_accel_x, latest_accel_y, latest_accel_z, latest_accel_used);
-    result += accelBuffer;
-  }
-  
-  result += "\n\n";
-  
-  // Add the most recent entries
   for (int i = 0; i < DEBUG_MAX_ENTRIES; i++) {
     int idx = (debug_write_index - 1 - i + DEBUG_MAX_ENTRIES) % DEBUG_MAX_ENTRIES;
     if (debug_entries[idx].used) {
@@ -215,114 +504,6 @@ void clear_debug_data() {
   for (int i = 0; i < DEBUG_MAX_ENTRIES; i++) {
     debug_entries[i].used = false;
   }
-  telemetry_data[0] = '\0';
-  portEXIT_CRITICAL(&debugMux);
-}
-
-void update_standard_diagnostics() {
-  // Check if debug system is initialized
-  if (!debug_initialized) return;
-  
-  // Don't update the web too frequently (max once every 250ms)
-  unsigned long current_time = millis();
-  if (current_time - last_web_update < 250 && !web_update_needed) {
-    return;
-  }
-  
-  last_web_update = current_time;
-  web_update_needed = false;
-  
-  // Build new telemetry string outside critical section
-  char newTelemetry[512] = "";
-  char buffer[64];
-  
-  // Add telemetry data with safer string handling
-  snprintf(buffer, sizeof(buffer), "Raw Accel G: %.2f  ", get_accel_force_g());
-  strncat(newTelemetry, buffer, sizeof(newTelemetry) - strlen(newTelemetry) - 1);
-  
-  snprintf(buffer, sizeof(buffer), "RC Health: %d  ", rc_signal_is_healthy());
-  strncat(newTelemetry, buffer, sizeof(newTelemetry) - strlen(newTelemetry) - 1);
-  
-  snprintf(buffer, sizeof(buffer), "RC Throttle: %d  ", rc_get_throttle_percent());
-  strncat(newTelemetry, buffer, sizeof(newTelemetry) - strlen(newTelemetry) - 1);
-  
-  snprintf(buffer, sizeof(buffer), "RC L/R: %d  ", rc_get_leftright());
-  strncat(newTelemetry, buffer, sizeof(newTelemetry) - strlen(newTelemetry) - 1);
-  
-  snprintf(buffer, sizeof(buffer), "RC F/B: %d  ", rc_get_forback_enum());
-  strncat(newTelemetry, buffer, sizeof(newTelemetry) - strlen(newTelemetry) - 1);
-  
-  // Add motor PWM values if using servo PWM throttle
-  if (THROTTLE_TYPE == SERVO_PWM_THROTTLE) {
-    snprintf(buffer, sizeof(buffer), "Motor1 PWM: %dus  ", get_motor1_pulse_width());
-    strncat(newTelemetry, buffer, sizeof(newTelemetry) - strlen(newTelemetry) - 1);
-    
-    snprintf(buffer, sizeof(buffer), "Motor2 PWM: %dus  ", get_motor2_pulse_width());
-    strncat(newTelemetry, buffer, sizeof(newTelemetry) - strlen(newTelemetry) - 1);
-  }
-  
-#ifdef BATTERY_ALERT_ENABLED
-  snprintf(buffer, sizeof(buffer), "Battery: %.2fV  ", get_battery_voltage());
-  strncat(newTelemetry, buffer, sizeof(newTelemetry) - strlen(newTelemetry) - 1);
-#endif 
-  
-#ifdef ENABLE_EEPROM_STORAGE  
-  snprintf(buffer, sizeof(buffer), "Radius: %.2f  ", load_accel_mount_radius());
-  strncat(newTelemetry, buffer, sizeof(newTelemetry) - strlen(newTelemetry) - 1);
-  
-  snprintf(buffer, sizeof(buffer), "Heading: %d  ", load_heading_led_offset());
-  strncat(newTelemetry, buffer, sizeof(newTelemetry) - strlen(newTelemetry) - 1);
-  
-  snprintf(buffer, sizeof(buffer), "Zero G: %.2f  ", load_accel_zero_g_offset());
-  strncat(newTelemetry, buffer, sizeof(newTelemetry) - strlen(newTelemetry) - 1);
-#endif
-
-  // Update telemetry in critical section
-  portENTER_CRITICAL(&debugMux);
-  strncpy(telemetry_data, newTelemetry, sizeof(telemetry_data) - 1);
-  telemetry_data[sizeof(telemetry_data) - 1] = '\0';
-  portEXIT_CRITICAL(&debugMux);
-
-  // Now update the web data with all current data
-  String completeData = get_debug_data();
-  int separatorIndex = completeData.indexOf("\n\n");
-  if (separatorIndex != -1) {
-    String telemetry = completeData.substring(0, separatorIndex);
-    String logs = completeData.substring(separatorIndex + 2);
-    update_web_data(telemetry, logs);
-  } else {
-    update_web_data(completeData, "");
-  }
-}
-
-// These helper functions are no longer used, but kept for API compatibility
-void add_telemetry_data(const char* label, float value) {
-  char buffer[64];
-  snprintf(buffer, sizeof(buffer), "%s: %.2f", label, value);
-  
-  portENTER_CRITICAL(&debugMux);
-  strncat(telemetry_data, buffer, sizeof(telemetry_data) - strlen(telemetry_data) - 1);
-  strncat(telemetry_data, "  ", sizeof(telemetry_data) - strlen(telemetry_data) - 1);
-  portEXIT_CRITICAL(&debugMux);
-}
-
-void add_telemetry_data(const char* label, int value) {
-  char buffer[64];
-  snprintf(buffer, sizeof(buffer), "%s: %d", label, value);
-  
-  portENTER_CRITICAL(&debugMux);
-  strncat(telemetry_data, buffer, sizeof(telemetry_data) - strlen(telemetry_data) - 1);
-  strncat(telemetry_data, "  ", sizeof(telemetry_data) - strlen(telemetry_data) - 1);
-  portEXIT_CRITICAL(&debugMux);
-}
-
-void add_telemetry_data(const char* label, const String& value) {
-  char buffer[64];
-  snprintf(buffer, sizeof(buffer), "%s: %s", label, value.c_str());
-  
-  portENTER_CRITICAL(&debugMux);
-  strncat(telemetry_data, buffer, sizeof(telemetry_data) - strlen(telemetry_data) - 1);
-  strncat(telemetry_data, "  ", sizeof(telemetry_data) - strlen(telemetry_data) - 1);
   portEXIT_CRITICAL(&debugMux);
 }
 
@@ -332,11 +513,11 @@ void debug_print_safe(const char* module, const String& message) {
 }
 
 void debug_print_safe(const String& module, const String& message) {
-  debug_print(module.c_str(), message.c_str());
+  print_copied_module(module.c_str(), message.c_str());
 }
 
 void debug_print_safe(const String& module, const char* message) {
-  debug_print(module.c_str(), message);
+  print_copied_module(module.c_str(), message);
 }
 
 void debug_print_safe(const char* module, const char* message) {
@@ -2,25 +2,189 @@
 #define DEBUG_HANDLER_H
 
 #include <Arduino.h>
+#include <type_traits>
+#include "melty_config.h"
 
 // Maximum number of log entries to keep
 #define DEBUG_MAX_ENTRIES 20
 // Maximum length of each debug entry
 #define DEBUG_ENTRY_LENGTH 100
 
-// Debug levels
+// Log ring - debug calls only capture their arguments, a low priority task on core 0 formats / prints them
+#define DEBUG_LOG_RING_SIZE 64                        // messages waiting to be formatted (power of 2) - extra messages are dropped and counted
+#define DEBUG_LOG_MAX_ARGS 10                         // format arguments kept per message (any more print as 0)
+#define DEBUG_LOG_STRING_SPACE 96                     // bytes per message for copies of string arguments (longer strings are cut short)
+#define DEBUG_LOG_MODULE_LENGTH 12                    // module names passed as String are copied (cut short past this length)
+
+// Debug levels (lowest first)
 enum DebugLevel {
-  DEBUG_INFO = 0,
-  DEBUG_WARNING = 1,
-  DEBUG_ERROR = 2
+  DEBUG_VERBOSE = 0,    // periodic traces from the control loop - compiled out unless enabled for the module
+  DEBUG_INFO = 1,
+  DEBUG_WARNING = 2,
+  DEBUG_ERROR = 3
+};
+
+// Modules for LOG_* macros - each has a compile-time level (DEBUG_LEVEL_<module>) and a bit in the runtime mask
+enum debug_module_t {
+  DEBUG_MODULE_SYSTEM = 0,
+  DEBUG_MODULE_MOTOR,
+  DEBUG_MODULE_RC,
+  DEBUG_MODULE_ACCEL,
+  DEBUG_MODULE_LED,
+  DEBUG_MODULE_POV,
+  DEBUG_MODULE_ADC,
+  DEBUG_MODULE_EEPROM,
+  DEBUG_MODULE_SPIN,
+  DEBUG_MODULE_TELEMETRY,
+  DEBUG_MODULE_WEB,
+  DEBUG_MODULE_WIFI,
+  DEBUG_MODULE_FLIGHTLOG,
+  DEBUG_MODULE_COUNT
+};
+
+static_assert(DEBUG_MODULE_COUNT <= 32, "debug_module_mask has one bit per module");
+
+// Compile-time levels (set in melty_config.h) - messages below these are removed entirely
+#ifndef DEBUG_LEVEL_DEFAULT
+#define DEBUG_LEVEL_DEFAULT DEBUG_INFO
+#endif
+#ifndef DEBUG_LEVEL_SYSTEM
+#define DEBUG_LEVEL_SYSTEM DEBUG_LEVEL_DEFAULT
+#endif
+#ifndef DEBUG_LEVEL_MOTOR
+#define DEBUG_LEVEL_MOTOR DEBUG_LEVEL_DEFAULT
+#endif
+#ifndef DEBUG_LEVEL_RC
+#define DEBUG_LEVEL_RC DEBUG_LEVEL_DEFAULT
+#endif
+#ifndef DEBUG_LEVEL_ACCEL
+#define DEBUG_LEVEL_ACCEL DEBUG_LEVEL_DEFAULT
+#endif
+#ifndef DEBUG_LEVEL_LED
+#define DEBUG_LEVEL_LED DEBUG_LEVEL_DEFAULT
+#endif
+#ifndef DEBUG_LEVEL_POV
+#define DEBUG_LEVEL_POV DEBUG_LEVEL_DEFAULT
+#endif
+#ifndef DEBUG_LEVEL_ADC
+#define DEBUG_LEVEL_ADC DEBUG_LEVEL_DEFAULT
+#endif
+#ifndef DEBUG_LEVEL_EEPROM
+#define DEBUG_LEVEL_EEPROM DEBUG_LEVEL_DEFAULT
+#endif
+#ifndef DEBUG_LEVEL_SPIN
+#define DEBUG_LEVEL_SPIN DEBUG_LEVEL_DEFAULT
+#endif
+#ifndef DEBUG_LEVEL_TELEMETRY
+#define DEBUG_LEVEL_TELEMETRY DEBUG_LEVEL_DEFAULT
+#endif
+#ifndef DEBUG_LEVEL_WEB
+#define DEBUG_LEVEL_WEB DEBUG_LEVEL_DEFAULT
+#endif
+#ifndef DEBUG_LEVEL_WIFI
+#define DEBUG_LEVEL_WIFI DEBUG_LEVEL_DEFAULT
+#endif
+#ifndef DEBUG_LEVEL_FLIGHTLOG
+#define DEBUG_LEVEL_FLIGHTLOG DEBUG_LEVEL_DEFAULT
+#endif
+#ifndef DEBUG_MODULE_MASK_DEFAULT
+#define DEBUG_MODULE_MASK_DEFAULT 0xFFFFFFFF
+#endif
+
+// Format argument captured by debug_printf - the type decides how it is stored, the conversion in the format how it is printed
+enum debug_arg_type_t : uint8_t {
+  DEBUG_ARG_INT = 0,
+  DEBUG_ARG_UINT,
+  DEBUG_ARG_DOUBLE,
+  DEBUG_ARG_STRING,     // copied into the message (pointer doesn't need to stay valid)
+  DEBUG_ARG_POINTER
+};
+
+union debug_arg_value_t {
+  long long i;
+  unsigned long long u;
+  double d;
+  const char *s;
+  const void *p;
 };
 
-// Initialize the debug handler
+struct debug_arg_t {
+  debug_arg_type_t type;
+  debug_arg_value_t value;
+};
+
+template <typename T>
+inline typename std::enable_if<std::is_integral<T>::value && std::is_signed<T>::value, debug_arg_t>::type debug_arg(T value) {
+  debug_arg_t arg;
+  arg.type = DEBUG_ARG_INT;
+  arg.value.i = value;
+  return arg;
+}
+
+template <typename T>
+inline typename std::enable_if<std::is_integral<T>::value && std::is_unsigned<T>::value, debug_arg_t>::type debug_arg(T value) {
+  debug_arg_t arg;
+  arg.type = DEBUG_ARG_UINT;
+  arg.value.u = value;
+  return arg;
+}
+
+template <typename T>
+inline typename std::enable_if<std::is_enum<T>::value, debug_arg_t>::type debug_arg(T value) {
+  debug_arg_t arg;
+  arg.type = DEBUG_ARG_INT;
+  arg.value.i = (long long)value;
+  return arg;
+}
+
+template <typename T>
+inline typename std::enable_if<std::is_floating_point<T>::value, debug_arg_t>::type debug_arg(T value) {
+  debug_arg_t arg;
+  arg.type = DEBUG_ARG_DOUBLE;
+  arg.value.d = value;
+  return arg;
+}
+
+inline debug_arg_t debug_arg(const char *value) {
+  debug_arg_t arg;
+  arg.type = DEBUG_ARG_STRING;
+  arg.value.s = value;
+  return arg;
+}
+
+inline debug_arg_t debug_arg(char *value) {
+  return debug_arg((const char *)value);
+}
+
+template <typename T>
+inline debug_arg_t debug_arg(T *value) {
+  debug_arg_t arg;
+  arg.type = DEBUG_ARG_POINTER;
+  arg.value.p = (const void *)value;
+  return arg;
+}
+
+// Initialize the debug handler (starts the log task on core 0)
 void init_debug_handler();
 
+// Queue a message for the log task - no formatting, locks or Serial output (safe from the control loop / ISRs)
+// format and module must stay valid (string literals) - string arguments are copied
+void debug_log_write(DebugLevel level, const char* module, const char* format, const debug_arg_t* args, int arg_count);
+
+// Unfiltered logging - always written (prefer the LOG_* macros above)
 // Add a debug message to the global buffer
 void debug_print(const char* module, const char* message);
-void debug_printf(const char* module, const char* format, ...);
+
+template <typename... Args>
+inline void debug_printf_level(DebugLevel level, const char* module, const char* format, Args... args) {
+  const debug_arg_t packed_args[] = { debug_arg(args)..., debug_arg_t() };
+  debug_log_write(level, module, format, packed_args, sizeof...(Args));
+}
+
+template <typename... Args>
+inline void debug_printf(const char* module, const char* format, Args... args) {
+  debug_printf_level(DEBUG_INFO, module, format, args...);
+}
 
 // String-safe versions that accept Arduino String objects
 void debug_print_safe(const char* module, const String& message);
@@ -30,20 +194,61 @@ void debug_print_safe(const char* module, const char* message);
 
 // Add a debug message with a level
 void debug_print_level(DebugLevel level, const char* module, const char* message);
-void debug_printf_level(DebugLevel level, const char* module, const char* format, ...);
 
-// Get the current debug data as a string
+// Runtime module mask - bit per debug_module_t (cleared bits skip LOG_* calls for that module)
+extern volatile uint32_t debug_module_mask;
+
+inline bool debug_module_enabled(debug_module_t module) {
+  return (debug_module_mask >> module) & 1;
+}
+
+void debug_set_module_enabled(debug_module_t module, bool enabled);
+
+// Module name as used in log messages ("RC") / module for a name (DEBUG_MODULE_COUNT if unknown)
+const char* debug_module_name(debug_module_t module);
+debug_module_t debug_find_module(const char* name);
+
+// Level set at compile time for a module (messages below it were compiled out)
+DebugLevel debug_module_compile_level(debug_module_t module);
+
+// Logging macros - module is the bare name (LOG_INFO(RC, "Armed")), format / arguments as debug_printf
+// The check is a compile-time constant plus one mask test, and arguments are only evaluated when the message is written -
+// a disabled LOG_VERBOSE in the control loop costs nothing
+#define LOG_ENABLED(level, module) ((level) >= DEBUG_LEVEL_##module && debug_module_enabled(DEBUG_MODULE_##module))
+
+#define LOG_AT_LEVEL(level, module, ...) \
+  do { \
+    if (LOG_ENABLED(level, module)) debug_printf_level(level, #module, __VA_ARGS__); \
+  } while (0)
+
+#define LOG_VERBOSE(module, ...) LOG_AT_LEVEL(DEBUG_VERBOSE, module, __VA_ARGS__)
+#define LOG_INFO(module, ...) LOG_AT_LEVEL(DEBUG_INFO, module, __VA_ARGS__)
+#define LOG_WARNING(module, ...) LOG_AT_LEVEL(DEBUG_WARNING, module, __VA_ARGS__)
+#define LOG_ERROR(module, ...) LOG_AT_LEVEL(DEBUG_ERROR, module, __VA_ARGS__)
+
+// Rate limited message (at most once per interval_ms per call site) - the timer isn't touched while the message is disabled
+#define LOG_EVERY_MS(level, module, interval_ms, ...) \
+  do { \
+    if (LOG_ENABLED(level, module)) { \
+      static unsigned long log_last_ms_ = 0; \
+      if (millis() - log_last_ms_ >= (interval_ms)) { \
+        log_last_ms_ = millis(); \
+        debug_printf_level(level, #module, __VA_ARGS__); \
+      } \
+    } \
+  } while (0)
+
+// Times LOG_INFO calls made from the calling core (module disabled / 0 / 3 / 10 args) and logs ns per call
+// Takes a few seconds - used by JUST_DO_MOTOR_BENCHMARK
+void debug_log_benchmark();
+
+// Number of messages dropped because the log ring was full
+unsigned long debug_get_dropped_messages();
+
+// Get the most recent log entries as a string (newest first)
 String get_debug_data();
 
 // Clear all debug entries
 void clear_debug_data();
 
-// Update the standard diagnostic data
-void update_standard_diagnostics();
-
-// Format telemetry data for diagnostics
-void add_telemetry_data(const char* label, float value);
-void add_telemetry_data(const char* label, int value);
-void add_telemetry_data(const char* label, const String& value);
-
-#endif // DEBUG_HANDLER_H 
+#endif // DEBUG_HANDLER_H
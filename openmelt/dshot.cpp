@@ -0,0 +1,283 @@
+//this module generates DShot frames for the ESCs using the ESP32 RMT peripheral
+//(only initialized when THROTTLE_TYPE is DSHOT_THROTTLE)
+//packet encoding / telemetry decoding are in dshot_packet.cpp (no hardware dependencies - host tested in tests/)
+
+#include <Arduino.h>
+#include "melty_config.h"
+#include "dshot.h"
+#include "debug_handler.h"
+#include "driver/rmt.h"
+#include "driver/gpio.h"
+
+//RMT runs from 80MHz APB clock - 12.5ns ticks
+#define DSHOT_RMT_CLK_DIV 1
+#define DSHOT_RMT_TICKS_PER_US 80
+
+#define DSHOT_BIT_TICKS ((DSHOT_RMT_TICKS_PER_US * 1000) / DSHOT_SPEED)
+#define DSHOT_T1H_TICKS ((DSHOT_BIT_TICKS * 3) / 4)     //"1" bit is high for 75% of bit period
+#define DSHOT_T0H_TICKS ((DSHOT_BIT_TICKS * 3) / 8)     //"0" bit is high for 37.5% of bit period
+
+#define DSHOT_FRAME_BITS 16
+
+//idle time between repeated frames (low) - at least 2 bit periods
+#define DSHOT_FRAME_TICKS (DSHOT_BIT_TICKS * DSHOT_FRAME_BITS)
+#define DSHOT_GAP_TICKS ((DSHOT_FRAME_INTERVAL_US * DSHOT_RMT_TICKS_PER_US) > (DSHOT_FRAME_TICKS + (DSHOT_BIT_TICKS * 2)) ? \
+                         (DSHOT_FRAME_INTERVAL_US * DSHOT_RMT_TICKS_PER_US) - DSHOT_FRAME_TICKS : (DSHOT_BIT_TICKS * 2))
+
+//16 data bits + gap + end marker
+#define DSHOT_RMT_ITEMS (DSHOT_FRAME_BITS + 2)
+
+//bidirectional signal is inverted (idle high / bits are low pulses)
+#define DSHOT_ACTIVE_LEVEL (DSHOT_BIDIRECTIONAL ? 0 : 1)
+#define DSHOT_IDLE_LEVEL (DSHOT_BIDIRECTIONAL ? 1 : 0)
+
+//ESC reply is sent at 5/4 of the DShot bit rate
+#define DSHOT_TELEMETRY_BIT_TICKS ((DSHOT_BIT_TICKS * 4) / 5)
+
+//GCR runs are at most 3 bits long - reply is complete after this long without an edge
+#define DSHOT_RX_IDLE_TICKS (DSHOT_TELEMETRY_BIT_TICKS * 5)
+#define DSHOT_RX_FILTER_TICKS 40                   //ignore glitches shorter than 0.5us
+#define DSHOT_RX_BUFFER_SIZE 4096                  //RX ring buffer also receives our own frames (rejected by decoder)
+
+#define DSHOT_TELEMETRY_TASK_STACK_SIZE 2048
+
+static const rmt_channel_t dshot_channels[DSHOT_MOTOR_COUNT] = {
+  DSHOT_RMT_CHANNEL_MOTOR1,
+  DSHOT_RMT_CHANNEL_MOTOR2
+};
+
+static const rmt_channel_t dshot_rx_channels[DSHOT_MOTOR_COUNT] = {
+  DSHOT_RMT_RX_CHANNEL_MOTOR1,
+  DSHOT_RMT_RX_CHANNEL_MOTOR2
+};
+
+static int last_values[DSHOT_MOTOR_COUNT] = { -1, -1 };
+
+//a new value is handed to the TX end callback, which refills channel RAM while the channel is stopped between frames
+static portMUX_TYPE dshot_mux = portMUX_INITIALIZER_UNLOCKED;
+static volatile uint16_t pending_packets[DSHOT_MOTOR_COUNT] = { 0, 0 };
+static volatile bool refill_pending[DSHOT_MOTOR_COUNT] = { false, false };
+
+//written by telemetry task (core 0) - read by control loop
+static RingbufHandle_t rx_buffers[DSHOT_MOTOR_COUNT] = { NULL, NULL };
+static volatile int32_t latest_erpm[DSHOT_MOTOR_COUNT] = { DSHOT_ERPM_INVALID, DSHOT_ERPM_INVALID };
+static volatile unsigned long latest_erpm_time_ms[DSHOT_MOTOR_COUNT] = { 0, 0 };
+static volatile unsigned long latest_erpm_time_us[DSHOT_MOTOR_COUNT] = { 0, 0 };
+static volatile uint32_t latest_erpm_sequence[DSHOT_MOTOR_COUNT] = { 0, 0 };   //odd while a sample is being written
+static volatile uint32_t erpm_error_count = 0;
+
+//builds RMT items for a packet (MSB first) followed by the inter-frame gap and end marker
+static void build_frame_items(uint16_t packet, rmt_item32_t *items) {
+  for (int bit = 0; bit < DSHOT_FRAME_BITS; bit++) {
+    bool one = packet & (0x8000 >> bit);
+    uint32_t high_ticks = one ? DSHOT_T1H_TICKS : DSHOT_T0H_TICKS;
+    items[bit].level0 = DSHOT_ACTIVE_LEVEL;
+    items[bit].duration0 = high_ticks;
+    items[bit].level1 = DSHOT_IDLE_LEVEL;
+    items[bit].duration1 = DSHOT_BIT_TICKS - high_ticks;
+  }
+
+  //ESC reply (bidirectional) arrives during the gap
+  items[DSHOT_FRAME_BITS].level0 = DSHOT_IDLE_LEVEL;
+  items[DSHOT_FRAME_BITS].duration0 = DSHOT_GAP_TICKS / 2;
+  items[DSHOT_FRAME_BITS].level1 = DSHOT_IDLE_LEVEL;
+  items[DSHOT_FRAME_BITS].duration1 = DSHOT_GAP_TICKS - (DSHOT_GAP_TICKS / 2);
+
+  //zero duration item marks end of data (RMT wraps back to start in loop mode)
+  items[DSHOT_FRAME_BITS + 1].val = 0;
+}
+
+//fills channel RAM with a frame - only while the channel isn't transmitting
+static void fill_frame(rmt_channel_t channel, uint16_t packet) {
+  rmt_item32_t items[DSHOT_RMT_ITEMS];
+  build_frame_items(packet, items);
+  rmt_fill_tx_items(channel, items, DSHOT_RMT_ITEMS, 0);
+}
+
+//called from the RMT interrupt when a channel stops at the end of a frame (loop mode was turned off by dshot_write)
+//refills the frame and restarts looping - the ESC sees the usual gap plus the interrupt latency
+static void dshot_tx_end(rmt_channel_t channel, void *arg) {
+  for (int motor = 0; motor < DSHOT_MOTOR_COUNT; motor++) {
+    if (channel != dshot_channels[motor]) continue;
+
+    portENTER_CRITICAL_ISR(&dshot_mux);
+    if (refill_pending[motor]) {
+      fill_frame(channel, pending_packets[motor]);
+      rmt_set_tx_loop_mode(channel, true);
+      rmt_tx_start(channel, true);
+      rmt_set_tx_intr_en(channel, false);
+      refill_pending[motor] = false;
+    }
+    portEXIT_CRITICAL_ISR(&dshot_mux);
+  }
+}
+
+void dshot_write(int motor_index, uint16_t value) {
+  if (value == last_values[motor_index]) return;
+  last_values[motor_index] = value;
+
+  //channel RAM can't be rewritten while looping (a frame torn part way through could still pass the 4 bit CRC)
+  //so loop mode is turned off - the current frame finishes and dshot_tx_end swaps in the new one
+  //if the interrupt never came the output would stop and the ESC would fail safe (no signal)
+  rmt_channel_t channel = dshot_channels[motor_index];
+  portENTER_CRITICAL(&dshot_mux);
+  pending_packets[motor_index] = dshot_make_packet(value, false, DSHOT_BIDIRECTIONAL);
+  if (!refill_pending[motor_index]) {
+    refill_pending[motor_index] = true;
+    rmt_set_tx_intr_en(channel, true);
+    rmt_set_tx_loop_mode(channel, false);
+  }
+  portEXIT_CRITICAL(&dshot_mux);
+}
+
+//converts a received RMT capture to telemetry bits (1 at start of each run of equal level)
+//returns false if capture is not a 21 bit reply (our own frames are seen by the RX channel too - their short pulses are rejected here)
+static bool telemetry_bits_from_items(const rmt_item32_t *items, size_t count, uint32_t *telemetry_bits) {
+  uint32_t bits = 0;
+  int bit_count = 0;
+
+  for (size_t i = 0; i < count * 2; i++) {
+    uint32_t duration = (i & 1) ? items[i / 2].duration1 : items[i / 2].duration0;
+    uint32_t level = (i & 1) ? items[i / 2].level1 : items[i / 2].level0;
+    if (duration == 0) break;
+
+    int run_bits = (duration + (DSHOT_TELEMETRY_BIT_TICKS / 2)) / DSHOT_TELEMETRY_BIT_TICKS;
+    if (run_bits == 0) return false;
+
+    //trailing high run merges into idle - its length is inferred below
+    if (bit_count + run_bits >= DSHOT_TELEMETRY_BITS) {
+      if (level == 0) return false;
+      break;
+    }
+
+    bits = (bits << run_bits) | (1UL << (run_bits - 1));
+    bit_count += run_bits;
+  }
+
+  if (bit_count == 0) return false;
+
+  int remaining_bits = DSHOT_TELEMETRY_BITS - bit_count;
+  bits = (bits << remaining_bits) | (1UL << (remaining_bits - 1));
+
+  *telemetry_bits = bits;
+  return true;
+}
+
+//drains RX buffers and keeps latest valid eRPM for each motor
+static void dshot_telemetry_task(void *parameter) {
+  while (true) {
+    for (int motor = 0; motor < DSHOT_MOTOR_COUNT; motor++) {
+      if (rx_buffers[motor] == NULL) continue;
+
+      size_t size = 0;
+      rmt_item32_t *items;
+      while ((items = (rmt_item32_t *)xRingbufferReceive(rx_buffers[motor], &size, 0)) != NULL) {
+        uint32_t telemetry_bits;
+        if (telemetry_bits_from_items(items, size / sizeof(rmt_item32_t), &telemetry_bits)) {
+          int32_t erpm = dshot_decode_erpm(telemetry_bits);
+          if (erpm == DSHOT_ERPM_INVALID) {
+            erpm_error_count++;
+          } else {
+            latest_erpm_sequence[motor]++;
+            latest_erpm_time_us[motor] = micros();
+            latest_erpm[motor] = erpm;
+            latest_erpm_time_ms[motor] = millis();
+            latest_erpm_sequence[motor]++;
+          }
+        }
+        vRingbufferReturnItem(rx_buffers[motor], (void *)items);
+      }
+    }
+    vTaskDelay(1);
+  }
+}
+
+//RX channel shares the motor pin - pin is switched to open drain so the ESC can pull it low to reply
+static esp_err_t init_dshot_rx(int motor, int pin) {
+  rmt_config_t config = RMT_DEFAULT_CONFIG_RX((gpio_num_t)pin, dshot_rx_channels[motor]);
+  config.clk_div = DSHOT_RMT_CLK_DIV;
+  config.rx_config.filter_en = true;
+  config.rx_config.filter_ticks_thresh = DSHOT_RX_FILTER_TICKS;
+  config.rx_config.idle_threshold = DSHOT_RX_IDLE_TICKS;
+
+  esp_err_t result = rmt_config(&config);
+  if (result == ESP_OK) result = rmt_driver_install(dshot_rx_channels[motor], DSHOT_RX_BUFFER_SIZE, 0);
+  if (result == ESP_OK) result = rmt_get_ringbuf_handle(dshot_rx_channels[motor], &rx_buffers[motor]);
+  if (result != ESP_OK) return result;
+
+  //RX config switches pin to input - route TX back out and enable both
+  rmt_set_gpio(dshot_channels[motor], RMT_MODE_TX, (gpio_num_t)pin, false);
+  gpio_set_direction((gpio_num_t)pin, GPIO_MODE_INPUT_OUTPUT_OD);
+  gpio_pullup_en((gpio_num_t)pin);
+
+  return rmt_rx_start(dshot_rx_channels[motor], true);
+}
+
+int32_t dshot_get_erpm(int motor_index) {
+  if (DSHOT_BIDIRECTIONAL == false) return DSHOT_ERPM_INVALID;
+
+  int32_t erpm = latest_erpm[motor_index];
+  if (millis() - latest_erpm_time_ms[motor_index] > DSHOT_ERPM_TIMEOUT_MS) return DSHOT_ERPM_INVALID;
+  return erpm;
+}
+
+bool dshot_get_erpm_sample(int motor_index, int32_t *erpm, unsigned long *time_us) {
+  if (DSHOT_BIDIRECTIONAL == false) return false;
+
+  //written by telemetry task on other core - re-read if a sample was written part way through
+  uint32_t sequence;
+  unsigned long sample_time_us;
+  do {
+    sequence = latest_erpm_sequence[motor_index];
+    sample_time_us = latest_erpm_time_us[motor_index];
+    *erpm = latest_erpm[motor_index];
+  } while ((sequence & 1) || sequence != latest_erpm_sequence[motor_index]);
+
+  if (*erpm == DSHOT_ERPM_INVALID) return false;
+  *time_us = sample_time_us;
+  return true;
+}
+
+uint32_t dshot_get_erpm_error_count() {
+  return erpm_error_count;
+}
+
+void init_dshot(int motor1_pin, int motor2_pin) {
+  const int pins[DSHOT_MOTOR_COUNT] = { motor1_pin, motor2_pin };
+
+  //only RMT user with a TX end callback (heading LED waits with rmt_write_items)
+  rmt_register_tx_end_callback(dshot_tx_end, NULL);
+
+  for (int motor = 0; motor < DSHOT_MOTOR_COUNT; motor++) {
+    rmt_config_t config = RMT_DEFAULT_CONFIG_TX((gpio_num_t)pins[motor], dshot_channels[motor]);
+    config.clk_div = DSHOT_RMT_CLK_DIV;
+    config.tx_config.idle_output_en = true;
+    config.tx_config.idle_level = DSHOT_BIDIRECTIONAL ? RMT_IDLE_LEVEL_HIGH : RMT_IDLE_LEVEL_LOW;
+    config.tx_config.loop_en = true;
+
+    esp_err_t result = rmt_config(&config);
+    if (result == ESP_OK) result = rmt_driver_install(dshot_channels[motor], 0, 0);
+    if (result != ESP_OK) {
+      LOG_ERROR(MOTOR, "DShot RMT init failed for motor %d: %s", motor + 1, esp_err_to_name(result));
+      continue;
+    }
+
+    if (DSHOT_BIDIRECTIONAL) {
+      result = init_dshot_rx(motor, pins[motor]);
+      if (result != ESP_OK) {
+        LOG_ERROR(MOTOR, "DShot telemetry init failed for motor %d: %s", motor + 1, esp_err_to_name(result));
+      }
+    }
+
+    fill_frame(dshot_channels[motor], dshot_make_packet(DSHOT_VALUE_STOP, false, DSHOT_BIDIRECTIONAL));
+    last_values[motor] = DSHOT_VALUE_STOP;
+    rmt_tx_start(dshot_channels[motor], true);
+  }
+
+  if (DSHOT_BIDIRECTIONAL) {
+    xTaskCreatePinnedToCore(dshot_telemetry_task, "DShotTelemetry", DSHOT_TELEMETRY_TASK_STACK_SIZE, NULL, 2, NULL, 0);
+    LOG_INFO(MOTOR, "Bidirectional DShot - eRPM telemetry enabled");
+  }
+
+  LOG_INFO(MOTOR, "DShot%d output started (%d us frame interval)", DSHOT_SPEED, DSHOT_FRAME_INTERVAL_US);
+}
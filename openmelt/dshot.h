@@ -0,0 +1,49 @@
+#ifndef DSHOT_H
+#define DSHOT_H
+
+#include <stdint.h>
+
+//DShot digital ESC protocol (DShot150 / 300 / 600) generated by RMT TX channels
+//Each frame is 16 bits: 11 bit throttle value, 1 telemetry request bit, 4 bit CRC
+//Frames are repeated continuously by the RMT peripheral (loop mode) - the CPU only touches it when the value changes
+//With DSHOT_BIDIRECTIONAL the signal is inverted and the ESC replies to each frame with its eRPM (read by RMT RX channels)
+
+#define DSHOT_MOTOR_COUNT 2
+
+#define DSHOT_VALUE_STOP 0                    //motor stop / disarmed
+#define DSHOT_VALUE_MIN 48                    //lowest throttle value (1-47 are ESC commands)
+#define DSHOT_VALUE_MAX 2047
+
+#define DSHOT_TELEMETRY_BITS 21               //bidirectional reply - start bit + 20 bit GCR word
+#define DSHOT_ERPM_INVALID -1
+
+//builds a 16 bit DShot packet (value, telemetry request bit, CRC - inverted when bidirectional so the ESC replies with eRPM)
+uint16_t dshot_make_packet(uint16_t value, bool telemetry_request, bool bidirectional);
+
+//converts a servo-style pulse width (1000-2000us, 1500 = neutral) to a DShot throttle value
+//in 3D mode: 48-1047 reverse, 1048-2047 forward, 0 = stop (bidirectional ESC - same behavior as servo mode)
+//otherwise: 48-2047 forward only, neutral and below = stop
+uint16_t dshot_value_from_pulse_width(int pulse_width, bool mode_3d);
+
+//configures RMT channels for both motors and starts sending DSHOT_VALUE_STOP
+void init_dshot(int motor1_pin, int motor2_pin);
+
+//sets value repeatedly sent to a motor (motor_index 0 or 1) - only touches RMT if value changed
+//never blocks - the new value is sent from the next frame boundary (whole frames only)
+void dshot_write(int motor_index, uint16_t value);
+
+//decodes a bidirectional DShot reply - telemetry_bits has a 1 for each bit period that starts with a signal transition
+//returns eRPM (0 if motor stopped) or DSHOT_ERPM_INVALID on GCR / CRC error
+int32_t dshot_decode_erpm(uint32_t telemetry_bits);
+
+//returns latest eRPM reported by a motor - DSHOT_ERPM_INVALID if bidirectional DShot disabled or no recent valid reply
+int32_t dshot_get_erpm(int motor_index);
+
+//latest valid eRPM reply and the time (micros) it was received - returns false if none received yet (or bidirectional DShot disabled)
+//time resolution is limited by the telemetry task polling interval (1 tick)
+bool dshot_get_erpm_sample(int motor_index, int32_t *erpm, unsigned long *time_us);
+
+//number of replies rejected by dshot_decode_erpm since startup (signal quality indication)
+uint32_t dshot_get_erpm_error_count();
+
+#endif // DSHOT_H
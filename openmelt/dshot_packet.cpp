@@ -0,0 +1,63 @@
+//DShot packet encoding and bidirectional telemetry decoding
+//no Arduino / ESP-IDF dependencies so it can be built and tested on a host (tests/test_dshot.cpp)
+
+#include "dshot.h"
+
+uint16_t dshot_make_packet(uint16_t value, bool telemetry_request, bool bidirectional) {
+  uint16_t packet = (uint16_t)((value & 0x7FF) << 1) | (telemetry_request ? 1 : 0);
+
+  //CRC is XOR of the three nibbles of value + telemetry bit
+  uint16_t crc = (packet ^ (packet >> 4) ^ (packet >> 8)) & 0x0F;
+
+  //inverted CRC tells the ESC to reply with eRPM
+  if (bidirectional) crc = ~crc & 0x0F;
+
+  return (packet << 4) | crc;
+}
+
+uint16_t dshot_value_from_pulse_width(int pulse_width, bool mode_3d) {
+  int offset = pulse_width - 1500;
+  if (offset > 500) offset = 500;
+  if (offset < -500) offset = -500;
+
+  if (mode_3d) {
+    if (offset > 0) return 1048 + ((offset * 999) / 500);
+    if (offset < 0) return DSHOT_VALUE_MIN + ((-offset * 999) / 500);
+    return DSHOT_VALUE_STOP;
+  }
+
+  if (offset <= 0) return DSHOT_VALUE_STOP;
+  return DSHOT_VALUE_MIN + ((offset * (DSHOT_VALUE_MAX - DSHOT_VALUE_MIN)) / 500);
+}
+
+//maps 5 bit GCR symbols back to 4 bit nibbles (0xFF = invalid symbol)
+static const uint8_t gcr_decode_table[32] = {
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0x09, 0x0A, 0x0B, 0xFF, 0x0D, 0x0E, 0x0F,
+  0xFF, 0xFF, 0x02, 0x03, 0xFF, 0x05, 0x06, 0x07,
+  0xFF, 0x00, 0x08, 0x01, 0xFF, 0x04, 0x0C, 0xFF
+};
+
+int32_t dshot_decode_erpm(uint32_t telemetry_bits) {
+  //20 bit GCR word -> 16 bit value (12 bit period + 4 bit CRC)
+  uint32_t value = 0;
+  for (int nibble = 0; nibble < 4; nibble++) {
+    uint8_t decoded = gcr_decode_table[(telemetry_bits >> (nibble * 5)) & 0x1F];
+    if (decoded == 0xFF) return DSHOT_ERPM_INVALID;
+    value |= (uint32_t)decoded << (nibble * 4);
+  }
+
+  //XOR of all four nibbles (including CRC) must be 0xF
+  uint32_t crc = value ^ (value >> 8);
+  crc = crc ^ (crc >> 4);
+  if ((crc & 0x0F) != 0x0F) return DSHOT_ERPM_INVALID;
+
+  //remaining 12 bits are eRPM period in us - 3 bit shift + 9 bit mantissa
+  value = value >> 4;
+  if (value == 0x0FFF) return 0;   //motor stopped
+
+  uint32_t period_us = (value & 0x1FF) << (value >> 9);
+  if (period_us == 0) return DSHOT_ERPM_INVALID;
+
+  return (60000000UL + (period_us / 2)) / period_us;
+}
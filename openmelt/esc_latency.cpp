@@ -0,0 +1,89 @@
+//this module tracks ESC response latency for each motor
+//a measurement is the time from a motor switching from coast to on until its eRPM starts rising (bidirectional DShot only)
+//includes ESC processing / ramping and the telemetry reply delay - the same delay the rotation timing needs to lead by
+
+#include <Arduino.h>
+#include "melty_config.h"
+#include "esc_latency.h"
+#include "dshot.h"
+#include "debug_handler.h"
+
+#define ESC_LATENCY_FILTER_WEIGHT 0.1f     //weight of each new measurement in running average
+
+static const unsigned long configured_latency_us[ESC_LATENCY_MOTOR_COUNT] = {
+  MOTOR_1_ESC_LATENCY_US,
+  MOTOR_2_ESC_LATENCY_US
+};
+
+typedef struct esc_latency_state_t {
+  bool powered;                  //state at last esc_latency_track call
+  bool measuring;                //waiting for eRPM to rise after a power step
+  unsigned long step_time_us;    //time motor switched to on
+  int32_t step_erpm;             //eRPM when motor switched to on
+  float measured_us;             //running average of measurements
+  unsigned int samples;          //measurements taken
+} esc_latency_state_t;
+
+static esc_latency_state_t latency_states[ESC_LATENCY_MOTOR_COUNT] = {};
+
+bool esc_latency_is_measured(int motor_index) {
+  return ESC_LATENCY_AUTO_MEASURE && latency_states[motor_index].samples >= ESC_LATENCY_MIN_SAMPLES;
+}
+
+unsigned long esc_latency_get_us(int motor_index) {
+  if (esc_latency_is_measured(motor_index)) return latency_states[motor_index].measured_us;
+  return configured_latency_us[motor_index];
+}
+
+static void add_measurement(esc_latency_state_t *state, int motor_index, unsigned long latency_us) {
+  if (state->samples == 0) {
+    state->measured_us = latency_us;
+  } else {
+    state->measured_us += (latency_us - state->measured_us) * ESC_LATENCY_FILTER_WEIGHT;
+  }
+  state->samples++;
+
+  if (state->samples == ESC_LATENCY_MIN_SAMPLES) {
+    LOG_INFO(MOTOR, "Motor %d ESC latency measured: %lu us (configured %lu us)",
+                 motor_index + 1, (unsigned long)state->measured_us, configured_latency_us[motor_index]);
+  }
+}
+
+void esc_latency_track(int motor_index, bool powered) {
+  if (!ESC_LATENCY_AUTO_MEASURE || THROTTLE_TYPE != DSHOT_THROTTLE || !DSHOT_BIDIRECTIONAL) return;
+
+  esc_latency_state_t *state = &latency_states[motor_index];
+  bool power_step = powered && !state->powered;
+  state->powered = powered;
+
+  int32_t erpm;
+  unsigned long erpm_time_us;
+  if (!dshot_get_erpm_sample(motor_index, &erpm, &erpm_time_us)) {
+    state->measuring = false;
+    return;
+  }
+
+  //start of powered window - compare later replies against current eRPM
+  if (power_step) {
+    state->measuring = true;
+    state->step_time_us = micros();
+    state->step_erpm = erpm;
+    return;
+  }
+
+  if (!state->measuring) return;
+
+  //motor didn't respond in time (or window ended first) - discard
+  if (micros() - state->step_time_us > ESC_LATENCY_MAX_US || !powered) {
+    state->measuring = false;
+    return;
+  }
+
+  //only replies received after the step count
+  if ((long)(erpm_time_us - state->step_time_us) <= 0) return;
+
+  if (erpm > state->step_erpm + (state->step_erpm * (ESC_LATENCY_ERPM_RISE_PERCENT / 100.0f))) {
+    add_measurement(state, motor_index, erpm_time_us - state->step_time_us);
+    state->measuring = false;
+  }
+}
@@ -0,0 +1,20 @@
+#ifndef ESC_LATENCY_H
+#define ESC_LATENCY_H
+
+//ESC response latency (time from a new command to the motor reacting) for each motor
+//spin_control starts each motor's on / coast window this much earlier so power lands where motor_start_phase_X intends
+//latency is MOTOR_X_ESC_LATENCY_US - or measured from bidirectional DShot eRPM if ESC_LATENCY_AUTO_MEASURE is enabled
+
+#define ESC_LATENCY_MOTOR_COUNT 2
+
+//returns latency (us) used to shift a motor's window (motor_index 0 or 1)
+unsigned long esc_latency_get_us(int motor_index);
+
+//returns true once enough responses were measured for a motor that the measured latency is used
+bool esc_latency_is_measured(int motor_index);
+
+//call each time a motor's state is set while translating (powered = in on window) - a coast to on change starts a measurement
+//completes pending measurements from latest eRPM (only does anything with ESC_LATENCY_AUTO_MEASURE)
+void esc_latency_track(int motor_index, bool powered);
+
+#endif // ESC_LATENCY_H
@@ -0,0 +1,287 @@
+//this module is the flight recorder - rotation records (queued by the control loop) and accelerometer samples are packed
+//into blocks by a task on core 0 and written to a ring of blocks in the "flightlog" flash partition
+//flash erase / write stalls both cores (cache is disabled) - so blocks are only written while the robot is idle
+//(until then they wait in RAM - the oldest waiting block is discarded if RAM fills up)
+
+#include <Arduino.h>
+#include "melty_config.h"
+#include "flight_log.h"
+#include "accel_handler.h"
+#include "debug_handler.h"
+#include "telemetry_registry.h"
+#include <esp_partition.h>
+#include <atomic>
+
+#define FLIGHT_LOG_PARTITION_LABEL "flightlog"
+#define FLIGHT_LOG_TASK_STACK_SIZE 4096
+#define FLIGHT_LOG_TASK_INTERVAL_MS 20
+#define FLIGHT_LOG_QUEUE_SIZE 64                //rotation records waiting for log task (power of 2)
+#define FLIGHT_LOG_IDLE_PASS_MS 100             //robot is idle while flight_log_idle was called this recently
+#define FLIGHT_LOG_ACCEL_BATCH 16               //accel samples copied at a time
+#define FLIGHT_LOG_RECORD_SPACE (FLIGHT_LOG_BLOCK_SIZE - sizeof(flight_log_block_header_t))
+
+static_assert(sizeof(flight_log_block_header_t) == 24 && sizeof(flight_log_rotation_t) == 24 && sizeof(flight_log_accel_t) == 12,
+              "flight log layout changed - update tools/flight_log.py");
+static_assert((FLIGHT_LOG_QUEUE_SIZE & (FLIGHT_LOG_QUEUE_SIZE - 1)) == 0, "FLIGHT_LOG_QUEUE_SIZE must be a power of 2");
+static_assert(FLIGHT_LOG_RAM_BLOCKS >= 2 && FLIGHT_LOG_PSRAM_BLOCKS >= 2, "flight log needs at least 2 RAM blocks");
+
+static const esp_partition_t *partition = NULL;
+static const uint8_t *mapped_log = NULL;        //partition mapped through flash cache (reading doesn't stall the other core)
+static int flash_block_count = 0;
+static volatile int next_flash_block = 0;       //written next - oldest block once the ring has wrapped
+static uint32_t next_sequence = 0;
+static uint32_t session = 0;
+static bool log_running = false;
+
+//flushes are held off while a download reads the flash blocks (erase / write would tear the block being copied)
+//each side sets its own flag before checking the other's - so a flush and a download never overlap
+static std::atomic<bool> download_active(false);
+static std::atomic<bool> flush_active(false);
+
+//rotation records from control loop - one writer (control loop) / one reader (log task)
+static flight_log_rotation_t rotation_queue[FLIGHT_LOG_QUEUE_SIZE];
+static std::atomic<uint32_t> queue_write_position(0);
+static std::atomic<uint32_t> queue_read_position(0);
+static std::atomic<uint32_t> queue_dropped(0);
+
+static volatile unsigned long last_idle_ms = 0;
+static volatile unsigned long last_active_ms = 0;
+
+//RAM blocks - only touched by log task
+//ring of ram_block_count blocks - ram_waiting full blocks starting at ram_first, followed by the block being filled
+static uint8_t *ram_blocks = NULL;
+static int ram_block_count = 0;
+static int ram_first = 0;
+static volatile int ram_waiting = 0;
+static size_t current_used = 0;
+static uint32_t dropped_records = 0;            //since the current block was started
+static unsigned long flushed_active_ms = 0;     //last_active_ms when a part filled block was last written
+static volatile unsigned long lost_blocks = 0;
+
+static uint8_t *current_block() {
+  return ram_blocks + ((ram_first + ram_waiting) % ram_block_count) * FLIGHT_LOG_BLOCK_SIZE;
+}
+
+static void start_block() {
+  flight_log_block_header_t *header = (flight_log_block_header_t *)current_block();
+  header->magic = FLIGHT_LOG_MAGIC;
+  header->sequence = 0;                         //set when written to flash
+  header->session = session;
+  header->used = 0;
+  header->dropped = (dropped_records > 0xFFFF) ? 0xFFFF : dropped_records;
+  header->version = FLIGHT_LOG_VERSION;
+  header->reserved = 0;
+  header->reserved2 = 0;
+  header->g_per_count = accel_counts_to_g(1);
+  dropped_records = 0;
+  current_used = 0;
+}
+
+//moves the block being filled to the waiting blocks
+static void close_block() {
+  ((flight_log_block_header_t *)current_block())->used = current_used;
+
+  //no free block to fill next - discard the oldest waiting one
+  if (ram_waiting == ram_block_count - 1) {
+    ram_first = (ram_first + 1) % ram_block_count;
+    ram_waiting--;
+    lost_blocks++;
+  }
+  ram_waiting++;
+  start_block();
+}
+
+//records never span blocks (each block decodes on its own)
+static void append_record(const void *record, size_t size) {
+  if (current_used + size > FLIGHT_LOG_RECORD_SPACE) close_block();
+  memcpy(current_block() + sizeof(flight_log_block_header_t) + current_used, record, size);
+  current_used += size;
+}
+
+static bool robot_idle() {
+  unsigned long now = millis();
+  return (now - last_idle_ms < FLIGHT_LOG_IDLE_PASS_MS) && (now - last_active_ms >= FLIGHT_LOG_FLUSH_IDLE_MS);
+}
+
+//writes oldest waiting block to next flash block (stalls both cores for the erase / write)
+static void write_oldest_block() {
+  uint8_t *block = ram_blocks + ram_first * FLIGHT_LOG_BLOCK_SIZE;
+  flight_log_block_header_t *header = (flight_log_block_header_t *)block;
+  header->sequence = next_sequence;
+
+  size_t offset = next_flash_block * FLIGHT_LOG_BLOCK_SIZE;
+  esp_err_t result = esp_partition_erase_range(partition, offset, FLIGHT_LOG_BLOCK_SIZE);
+  if (result == ESP_OK) result = esp_partition_write(partition, offset, block, sizeof(flight_log_block_header_t) + header->used);
+  if (result != ESP_OK) {
+    LOG_ERROR(FLIGHTLOG, "Flight log write failed at block %d: %s", next_flash_block, esp_err_to_name(result));
+  }
+
+  next_sequence++;
+  next_flash_block = (next_flash_block + 1) % flash_block_count;
+  ram_first = (ram_first + 1) % ram_block_count;
+  ram_waiting--;
+}
+
+static void flight_log_task(void *parameter) {
+  accel_sample_t samples[FLIGHT_LOG_ACCEL_BATCH];
+  uint32_t next_accel_sample = 0;
+  bool first_accel_read = true;
+
+  start_block();
+
+  while (true) {
+    //rotation records
+    uint32_t read_position = queue_read_position.load(std::memory_order_relaxed);
+    while (read_position != queue_write_position.load(std::memory_order_acquire)) {
+      append_record(&rotation_queue[read_position & (FLIGHT_LOG_QUEUE_SIZE - 1)], sizeof(flight_log_rotation_t));
+      read_position++;
+      queue_read_position.store(read_position, std::memory_order_release);
+    }
+    dropped_records += queue_dropped.exchange(0, std::memory_order_relaxed);
+
+    //every accelerometer sample since last pass (samples from before boot of this task aren't counted as dropped)
+    int count;
+    do {
+      uint32_t wanted_sample = next_accel_sample;
+      count = accel_read_samples(samples, FLIGHT_LOG_ACCEL_BATCH, &next_accel_sample);
+      if (!first_accel_read) dropped_records += next_accel_sample - wanted_sample - count;
+      first_accel_read = false;
+
+      for (int i = 0; i < count; i++) {
+        flight_log_accel_t record;
+        record.type = FLIGHT_LOG_RECORD_ACCEL;
+        record.reserved = 0;
+        record.x = samples[i].x;
+        record.y = samples[i].y;
+        record.z = samples[i].z;
+        record.time_us = samples[i].time_us;
+        append_record(&record, sizeof(record));
+      }
+    } while (count == FLIGHT_LOG_ACCEL_BATCH);
+
+    if (robot_idle()) {
+      //robot has stopped since last write - write the part filled block too (so everything up to now is kept)
+      unsigned long active_ms = last_active_ms;
+      if (active_ms != flushed_active_ms && current_used > 0) {
+        close_block();
+        flushed_active_ms = active_ms;
+      }
+
+      //checked before each block (robot may start up / a download may begin mid flush)
+      while (ram_waiting > 0 && robot_idle()) {
+        flush_active.store(true);
+        bool write = !download_active.load();
+        if (write) write_oldest_block();
+        flush_active.store(false);
+        if (!write) break;
+      }
+    }
+
+    vTaskDelay(pdMS_TO_TICKS(FLIGHT_LOG_TASK_INTERVAL_MS));
+  }
+}
+
+//finds newest block in flash - writing continues after it
+static void find_next_flash_block() {
+  bool found = false;
+  uint32_t newest_sequence = 0;
+  int newest_block = 0;
+  for (int i = 0; i < flash_block_count; i++) {
+    const flight_log_block_header_t *header = (const flight_log_block_header_t *)(mapped_log + i * FLIGHT_LOG_BLOCK_SIZE);
+    if (header->magic != FLIGHT_LOG_MAGIC) continue;
+    if (!found || (int32_t)(header->sequence - newest_sequence) > 0) {
+      newest_sequence = header->sequence;
+      newest_block = i;
+      found = true;
+    }
+  }
+  next_flash_block = found ? (newest_block + 1) % flash_block_count : 0;
+  next_sequence = found ? newest_sequence + 1 : 0;
+}
+
+void init_flight_log() {
+  partition = esp_partition_find_first(ESP_PARTITION_TYPE_DATA, ESP_PARTITION_SUBTYPE_ANY, FLIGHT_LOG_PARTITION_LABEL);
+  if (partition == NULL) {
+    LOG_WARNING(FLIGHTLOG, "No \"%s\" partition - flight log disabled (see partitions.csv)", FLIGHT_LOG_PARTITION_LABEL);
+    return;
+  }
+
+  spi_flash_mmap_handle_t mmap_handle;
+  const void *mapped = NULL;
+  esp_err_t result = esp_partition_mmap(partition, 0, partition->size, SPI_FLASH_MMAP_DATA, &mapped, &mmap_handle);
+  if (result != ESP_OK) {
+    LOG_ERROR(FLIGHTLOG, "Flight log partition map failed: %s", esp_err_to_name(result));
+    return;
+  }
+  mapped_log = (const uint8_t *)mapped;
+  flash_block_count = partition->size / FLIGHT_LOG_BLOCK_SIZE;
+
+  //PSRAM holds a whole match - internal RAM only the last few seconds of spinning
+  if (psramFound()) {
+    ram_block_count = FLIGHT_LOG_PSRAM_BLOCKS;
+    ram_blocks = (uint8_t *)ps_malloc(ram_block_count * FLIGHT_LOG_BLOCK_SIZE);
+  } else {
+    ram_block_count = FLIGHT_LOG_RAM_BLOCKS;
+    ram_blocks = (uint8_t *)malloc(ram_block_count * FLIGHT_LOG_BLOCK_SIZE);
+  }
+  if (ram_blocks == NULL) {
+    LOG_ERROR(FLIGHTLOG, "No memory for %d flight log blocks - flight log disabled", ram_block_count);
+    return;
+  }
+
+  find_next_flash_block();
+  session = esp_random();
+
+  telemetry_register_int_ptr("flightLogWaiting", "blocks", &ram_waiting);
+  telemetry_register_ulong_ptr("flightLogLost", "blocks", &lost_blocks);
+
+  xTaskCreatePinnedToCore(flight_log_task, "flight_log", FLIGHT_LOG_TASK_STACK_SIZE, NULL, 1, NULL, 0);
+  log_running = true;
+
+  LOG_INFO(FLIGHTLOG, "Flight log: %d flash blocks (next %d), %d %s blocks", flash_block_count, (int)next_flash_block,
+           ram_block_count, psramFound() ? "PSRAM" : "RAM");
+}
+
+void flight_log_rotation(flight_log_rotation_t *record) {
+  last_active_ms = millis();
+  if (!log_running) return;
+
+  uint32_t write_position = queue_write_position.load(std::memory_order_relaxed);
+  if (write_position - queue_read_position.load(std::memory_order_acquire) >= FLIGHT_LOG_QUEUE_SIZE) {
+    queue_dropped.fetch_add(1, std::memory_order_relaxed);
+    return;
+  }
+  record->type = FLIGHT_LOG_RECORD_ROTATION;
+  rotation_queue[write_position & (FLIGHT_LOG_QUEUE_SIZE - 1)] = *record;
+  queue_write_position.store(write_position + 1, std::memory_order_release);
+}
+
+void flight_log_idle() {
+  last_idle_ms = millis();
+}
+
+int flight_log_block_count() {
+  return (mapped_log != NULL) ? flash_block_count : 0;
+}
+
+void flight_log_download_begin() {
+  download_active.store(true);
+  while (flush_active.load()) delay(1);
+}
+
+void flight_log_download_end() {
+  download_active.store(false);
+}
+
+int flight_log_oldest_block() {
+  return next_flash_block;
+}
+
+bool flight_log_read_block(int oldest_block, int index, uint8_t *buffer) {
+  if (mapped_log == NULL || index < 0 || index >= flash_block_count) return false;
+  int block = (oldest_block + index) % flash_block_count;
+  memcpy(buffer, mapped_log + block * FLIGHT_LOG_BLOCK_SIZE, FLIGHT_LOG_BLOCK_SIZE);
+
+  const flight_log_block_header_t *header = (const flight_log_block_header_t *)buffer;
+  return header->magic == FLIGHT_LOG_MAGIC && header->used <= FLIGHT_LOG_RECORD_SPACE;
+}
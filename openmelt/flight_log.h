@@ -0,0 +1,87 @@
+#ifndef FLIGHT_LOG_H
+#define FLIGHT_LOG_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+//flight recorder - per-rotation records and every accelerometer sample are packed into FLIGHT_LOG_BLOCK_SIZE blocks by a
+//task on core 0 and kept as a ring in the "flightlog" flash partition (see partitions.csv)
+//erasing / writing flash stalls both cores - so full blocks wait in RAM (PSRAM if fitted) while the robot is spinning / driving
+//and are written once it has been idle for FLIGHT_LOG_FLUSH_IDLE_MS
+//downloaded as raw blocks from /flightlog - tools/flight_log.py converts to CSV
+
+#define FLIGHT_LOG_BLOCK_SIZE 4096              //one flash sector (erase unit)
+#define FLIGHT_LOG_MAGIC 0x31474C46             //"FLG1"
+#define FLIGHT_LOG_VERSION 1
+
+#define FLIGHT_LOG_RECORD_ROTATION 1
+#define FLIGHT_LOG_RECORD_ACCEL 2
+
+#define FLIGHT_LOG_FLAG_CONFIG_MODE 0x01
+#define FLIGHT_LOG_FLAG_SPIN_UP 0x02           //below MIN_TRANSLATION_RPM (not translating)
+#define FLIGHT_LOG_FLAG_WHEEL_SLIP 0x04
+
+//all structures little-endian / packed (keep tools/flight_log.py in sync)
+typedef struct __attribute__((packed)) flight_log_block_header_t {
+  uint32_t magic;                   //FLIGHT_LOG_MAGIC (erased / unused blocks are skipped)
+  uint32_t sequence;                //increments every block written (oldest block has the lowest)
+  uint32_t session;                 //random - changes every boot
+  uint16_t used;                    //bytes of records after header
+  uint16_t dropped;                 //records lost before this block (rotation queue full / accel samples overwritten)
+                                    //whole blocks discarded while RAM was full are only counted in flightLogLost telemetry
+  uint8_t version;                  //FLIGHT_LOG_VERSION
+  uint8_t reserved;
+  uint16_t reserved2;
+  float g_per_count;                //accelerometer scale for accel records
+} flight_log_block_header_t;
+
+typedef struct __attribute__((packed)) flight_log_rotation_t {
+  uint8_t type;                     //FLIGHT_LOG_RECORD_ROTATION
+  uint8_t flags;                    //FLIGHT_LOG_FLAG_*
+  uint16_t rpm;
+  uint32_t time_us;                 //micros() at start of rotation
+  uint32_t rotation_interval_us;
+  uint16_t throttle_permille;
+  int16_t steering_permille;
+  int8_t translate_forback;         //RC_FORBACK_*
+  uint8_t reserved;
+  uint16_t motor_pulse_width[2];
+  uint16_t battery_mv;
+} flight_log_rotation_t;
+
+typedef struct __attribute__((packed)) flight_log_accel_t {
+  uint8_t type;                     //FLIGHT_LOG_RECORD_ACCEL
+  uint8_t reserved;
+  int16_t x;                        //raw counts (multiply by g_per_count)
+  int16_t y;
+  int16_t z;
+  uint32_t time_us;                 //micros() when read
+} flight_log_accel_t;
+
+//finds partition / allocates block buffers / starts log task (core 0) - call after init_accel
+void init_flight_log();
+
+//queues a rotation record (fills in type) - control loop only, never blocks (record is dropped if the queue is full)
+void flight_log_rotation(flight_log_rotation_t *record);
+
+//called from the control loop every pass while the robot is idle (motors off) - blocks are only written to flash then
+void flight_log_idle();
+
+//number of blocks in the flash partition (0 if there is no partition)
+int flight_log_block_count();
+
+//brackets a download - no blocks are written to flash in between (waiting blocks stay in RAM)
+//begin waits for a block write already in progress - call from core 0 tasks only (web server)
+void flight_log_download_begin();
+void flight_log_download_end();
+
+//flash block holding the oldest log - read once per download and pass to flight_log_read_block
+//(the log task moves it on as blocks are written - rereading it part way through would repeat / skip blocks)
+int flight_log_oldest_block();
+
+//copies block index (0 = oldest_block) into buffer (FLIGHT_LOG_BLOCK_SIZE bytes) - returns false if that block holds no log
+//only between flight_log_download_begin / end (otherwise the block may be erased part way through the copy)
+//reads through the flash cache (doesn't stall the control loop)
+bool flight_log_read_block(int oldest_block, int index, uint8_t *buffer);
+
+#endif // FLIGHT_LOG_H
@@ -0,0 +1,92 @@
+//this module records input-to-output latency distributions for each output stage
+//recording is called from the control loop (cheap - one histogram increment per new frame)
+//statistics are computed on demand by the web / diagnostics side
+
+#include "latency_tracer.h"
+#include <string.h>
+#include <atomic>
+
+struct latency_histogram_t {
+  uint32_t last_frame_timestamp_us;           //frame most recently recorded (used to ignore repeats)
+  uint32_t count;
+  uint32_t max_us;
+  uint32_t bins[LATENCY_BINS];
+};
+
+static struct latency_histogram_t histograms[LATENCY_STAGE_COUNT];
+
+//resets are requested from the web side but done by the recorder (control loop) - clearing while it increments
+//could leave stale counts behind
+static std::atomic<uint32_t> resets_requested(0);
+static std::atomic<uint32_t> resets_done(0);
+
+static const char *stage_names[LATENCY_STAGE_COUNT] = {
+  "params",
+  "motor",
+  "led"
+};
+
+void latency_record(latency_stage_enum stage, uint32_t frame_timestamp_us, uint32_t now_us) {
+  struct latency_histogram_t *histogram = &histograms[stage];
+
+  uint32_t requested = resets_requested.load(std::memory_order_relaxed);
+  if (requested != resets_done.load(std::memory_order_relaxed)) {
+    memset(histograms, 0, sizeof(histograms));
+    resets_done.store(requested, std::memory_order_release);
+  }
+
+  //0 means no frame has been captured yet
+  if (frame_timestamp_us == 0 || frame_timestamp_us == histogram->last_frame_timestamp_us) return;
+  histogram->last_frame_timestamp_us = frame_timestamp_us;
+
+  //unsigned subtraction handles micros() wrap
+  uint32_t latency_us = now_us - frame_timestamp_us;
+
+  uint32_t bin = latency_us / LATENCY_BIN_US;
+  if (bin >= LATENCY_BINS) bin = LATENCY_BINS - 1;
+
+  histogram->bins[bin]++;
+  histogram->count++;
+  if (latency_us > histogram->max_us) histogram->max_us = latency_us;
+}
+
+//returns upper edge of the bin containing the requested fraction of samples
+static uint32_t percentile_us(const struct latency_histogram_t *histogram, uint32_t count, uint32_t permille) {
+  uint32_t target = (uint32_t)(((uint64_t)count * permille + 999) / 1000);
+  uint32_t cumulative = 0;
+  for (int bin = 0; bin < LATENCY_BINS; bin++) {
+    cumulative += histogram->bins[bin];
+    if (cumulative >= target) return (bin + 1) * LATENCY_BIN_US;
+  }
+  return LATENCY_BINS * LATENCY_BIN_US;
+}
+
+latency_stats_t latency_get_stats(latency_stage_enum stage) {
+  latency_stats_t stats = {};
+  const struct latency_histogram_t *histogram = &histograms[stage];
+
+  //reset not picked up by the control loop yet
+  if (resets_done.load(std::memory_order_acquire) != resets_requested.load(std::memory_order_relaxed)) return stats;
+
+  //count is sampled once - control loop may keep recording while we scan
+  stats.count = histogram->count;
+  stats.max_us = histogram->max_us;
+  if (stats.count == 0) return stats;
+
+  stats.p50_us = percentile_us(histogram, stats.count, 500);
+  stats.p99_us = percentile_us(histogram, stats.count, 990);
+
+  //bin edges can overshoot the exact maximum
+  if (stats.p50_us > stats.max_us) stats.p50_us = stats.max_us;
+  if (stats.p99_us > stats.max_us) stats.p99_us = stats.max_us;
+  return stats;
+}
+
+const char *latency_stage_name(latency_stage_enum stage) {
+  return stage_names[stage];
+}
+
+//histograms are cleared by the next latency_record call (stats read as empty until then)
+void latency_reset() {
+  resets_requested.fetch_add(1, std::memory_order_relaxed);
+}
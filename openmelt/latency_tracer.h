@@ -0,0 +1,39 @@
+#ifndef LATENCY_TRACER_H
+#define LATENCY_TRACER_H
+
+#include <stdint.h>
+
+//Tracks latency from an RC frame arriving (throttle pulse end captured in ISR) to each output stage acting on it
+//Each stage records a frame once (the first time it acts on a new frame) into a fixed histogram
+//No Arduino dependencies - timestamps are passed in - so it can be built / fed on a host
+
+#define LATENCY_BIN_US 100                    //histogram resolution
+#define LATENCY_BINS 256                      //last bin also collects anything longer (256 * 100us = 25.6ms)
+
+typedef enum {
+  LATENCY_STAGE_PARAMS = 0,                   //melty parameters computed from the frame
+  LATENCY_STAGE_MOTOR,                        //first motor output written with those parameters
+  LATENCY_STAGE_LED,                          //first heading LED update with those parameters
+  LATENCY_STAGE_COUNT
+} latency_stage_enum;
+
+typedef struct latency_stats_t {
+  uint32_t count;                             //frames recorded
+  uint32_t p50_us;                            //median (upper edge of histogram bin)
+  uint32_t p99_us;                            //99th percentile (upper edge of histogram bin)
+  uint32_t max_us;                            //worst case (exact)
+} latency_stats_t;
+
+//records latency for a stage - frame_timestamp_us identifies the frame (repeat calls for the same frame are ignored)
+void latency_record(latency_stage_enum stage, uint32_t frame_timestamp_us, uint32_t now_us);
+
+//computes distribution for a stage (not for use in the control loop)
+latency_stats_t latency_get_stats(latency_stage_enum stage);
+
+//returns printable name of a stage
+const char *latency_stage_name(latency_stage_enum stage);
+
+//clears all recorded latencies - safe while the control loop is recording (it does the clearing on its next record)
+void latency_reset();
+
+#endif // LATENCY_TRACER_H
@@ -1,112 +1,270 @@
 #include "Arduino.h"
 #include "melty_config.h"
 #include "spin_control.h"  // Add this to access get_config_mode()
+#include "debug_handler.h"
 
-#if USE_RGB_LED
-#include <FastLED.h>
-
-CRGB leds[NUM_RGB_LEDS];
-
-// External function declaration instead of including the whole header
-extern bool get_config_mode(void);
-
-// Define RGB color values
-CRGB getColorValue(led_color_t color) {
-  // Check if in config mode - override with config color
-  // But use direct color mapping to avoid potential recursion
-  if (get_config_mode() && color != CONFIG) {
-    // Return config color directly instead of recursive call
-    switch(CONFIG_LED_COLOR) {
-      case RED: return CRGB::Red;
-      case BLUE: return CRGB::Blue;
-      case YELLOW: return CRGB::Yellow;
-      case GREEN: return CRGB::Green;
-      case PURPLE: return CRGB::Purple;
-      case MAGENTA: return CRGB::Magenta;
-      case ORANGE: return CRGB::Orange;
-      case CONFIG: return CRGB::Cyan;
-      default: return CRGB::Cyan; // Default config indicator is cyan
-    }
-  }
-
+// Define RGB color values (0xRRGGBB)
+uint32_t getColorValue(led_color_t color) {
   switch(color) {
     case RED:
-      return CRGB::Red;
+      return 0xFF0000;
     case BLUE:
-      return CRGB::Blue;
+      return 0x0000FF;
     case YELLOW:
-      return CRGB::Yellow;
+      return 0xFFFF00;
     case GREEN:
-      return CRGB::Green;
+      return 0x008000;
     case PURPLE:
-      return CRGB::Purple;
+      return 0x800080;
     case MAGENTA:
-      return CRGB::Magenta;
+      return 0xFF00FF;
     case ORANGE:
-      return CRGB::Orange;
+      return 0xFFA500;
     case CONFIG:
-      return CRGB::Cyan;  // Using Cyan as the config color for high visibility
+      return 0x00FFFF;  // Using Cyan as the config color for high visibility
     default:
-      return CRGB::Green;
+      return 0x008000;
+  }
+}
+
+#if USE_RGB_LED
+#include "driver/rmt.h"
+
+//WS2812 LEDs are driven directly by an RMT channel
+//frames for each LED state are built once at startup - heading_led_on / off only record which frame is wanted
+//a task on core 0 sends the frame when the state changes (rotation loop never waits on an LED transfer)
+//shimmer is timed by that task too - the rotation loop requests it once and the task blanks the LEDs every other half period
+
+#define LED_RMT_CLK_DIV 2                 //40MHz - 25ns per tick
+#define LED_T0H_TICKS 16                  //0.40us
+#define LED_T0L_TICKS 34                  //0.85us
+#define LED_T1H_TICKS 32                  //0.80us
+#define LED_T1L_TICKS 18                  //0.45us
+#define LED_RESET_TICKS 12000             //300us low after each frame - latches data (WS2812B-V5 needs 280us)
+
+#define LED_BITS_PER_LED 24
+#define LED_FRAME_ITEMS (NUM_RGB_LEDS * LED_BITS_PER_LED)
+
+enum led_frame_t {
+  LED_FRAME_OFF = 0,
+  LED_FRAME_ON,
+  LED_FRAME_ON_CONFIG,    //config mode color
+  LED_FRAME_COUNT,
+  LED_FRAME_NONE = 0x3FFFFFFF
+};
+
+//requests with this bit set are a column (remaining bits = LED on mask) - encoded by LED task
+#define LED_FRAME_COLUMN_FLAG 0x80000000UL
+//requests with this bit set shimmer - shown for half of each shimmer period, off for the other half
+#define LED_FRAME_SHIMMER 0x40000000UL
+
+#define LED_SHIMMER_HALF_PERIOD_TICKS ((500 / HEADING_LED_RGB_SHIMMER_HZ) / portTICK_PERIOD_MS > 0 ? \
+                                       (500 / HEADING_LED_RGB_SHIMMER_HZ) / portTICK_PERIOD_MS : 1)
+
+static_assert(NUM_RGB_LEDS <= 30, "LED column masks hold at most 30 LEDs");
+
+static rmt_item32_t led_frames[LED_FRAME_COUNT][LED_FRAME_ITEMS];
+static rmt_item32_t column_frame[LED_FRAME_ITEMS];
+
+static TaskHandle_t led_task_handle = NULL;
+static volatile uint32_t requested_frame = LED_FRAME_NONE;    //frame to show (prebuilt frame or column)
+static volatile uint32_t column_color = 0;
+
+//fills a frame with LEDs in led_mask set to a color - others off (WS2812 takes green, red, blue - MSB first)
+static void build_led_frame(rmt_item32_t *items, uint32_t rgb, uint32_t led_mask = 0xFFFFFFFF) {
+  uint32_t color_grb = ((rgb & 0x00FF00) << 8) | ((rgb & 0xFF0000) >> 8) | (rgb & 0x0000FF);
+
+  for (int led = 0; led < NUM_RGB_LEDS; led++) {
+    uint32_t grb = (led_mask & (1UL << led)) ? color_grb : 0;
+    for (int bit = 0; bit < LED_BITS_PER_LED; bit++) {
+      rmt_item32_t *item = &items[(led * LED_BITS_PER_LED) + bit];
+      bool one = grb & (1UL << (LED_BITS_PER_LED - 1 - bit));
+      item->level0 = 1;
+      item->duration0 = one ? LED_T1H_TICKS : LED_T0H_TICKS;
+      item->level1 = 0;
+      item->duration1 = one ? LED_T1L_TICKS : LED_T0L_TICKS;
+    }
+  }
+
+  //stretch final low period into the reset time - a finished transfer means the LEDs have latched
+  items[LED_FRAME_ITEMS - 1].duration1 = LED_RESET_TICKS;
+}
+
+static void send_frame(uint32_t frame) {
+  if (frame & LED_FRAME_COLUMN_FLAG) {
+    build_led_frame(column_frame, column_color, frame & ~LED_FRAME_COLUMN_FLAG);
+    rmt_write_items(HEADING_LED_RMT_CHANNEL, column_frame, LED_FRAME_ITEMS, true);
+  } else {
+    rmt_write_items(HEADING_LED_RMT_CHANNEL, led_frames[frame], LED_FRAME_ITEMS, true);
+  }
+}
+
+//sends latest requested frame whenever it changes (frames requested during a transfer are coalesced - only newest is sent)
+//while shimmering it also wakes every half period to switch between the frame and off
+static void led_task(void *parameter) {
+  uint32_t shown_frame = LED_FRAME_NONE;
+  while (true) {
+    uint32_t request = requested_frame;
+    uint32_t frame = request & ~LED_FRAME_SHIMMER;
+    bool shimmer = request & LED_FRAME_SHIMMER;
+    if (shimmer && ((xTaskGetTickCount() / LED_SHIMMER_HALF_PERIOD_TICKS) & 1)) frame = LED_FRAME_OFF;
+
+    if (frame != shown_frame) {
+      shown_frame = frame;
+      send_frame(frame);
+    }
+
+    TickType_t wait = portMAX_DELAY;
+    if (shimmer) wait = LED_SHIMMER_HALF_PERIOD_TICKS - (xTaskGetTickCount() % LED_SHIMMER_HALF_PERIOD_TICKS);
+    ulTaskNotifyTake(pdTRUE, wait);
+  }
+}
+
+//records wanted frame - wakes LED task only if it changed (called every pass of rotation loop)
+static inline void update_led_frame(uint32_t frame) {
+  if (frame == requested_frame) return;
+  requested_frame = frame;
+  if (led_task_handle != NULL) xTaskNotifyGive(led_task_handle);
+}
+
+static uint32_t get_on_frame() {
+  return get_config_mode() ? LED_FRAME_ON_CONFIG : LED_FRAME_ON;
+}
+#else
+#include "driver/ledc.h"
+
+//single LED is driven by an LEDC channel - steady on uses a fast PWM timer (brightness), shimmer switches the channel to a slow timer (blink)
+//heading_led_on / off are called every pass of the rotation loop - LEDC is only touched when the LED state changes
+
+#define LED_LEDC_MODE LEDC_LOW_SPEED_MODE        //ESP32-S3 only has low speed mode
+#define LED_LEDC_RESOLUTION_BITS 10
+#define LED_LEDC_FULL_DUTY (1UL << LED_LEDC_RESOLUTION_BITS)
+
+enum led_state_t {
+  LED_STATE_OFF = 0,
+  LED_STATE_ON,
+  LED_STATE_SHIMMER,
+  LED_STATE_NONE          //LEDC not initialized
+};
+
+static led_state_t led_state = LED_STATE_NONE;
+static const uint32_t led_on_duty = (LED_LEDC_FULL_DUTY * HEADING_LED_BRIGHTNESS_PERCENT) / 100;
+
+static bool init_led_timer(ledc_timer_t timer, uint32_t frequency_hz) {
+  ledc_timer_config_t timer_config = {};
+  timer_config.speed_mode = LED_LEDC_MODE;
+  timer_config.duty_resolution = (ledc_timer_bit_t)LED_LEDC_RESOLUTION_BITS;
+  timer_config.timer_num = timer;
+  timer_config.freq_hz = frequency_hz;
+  timer_config.clk_cfg = LEDC_AUTO_CLK;
+
+  esp_err_t result = ledc_timer_config(&timer_config);
+  if (result != ESP_OK) {
+    LOG_ERROR(LED, "Heading LED LEDC timer init failed: %s", esp_err_to_name(result));
+    return false;
+  }
+  return true;
+}
+
+static void set_led_state(led_state_t state) {
+  if (state == led_state || led_state == LED_STATE_NONE) return;
+
+  //shimmer blinks at half duty on the slow timer - duty is latched at the start of the next PWM period
+  if (state == LED_STATE_SHIMMER || led_state == LED_STATE_SHIMMER) {
+    ledc_bind_channel_timer(LED_LEDC_MODE, HEADING_LED_LEDC_CHANNEL, (state == LED_STATE_SHIMMER) ? HEADING_LED_SHIMMER_LEDC_TIMER : HEADING_LED_LEDC_TIMER);
   }
+  uint32_t duty = 0;
+  if (state == LED_STATE_ON) duty = led_on_duty;
+  if (state == LED_STATE_SHIMMER) duty = LED_LEDC_FULL_DUTY / 2;
+  ledc_set_duty(LED_LEDC_MODE, HEADING_LED_LEDC_CHANNEL, duty);
+  ledc_update_duty(LED_LEDC_MODE, HEADING_LED_LEDC_CHANNEL);
+
+  led_state = state;
 }
 #endif
 
 void init_led(void) {
 #if USE_RGB_LED
-  FastLED.addLeds<RGB_LED_TYPE, HEADING_LED_PIN, GRB>(leds, NUM_RGB_LEDS);
-  FastLED.setBrightness(255);
-  FastLED.clear();
-  FastLED.show();
+  build_led_frame(led_frames[LED_FRAME_OFF], 0x000000);
+  build_led_frame(led_frames[LED_FRAME_ON], getColorValue(RGB_LED_COLOR));
+  build_led_frame(led_frames[LED_FRAME_ON_CONFIG], getColorValue(CONFIG_LED_COLOR));
+
+  rmt_config_t config = RMT_DEFAULT_CONFIG_TX((gpio_num_t)HEADING_LED_PIN, HEADING_LED_RMT_CHANNEL);
+  config.clk_div = LED_RMT_CLK_DIV;
+  config.tx_config.idle_output_en = true;
+  config.tx_config.idle_level = RMT_IDLE_LEVEL_LOW;
+
+  esp_err_t result = rmt_config(&config);
+  if (result == ESP_OK) result = rmt_driver_install(HEADING_LED_RMT_CHANNEL, 0, 0);
+  if (result != ESP_OK) {
+    LOG_ERROR(LED, "Heading LED RMT init failed: %s", esp_err_to_name(result));
+    return;
+  }
+
+  xTaskCreatePinnedToCore(led_task, "heading_led", 2048, NULL, 2, &led_task_handle, 0);
+  update_led_frame(LED_FRAME_OFF);
 #else
-  pinMode(HEADING_LED_PIN, OUTPUT);
+  if (!init_led_timer(HEADING_LED_LEDC_TIMER, HEADING_LED_PWM_FREQUENCY_HZ)) return;
+  if (!init_led_timer(HEADING_LED_SHIMMER_LEDC_TIMER, HEADING_LED_SHIMMER_HZ)) return;
+
+  ledc_channel_config_t channel_config = {};
+  channel_config.gpio_num = HEADING_LED_PIN;
+  channel_config.speed_mode = LED_LEDC_MODE;
+  channel_config.channel = HEADING_LED_LEDC_CHANNEL;
+  channel_config.intr_type = LEDC_INTR_DISABLE;
+  channel_config.timer_sel = HEADING_LED_LEDC_TIMER;
+  channel_config.duty = 0;
+  channel_config.hpoint = 0;
+
+  esp_err_t result = ledc_channel_config(&channel_config);
+  if (result != ESP_OK) {
+    LOG_ERROR(LED, "Heading LED LEDC channel init failed: %s", esp_err_to_name(result));
+    return;
+  }
+  led_state = LED_STATE_OFF;
 #endif
 }
 
 void heading_led_on(int shimmer) {
 #if USE_RGB_LED
-  //check to see if we should "shimmer" the LED to indicate something to user
-  if (shimmer == 1) {
-    if (micros() & (1 << 10)) {
-      for (int i = 0; i < NUM_RGB_LEDS; i++) {
-        leds[i] = getColorValue(RGB_LED_COLOR);
-      }
-      FastLED.show();
-    } else {
-      for (int i = 0; i < NUM_RGB_LEDS; i++) {
-        leds[i] = CRGB::Black;
-      }
-      FastLED.show();
-    }
-  } else {
-    //just turn LED on with the configured color
-    for (int i = 0; i < NUM_RGB_LEDS; i++) {
-      leds[i] = getColorValue(RGB_LED_COLOR);
-    }
-    FastLED.show();
-  }
+  //"shimmer" the LED to indicate something to user (flicker timed by LED task - same request every pass)
+  update_led_frame(get_on_frame() | (shimmer == 1 ? LED_FRAME_SHIMMER : 0));
 #else
-  //check to see if we should "shimmer" the LED to indicate something to user
-  if (shimmer == 1) {
-    if (micros() & (1 << 10)) {
-      digitalWrite(HEADING_LED_PIN, HIGH);
-    } else {
-      digitalWrite(HEADING_LED_PIN, LOW);
-    }
-  } else {
-    //just turn LED on
-     digitalWrite(HEADING_LED_PIN, HIGH);
-  }
+  //shimmer blinks in hardware (independent of loop timing)
+  set_led_state(shimmer == 1 ? LED_STATE_SHIMMER : LED_STATE_ON);
 #endif
 }
 
 void heading_led_off() {
 #if USE_RGB_LED
-  for (int i = 0; i < NUM_RGB_LEDS; i++) {
-    leds[i] = CRGB::Black;
-  }
-  FastLED.show();
+  update_led_frame(LED_FRAME_OFF);
+#else
+  set_led_state(LED_STATE_OFF);
+#endif
+}
+
+unsigned long led_get_frame_time_us() {
+#if USE_RGB_LED
+  return (((unsigned long)LED_FRAME_ITEMS * (LED_T0H_TICKS + LED_T0L_TICKS)) + LED_RESET_TICKS) / (80 / LED_RMT_CLK_DIV);
+#else
+  return 0;
+#endif
+}
+
+void led_set_column_color(uint32_t rgb) {
+#if USE_RGB_LED
+  column_color = rgb;
+#endif
+}
+
+void led_show_column(uint32_t led_mask, bool shimmer) {
+#if USE_RGB_LED
+  update_led_frame(LED_FRAME_COLUMN_FLAG | (shimmer ? LED_FRAME_SHIMMER : 0) | (led_mask & ((1UL << NUM_RGB_LEDS) - 1)));
 #else
-  digitalWrite(HEADING_LED_PIN, LOW);
+  if (!(led_mask & 1)) {
+    set_led_state(LED_STATE_OFF);
+  } else {
+    set_led_state(shimmer ? LED_STATE_SHIMMER : LED_STATE_ON);
+  }
 #endif
 }
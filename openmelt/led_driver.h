@@ -1,7 +1,24 @@
+#include <stdint.h>
+
+#include "melty_config.h"
+
 void init_led(void);
 
-//turns heading LED on (with quick flicker effect if "shimmering")
+//returns color value of an led_color_t (0xRRGGBB)
+uint32_t getColorValue(led_color_t color);
+
+//turns heading LED on (with flicker effect if "shimmering" - timed by the LED driver, not the caller)
 void heading_led_on(int led_shimmering);
  
 //turns heading LED off
 void heading_led_off();
+
+//time from an LED change being requested until the LEDs show it (one LED frame) - 0 for a single LED
+unsigned long led_get_frame_time_us();
+
+//sets color used by led_show_column (0xRRGGBB)
+void led_set_column_color(uint32_t rgb);
+
+//shows a column of a POV image - LED n is lit if bit n of led_mask is set (non-blocking - only sent if changed)
+//shimmer flickers the lit LEDs as heading_led_on does (single LED mode: bit 0 switches the LED)
+void led_show_column(uint32_t led_mask, bool shimmer = false);
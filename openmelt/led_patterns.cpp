@@ -0,0 +1,101 @@
+//this module flashes status patterns on the heading LED
+//each pattern is a table of on / off steps - the current step is found from the time it started (no delay() calls)
+
+#include <Arduino.h>
+#include "led_patterns.h"
+#include "led_driver.h"
+
+#define LED_PATTERN_RESYNC_MS 2000      //pattern restarts its current step if not shown for this long (ie. while spinning)
+
+typedef struct led_pattern_step_t {
+  uint8_t led_on;
+  uint16_t duration_ms;
+} led_pattern_step_t;
+
+typedef struct led_pattern_def_t {
+  const led_pattern_step_t *steps;
+  uint8_t step_count;
+} led_pattern_def_t;
+
+#define LED_PATTERN_STEPS(steps) { steps, sizeof(steps) / sizeof(steps[0]) }
+
+static const led_pattern_step_t waiting_for_signal_steps[] = { { 1, 250 }, { 0, 250 } };
+static const led_pattern_step_t no_signal_steps[] = { { 1, 30 }, { 0, 600 } };
+static const led_pattern_step_t idle_steps[] = { { 1, 30 }, { 0, 120 } };
+static const led_pattern_step_t idle_config_steps[] = { { 1, 30 }, { 0, 520 }, { 1, 30 }, { 0, 140 } };
+static const led_pattern_step_t driving_steps[] = { { 1, 20 }, { 0, 80 }, { 1, 20 }, { 0, 120 } };
+static const led_pattern_step_t rpm_flash_steps[] = { { 0, 600 }, { 1, 20 } };
+static const led_pattern_step_t rpm_flash_end_steps[] = { { 0, 1500 } };
+
+static const led_pattern_def_t patterns[LED_PATTERN_COUNT] = {
+  LED_PATTERN_STEPS(waiting_for_signal_steps),
+  LED_PATTERN_STEPS(no_signal_steps),
+  LED_PATTERN_STEPS(idle_steps),
+  LED_PATTERN_STEPS(idle_config_steps),
+  LED_PATTERN_STEPS(driving_steps),
+  LED_PATTERN_STEPS(rpm_flash_steps),
+  LED_PATTERN_STEPS(rpm_flash_end_steps)
+};
+
+static led_pattern_t current_pattern = LED_PATTERN_COUNT;
+static uint8_t current_step = 0;
+static unsigned long step_start_ms = 0;
+static unsigned long last_shown_ms = 0;
+static bool repeat_forever = true;
+static unsigned int repeats_left = 0;
+static bool finished = false;
+
+void led_pattern_start(led_pattern_t pattern, unsigned int repeat_count) {
+  if (pattern >= LED_PATTERN_COUNT) return;
+  current_pattern = pattern;
+  current_step = 0;
+  step_start_ms = millis();
+  last_shown_ms = step_start_ms;
+  repeat_forever = false;
+  repeats_left = repeat_count;
+  finished = (repeat_count == 0);
+}
+
+//moves through any steps whose time has passed
+static void advance_pattern(unsigned long now_ms) {
+  const led_pattern_def_t *pattern = &patterns[current_pattern];
+
+  //pattern wasn't shown for a while - carry on from current step rather than racing through missed steps
+  if (now_ms - last_shown_ms > LED_PATTERN_RESYNC_MS) step_start_ms = now_ms;
+  last_shown_ms = now_ms;
+
+  while (finished == false && now_ms - step_start_ms >= pattern->steps[current_step].duration_ms) {
+    step_start_ms += pattern->steps[current_step].duration_ms;
+    current_step++;
+    if (current_step >= pattern->step_count) {
+      current_step = 0;
+      if (repeat_forever == false && --repeats_left == 0) finished = true;
+    }
+  }
+}
+
+void led_pattern_show(led_pattern_t pattern) {
+  if (pattern >= LED_PATTERN_COUNT) return;
+  if (pattern != current_pattern) {
+    led_pattern_start(pattern, 0);
+    repeat_forever = true;
+    finished = false;
+  }
+
+  advance_pattern(millis());
+
+  //LED driver only touches hardware when the state changes
+  if (finished == false && patterns[current_pattern].steps[current_step].led_on) {
+    heading_led_on(0);
+  } else {
+    heading_led_off();
+  }
+}
+
+led_pattern_t led_pattern_get() {
+  return current_pattern;
+}
+
+bool led_pattern_finished() {
+  return finished;
+}
@@ -0,0 +1,31 @@
+#ifndef LED_PATTERNS_H
+#define LED_PATTERNS_H
+
+//status patterns flashed on the heading LED while not spinning (no signal / idle / driving mode / RPM count)
+//patterns are step tables advanced by time - showing one never blocks the main loop
+
+enum led_pattern_t {
+  LED_PATTERN_WAITING_FOR_SIGNAL = 0,  //slow on / off - waiting for good RC signal at zero throttle (boot)
+  LED_PATTERN_NO_SIGNAL,               //slow flash - RC signal lost
+  LED_PATTERN_IDLE,                    //fast flash - RC signal good, bot idle
+  LED_PATTERN_IDLE_CONFIG,             //double flash - idle in config mode
+  LED_PATTERN_DRIVING,                 //quick double blink - normal (tank) driving mode
+  LED_PATTERN_RPM_FLASH,               //one flash per 100 RPM (played a number of times with led_pattern_start)
+  LED_PATTERN_RPM_FLASH_END,           //pause after RPM count (played once)
+  LED_PATTERN_COUNT
+};
+
+//shows a pattern - call on every pass of the main loop (drives the LED for the current step)
+//a different pattern starts from its first step - the same pattern carries on (looping if not started with a count)
+void led_pattern_show(led_pattern_t pattern);
+
+//(re)starts a pattern that plays repeat_count times then leaves the LED off (led_pattern_finished returns true)
+void led_pattern_start(led_pattern_t pattern, unsigned int repeat_count);
+
+//pattern most recently shown / started (LED_PATTERN_COUNT if none)
+led_pattern_t led_pattern_get();
+
+//returns true once a pattern started with a count has played through
+bool led_pattern_finished();
+
+#endif // LED_PATTERNS_H
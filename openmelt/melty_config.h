@@ -10,15 +10,36 @@
 
 //----------DIAGNOSTICS----------
 // #define JUST_DO_DIAGNOSTIC_LOOP                 //Disables the robot / just displays config / battery voltage / RC info via serial
+// #define JUST_DO_MOTOR_BENCHMARK                 //Disables the robot / repeatedly times motor output and log calls (DRIVES MOTOR PINS - disconnect motors / unpower ESCs)
+
+//----------LOGGING----------
+//LOG_* calls below a module's level are removed at compile time (arguments aren't evaluated) - see debug_handler.h
+//levels: DEBUG_VERBOSE (periodic traces from the control loop), DEBUG_INFO, DEBUG_WARNING, DEBUG_ERROR
+#define DEBUG_LEVEL_DEFAULT DEBUG_INFO             //level for modules without their own setting
+// #define DEBUG_LEVEL_RC DEBUG_VERBOSE            //per module level - DEBUG_LEVEL_<module> (SYSTEM, MOTOR, RC, ACCEL, LED, POV, ADC,
+// #define DEBUG_LEVEL_MOTOR DEBUG_VERBOSE         //EEPROM, SPIN, TELEMETRY, WEB, WIFI, FLIGHTLOG)
+#define DEBUG_MODULE_MASK_DEFAULT 0xFFFFFFFF       //modules logging at boot (bit per debug_module_t) - can be changed at runtime from web UI
 
 //----------WIFI CONFIGURATION----------
 #define ENABLE_WIFI                                //Comment out to disable WiFi entirely (reduces potential interference)
 #define ENABLE_WEBSERVER                           //Enable web server diagnostics (but still allow normal operation)
+#define TELEMETRY_STREAM_PORT 81                   //WebSocket port for binary telemetry stream (see telemetry_stream.h)
+#define TELEMETRY_STREAM_RATE_HZ 100               //telemetry frames per second sent to each web UI client (50-200)
+#define TELEMETRY_STREAM_MAX_CLIENTS 2             //browser tabs that can stream at once
+#define TELEMETRY_STREAM_MAX_QUEUED 2              //sends waiting per client before frames are dropped for it
 #define WIFI_POWER_LEVEL WIFI_POWER_11dBm          //Power level for WiFi: WIFI_POWER_19_5dBm, WIFI_POWER_19dBm, WIFI_POWER_18_5dBm,
                                                    //WIFI_POWER_17dBm, WIFI_POWER_15dBm, WIFI_POWER_13dBm, WIFI_POWER_11dBm, WIFI_POWER_8_5dBm,
                                                    //WIFI_POWER_7dBm, WIFI_POWER_5dBm, WIFI_POWER_2dBm, WIFI_POWER_MINUS_1dBm
 #define DISABLE_WIFI_POWER_SAVE                    //Disable WiFi power saving to prevent potential GPIO signal interference
 
+//----------FLIGHT LOG----------
+//rotation records and every accelerometer sample are kept in the "flightlog" flash partition (partitions.csv) - download from /flightlog
+//flash writes stall the control loop - so they wait in RAM until the robot has been idle (motors off) for FLIGHT_LOG_FLUSH_IDLE_MS
+#define ENABLE_FLIGHT_LOG                         //Comment out to disable flight recorder
+#define FLIGHT_LOG_RAM_BLOCKS 8                   //4KB blocks held in internal RAM while spinning (~2KB/s while spinning - oldest dropped when full)
+#define FLIGHT_LOG_PSRAM_BLOCKS 256               //4KB blocks held in PSRAM (used instead if PSRAM is fitted)
+#define FLIGHT_LOG_FLUSH_IDLE_MS 1000             //robot must be idle this long before blocks are written to flash
+
 //----------EEPROM----------
 #define ENABLE_EEPROM_STORAGE                     //Comment out this to disable EEPROM (for ARM)
 #define EEPROM_WRITTEN_SENTINEL_VALUE 41          //Changing this value will cause existing EEPROM values to be invalidated (revert to defaults)
@@ -35,13 +56,27 @@
                                                   //For small-radius bots - try changing to H3LIS331 to +/-200g range for improved accuracy (accel_handler.h)
 
 #define LEFT_RIGHT_HEADING_CONTROL_DIVISOR 1.1f   //How quick steering is (larger values = slower)
+                                                  //Steering / throttle endpoints, deadband and expo are set by RC curves (web UI "Curves" tab - see rc_curves.h)
 
 #define MIN_TRANSLATION_RPM 250                   //full power spin in below this number (increasing can reduce spin-up time)
 
+//----------SPIN-UP PROFILE----------
+//full throttle from standstill causes current spikes, brown-outs and wheel slip (which slows spin-up)
+//with the profile enabled throttle rises at a limited rate, starts from a lower limit at standstill and backs off over a current limit
+//(throttle value only - BINARY_THROTTLE / FIXED_PWM_THROTTLE motors are on or off)
+#define SPIN_UP_PROFILE_ENABLED false
+#define THROTTLE_SLEW_PERCENT_PER_SEC 200.0f      //max throttle increase per second (decreases are immediate)
+#define SPIN_UP_START_THROTTLE_LIMIT 0.6f         //throttle limit at standstill - rises linearly to no limit at SPIN_UP_FULL_THROTTLE_RPM
+#define SPIN_UP_FULL_THROTTLE_RPM MIN_TRANSLATION_RPM
+#define SPIN_UP_CURRENT_LIMIT_A 0.0f              //total motor current above which throttle is reduced at the slew rate
+                                                  //(0 = no limit - requires MOTOR_X_CURRENT_ADC_PIN)
+#define SPIN_UP_RESET_MS 100                      //not spinning for this long - throttle ramps from 0 again (new spin-up)
+#define SPIN_UP_LOG_RPMS { 250, 500, 1000, 1500 } //time from start of spin-up to each of these RPMs is logged (profile or not - for comparison)
+
 //----------RGB LED CONFIGURATION----------
 #define USE_RGB_LED true                         // Set to true to use RGB LED, false for standard LED
 #define NUM_RGB_LEDS 4                            // Number of RGB LEDs in the strip/chain
-#define RGB_LED_TYPE WS2812B                      // Type of RGB LED being used
+#define HEADING_LED_RMT_CHANNEL RMT_CHANNEL_0      // RMT channel driving the RGB LEDs (WS2812 / WS2812B or compatible)
 
 // RGB LED color options
 enum led_color_t {
@@ -57,6 +92,46 @@ enum led_color_t {
 
 #define RGB_LED_COLOR YELLOW                       // Default color for RGB LED
 #define CONFIG_LED_COLOR MAGENTA                       // Color for config mode indicator
+#define HEADING_LED_RGB_SHIMMER_HZ 50                // Shimmer blink rate - each change is one LED frame (~0.4ms) so kept far below HEADING_LED_SHIMMER_HZ
+
+//----------SINGLE LED (USE_RGB_LED false)----------
+//plain heading LED is driven by an LEDC channel - brightness and shimmer are generated in hardware (on / off / shimmer only touch LEDC on change)
+//ESP32Servo allocates LEDC channels from 0 upwards / analogWrite (PWM throttle types) from 7 downwards - Oneshot uses ONESHOT_LEDC_TIMER
+#define HEADING_LED_LEDC_CHANNEL LEDC_CHANNEL_4
+#define HEADING_LED_LEDC_TIMER LEDC_TIMER_2          //steady on (HEADING_LED_PWM_FREQUENCY_HZ)
+#define HEADING_LED_SHIMMER_LEDC_TIMER LEDC_TIMER_1  //shimmer (HEADING_LED_SHIMMER_HZ)
+#define HEADING_LED_PWM_FREQUENCY_HZ 20000           //brightness PWM - fast enough not to dash the beacon at full RPM
+#define HEADING_LED_SHIMMER_HZ 488                   //shimmer blink rate (LEDC - single LED)
+#define HEADING_LED_BRIGHTNESS_PERCENT 100
+
+//----------HEADING ARC----------
+//with LEDs mounted at different angles each LED is lit only while it points at the heading (instead of all LEDs showing one blob)
+//every LED draws the beacon in turn - so it can be narrow (and still bright) at high RPM
+//LED windows are started early by the LED frame time (~(30us x NUM_RGB_LEDS) + 300us) so each LED lights up where intended
+enum heading_arc_color_mode_t {
+  HEADING_ARC_COLOR_FIXED,                        //RGB_LED_COLOR
+  HEADING_ARC_COLOR_DIRECTION,                    //green forward / red backward / RGB_LED_COLOR not translating
+  HEADING_ARC_COLOR_RPM,                          //red below MIN_TRANSLATION_RPM / yellow below HEADING_ARC_HIGH_RPM / green
+  HEADING_ARC_COLOR_BATTERY                       //green / yellow within HEADING_ARC_BATTERY_MARGIN_VOLTAGE of warning threshold / red below it
+};
+
+#define HEADING_ARC_ENABLED false                 //requires USE_RGB_LED
+#define HEADING_ARC_LED_ANGLES { 0, 90, 180, 270 } //degrees each LED is ahead of LED 0 in direction of rotation (one per NUM_RGB_LEDS)
+#define HEADING_ARC_WIDTH_PERCENT 8               //beacon width drawn by each LED (percent of rotation - never shorter than one LED frame)
+#define HEADING_ARC_COLOR_MODE HEADING_ARC_COLOR_DIRECTION
+#define HEADING_ARC_HIGH_RPM 1500                 //HEADING_ARC_COLOR_RPM - green at or above this RPM
+#define HEADING_ARC_BATTERY_MARGIN_VOLTAGE 0.5f   //HEADING_ARC_COLOR_BATTERY - yellow this close to BATTERY_ADC_WARN_VOLTAGE_THRESHOLD
+
+//----------POV DISPLAY----------
+//persistence-of-vision content drawn by the LEDs while spinning (selected / uploaded in web UI "POV" tab - see pov_display.h)
+//each column change sends a LED frame (~(30us x NUM_RGB_LEDS) + 300us) - with 4 LEDs about 2300 columns / s
+//(64 bins is full resolution up to ~2100 RPM - above that some columns are skipped)
+#define POV_ANGLE_BINS 64                         //columns per rotation
+#define POV_LED0_IS_OUTER true                    //true if first LED in chain is furthest from center (top of digits)
+#define POV_SHOW_HEADING_BEACON false             //true = heading beacon still shown (over POV content) - beacon width follows throttle
+#define POV_REDRAW_INTERVAL_MS 250                //RPM / battery content redrawn this often
+#define POV_BATTERY_EMPTY_VOLTAGE 6.6f            //battery gauge range
+#define POV_BATTERY_FULL_VOLTAGE 8.4f
 
 //----------PIN MAPPINGS----------
 //RC pins must be Arduino interrupt pins
@@ -73,6 +148,36 @@ enum led_color_t {
 #define THROTTLE_RC_CHANNEL_PIN 3                 // To Throttle on RC receiver (Pin 0 on Arduino Micro labelled as "RX" - https://docs.arduino.cc/hacking/hardware/PinMapping32u4)
 #define EMERGENCY_OFF 4                           // To cut power to both ESCs
 
+//----------RC CHANNEL MAP----------
+//Assigns a function to each RC receiver channel - any number of channels can be listed (each needs an interrupt capable pin)
+//LEFTRIGHT, FORBACK and THROTTLE are required - the others are optional aux channels (uncomment / change pins as needed)
+enum rc_channel_function {
+  RC_FUNCTION_NONE = -1,
+  RC_FUNCTION_LEFTRIGHT = 0,          //steering (heading adjustment)
+  RC_FUNCTION_FORBACK,                //forward / back translation
+  RC_FUNCTION_THROTTLE,               //throttle (also used to judge RC signal health)
+  RC_FUNCTION_ARM,                    //switch - throttle is held at 0 and motors off unless switch is on
+  RC_FUNCTION_CONFIG_TOGGLE,          //switch - each flip toggles config mode (acted on when bot is idle - entering config samples accel 0g offset)
+  RC_FUNCTION_TRANSLATION_MODE,       //3 position switch - low: normal, mid: inverted steering (bot upside down), high: spin only
+  RC_FUNCTION_RPM_GOVERNOR,           //switch - on limits RPM to RPM_GOVERNOR_MAX_RPM
+  RC_FUNCTION_HEADING_TRIM,           //knob / slider - trims heading by up to +/-HEADING_TRIM_RANGE_PERCENT of a rotation
+  RC_FUNCTION_COUNT
+};
+
+#define RC_CHANNEL_MAP { \
+  { LEFTRIGHT_RC_CHANNEL_PIN, RC_FUNCTION_LEFTRIGHT }, \
+  { FORBACK_RC_CHANNEL_PIN, RC_FUNCTION_FORBACK }, \
+  { THROTTLE_RC_CHANNEL_PIN, RC_FUNCTION_THROTTLE }, \
+  /* { 5, RC_FUNCTION_ARM }, */ \
+  /* { 6, RC_FUNCTION_CONFIG_TOGGLE }, */ \
+  /* { 8, RC_FUNCTION_TRANSLATION_MODE }, */ \
+  /* { 11, RC_FUNCTION_RPM_GOVERNOR }, */ \
+  /* { 12, RC_FUNCTION_HEADING_TRIM }, */ \
+}
+
+#define RPM_GOVERNOR_MAX_RPM 1500                 //RPM limit when RC_FUNCTION_RPM_GOVERNOR switch is on
+#define HEADING_TRIM_RANGE_PERCENT 10             //heading trim knob range (percent of a rotation either side of center)
+
 #define HEADING_LED_PIN	7                        //To heading LED (pin 21 is on-board M5StampS3 RGB LED)
 
 //no configuration changes are needed if only 1 motor is used!
@@ -80,6 +185,9 @@ enum led_color_t {
 #define MOTOR_PIN2 10                             //Pin for Motor 2 driver
 
 #define BATTERY_ADC_PIN 14                        //Pin for battery monitor (if enabled) changed from A0 for Arduino to 14 for M5StampS3-1.27
+                                                  //GPIO14 is on ADC2 (polled - shared with WiFi) - a free ADC1 pin (GPIO1-10) is sampled continuously by DMA
+#define MOTOR_1_CURRENT_ADC_PIN -1                //Current sense outputs for motors / ESCs (-1 = not fitted) - ADC1 pins recommended
+#define MOTOR_2_CURRENT_ADC_PIN -1
 
 
 //----------THROTTLE CONFIGURATION----------
@@ -103,8 +211,20 @@ enum throttle_modes {
                         //Robot speed is additionally controlled by portion of each rotation motor is on (unless DYNAMIC_PWM_MOTOR_ON_PORTION is defined)
                         //This mode reduces current levels during spin up at part throttle
 
-  SERVO_PWM_THROTTLE    //S1 sectandard RC Servo PWM signal (50Hz, 1000-2000μs pulse width)
+  SERVO_PWM_THROTTLE,   //S1 sectandard RC Servo PWM signal (50Hz, 1000-2000μs pulse width)
                         //Compatible with standard RC ESCs like BLHeli
+
+  DSHOT_THROTTLE,       //DShot digital protocol (see DSHOT SETTINGS) generated by RMT - ESC sees a new command every DSHOT_FRAME_INTERVAL_US
+                        //Same throttle / translation / coast behavior as SERVO_PWM_THROTTLE (pulse widths are converted to DShot values)
+                        //Requires a DShot capable ESC (BLHeli_S / BLHeli_32 / Bluejay / AM32)
+
+  ONESHOT125_THROTTLE,  //Oneshot125 (125-250μs pulse) at ONESHOT_FRAME_RATE_HZ (see ONESHOT / MULTISHOT SETTINGS) generated by LEDC
+                        //Same throttle / translation / coast behavior as SERVO_PWM_THROTTLE (pulse widths are scaled to protocol range)
+                        //For ESCs without DShot support (BLHeli / SimonK with Oneshot enabled)
+
+  ONESHOT42_THROTTLE,   //Oneshot42 (42-84μs pulse) - as ONESHOT125_THROTTLE
+
+  MULTISHOT_THROTTLE    //Multishot (5-25μs pulse) - as ONESHOT125_THROTTLE
 };
 
 #define DYNAMIC_PWM_THROTTLE_PERCENT_MAX 1.0f   //Range of RC throttle DYNAMIC_PWM_THROTTLE is applied to
@@ -113,6 +233,11 @@ enum throttle_modes {
 
 #define THROTTLE_TYPE SERVO_PWM_THROTTLE         //<---Using standard RC servo PWM for BLHeli ESCs
 
+//true for Oneshot / Multishot throttle types (LEDC generated pulses)
+#define THROTTLE_TYPE_IS_ONESHOT (THROTTLE_TYPE == ONESHOT125_THROTTLE || THROTTLE_TYPE == ONESHOT42_THROTTLE || THROTTLE_TYPE == MULTISHOT_THROTTLE)
+//true for throttle types that drive ESCs with servo-style neutral / forward / reverse commands
+#define THROTTLE_TYPE_IS_ESC (THROTTLE_TYPE == SERVO_PWM_THROTTLE || THROTTLE_TYPE == DSHOT_THROTTLE || THROTTLE_TYPE_IS_ONESHOT)
+
 //----------ESC SETTINGS----------
 // Standard RC servo PWM signal for bi-directional BLHeli ESCs:
 // - 50Hz frequency (20ms period)
@@ -137,7 +262,61 @@ enum throttle_modes {
                                              // 1.0 = 100% current throttle, 1.1 = 110% of current throttle (will be capped at 2000μs)
                                              // Helps prevent voltage spikes when using damped mode in ESCs
 
-#define DYNAMIC_PWM_MOTOR_ON_PORTION 0.5f       //if defined (and DYNAMIC_PWM_THROTTLE is set) portion of each rotation motor is on is fixed at this value
+#define SERVO_PWM_USE_MCPWM false            // true = generate servo PWM with MCPWM instead of ESP32Servo (LEDC)
+                                             // Both motors share one MCPWM timer - frames start together and pulse width changes
+                                             // made at a rotation phase edge reach both ESCs in the same frame
+#define SERVO_PWM_FREQUENCY_HZ 50            // Servo PWM frame rate (MCPWM only - ESP32Servo is fixed at 50Hz)
+#define SERVO_MCPWM_UNIT MCPWM_UNIT_0        // MCPWM unit used (timer 0, operators A / B drive motor 1 / motor 2)
+
+#define DYNAMIC_PWM_MOTOR_ON_PORTION 0.5f      //if defined (and DYNAMIC_PWM_THROTTLE is set) portion of each rotation motor is on is fixed at this value
+
+//----------DSHOT SETTINGS----------
+//(only used if THROTTLE_TYPE is DSHOT_THROTTLE)
+#define DSHOT_SPEED 600                           //150, 300 or 600 (kbit/s) - must be supported by ESC
+#define DSHOT_3D_MODE true                        //true for bidirectional ESCs (3D mode enabled in ESC) - matches 1500us neutral servo behavior
+#define DSHOT_FRAME_INTERVAL_US 125               //time between frame starts (8kHz) - frames are repeated continuously by hardware
+#define DSHOT_ARM_TIME_MS 1000                    //time stop command is sent at startup so ESC arms
+#define DSHOT_RMT_CHANNEL_MOTOR1 RMT_CHANNEL_1    //RMT TX channels (RMT_CHANNEL_0 is used by heading LED)
+#define DSHOT_RMT_CHANNEL_MOTOR2 RMT_CHANNEL_2
+
+//Bidirectional DShot - ESC replies to each frame with motor eRPM on the same wire (signal is inverted)
+//Requires ESC firmware support (BLHeli_32 / Bluejay / AM32) - eRPM is fused with accelerometer RPM estimate
+#define DSHOT_BIDIRECTIONAL false                 //set to true to enable eRPM telemetry
+#define DSHOT_RMT_RX_CHANNEL_MOTOR1 RMT_CHANNEL_4 //RMT RX channels (ESP32-S3 - channels 4-7 are RX only)
+#define DSHOT_RMT_RX_CHANNEL_MOTOR2 RMT_CHANNEL_5
+#define DSHOT_ERPM_TIMEOUT_MS 50                  //eRPM older than this is ignored
+
+//----------ONESHOT / MULTISHOT SETTINGS----------
+//(only used if THROTTLE_TYPE is ONESHOT125_THROTTLE, ONESHOT42_THROTTLE or MULTISHOT_THROTTLE)
+#define ONESHOT_FRAME_RATE_HZ 2000                //frames per second - reduced at startup if a full throttle pulse would not fit in a frame
+                                                  //(max approx: Oneshot125 3900, Oneshot42 11500, Multishot 36000 - ESC may support less)
+#define ONESHOT_SYNC_TO_ROTATION true             //restart frame on motor phase changes so new throttle is sent immediately (never cuts a pulse short)
+#define ONESHOT_LEDC_TIMER LEDC_TIMER_3           //LEDC timer shared by both motors
+#define ONESHOT_LEDC_CHANNEL_MOTOR1 LEDC_CHANNEL_6
+#define ONESHOT_LEDC_CHANNEL_MOTOR2 LEDC_CHANNEL_7
+
+//----------ERPM FUSION SETTINGS----------
+//(only used if DSHOT_BIDIRECTIONAL is enabled)
+//body RPM = motor RPM / gear ratio * wheel radius / wheel track radius (assumes wheels roll without slip)
+#define MOTOR_POLE_COUNT 14                       //number of magnet poles in motor (eRPM = RPM * poles / 2)
+#define MOTOR_GEAR_RATIO 1.0f                     //motor turns per wheel turn (1.0 for direct drive)
+#define WHEEL_RADIUS_CM 2.5f                      //radius of drive wheels
+#define WHEEL_TRACK_RADIUS_CM 6.0f                //distance from center of robot to wheel contact patch
+#define ERPM_FUSION_WEIGHT 0.5f                   //weight given to eRPM estimate (0.0 = accelerometer only, 1.0 = eRPM only)
+#define ERPM_SLIP_THRESHOLD_PERCENT 15            //wheel slip flagged (eRPM ignored) when estimates differ by more than this
+
+//----------ESC LATENCY SETTINGS----------
+//ESCs take time to respond to a new command (depends on protocol, firmware and ramp settings) - so power lands later in the
+//rotation than intended, by more degrees the faster the robot spins
+//each motor's on / coast switching is moved earlier by its latency (converted to phase at current RPM every rotation)
+//keeps translation direction lined up with the heading LED across the RPM range
+#define MOTOR_1_ESC_LATENCY_US 0                  //time from command change to motor responding (0 = no compensation)
+#define MOTOR_2_ESC_LATENCY_US 0
+#define ESC_LATENCY_AUTO_MEASURE false            //measure latency from eRPM response to each power step (requires DSHOT_BIDIRECTIONAL)
+                                                  //replaces values above once ESC_LATENCY_MIN_SAMPLES responses are seen
+#define ESC_LATENCY_ERPM_RISE_PERCENT 2.0f        //eRPM rise after motor switches on that counts as the ESC responding
+#define ESC_LATENCY_MAX_US 20000                  //no response within this time (or before motor switches off) - measurement discarded
+#define ESC_LATENCY_MIN_SAMPLES 20                //measurements needed before measured latency is used
 
 //----------PWM MOTOR SETTINGS----------
 //(only used if a PWM throttle mode is chosen)
@@ -151,9 +330,27 @@ enum throttle_modes {
 //#define BATTERY_ALERT_ENABLED                     //if enabled - heading LED will flicker when battery voltage is low
 #define VOLTAGE_DIVIDER 11                        //(~10:1 works well - 10kohm to GND, 100kohm to Bat+).  Resistors have tolerances!  Adjust as needed...
 #define BATTERY_ADC_WARN_VOLTAGE_THRESHOLD 7.0f  //If voltage drops below this value - then alert is triggered
-#define ARDUINIO_VOLTAGE 5.0f                     //Needed for ADC maths for battery monitor
 #define LOW_BAT_REPEAT_READS_BEFORE_ALARM 20      //Requires this many ADC reads below threshold before alarming
 
+//----------ADC SAMPLING----------
+//battery / current inputs are sampled in the background (see adc_sampler.h) - readings are eFuse calibrated mV at the pin
+#define ADC_SAMPLE_RATE_HZ 10000                  //ADC1 continuous conversion rate (shared by all DMA inputs)
+#define ADC_POLL_INTERVAL_MS 5                    //ADC2 inputs read this often (also max time between DMA frame checks)
+#define ADC_FILTER_WEIGHT 0.1f                    //weight of each new reading in filtered value (lower = smoother)
+#define CURRENT_SENSE_MV_PER_AMP 40.0f            //current sensor output scale (ie. ACS711 15A at 3.3V = 90mV/A)
+#define CURRENT_SENSE_ZERO_MV 0.0f                //current sensor output at 0A (ie. half supply for bidirectional sensors)
+
+//----------BATTERY SAG COMPENSATION----------
+//as the pack sags the same throttle produces less torque - scaling throttle by nominal / measured voltage keeps RPM and
+//translation authority the same through a match (applies to ESC and DYNAMIC_PWM throttle types)
+#define BATTERY_SAG_COMPENSATION_ENABLED false    //requires battery voltage divider on BATTERY_ADC_PIN
+#define BATTERY_SAG_NOMINAL_VOLTAGE 8.4f          //voltage output is matched to (no compensation at or above this voltage)
+#define BATTERY_SAG_MIN_VOLTAGE 5.0f              //filtered voltage below this is treated as no battery reading (compensation off)
+#define BATTERY_SAG_MAX_SCALE 1.2f                //throttle is never scaled up by more than this
+#define BATTERY_SAG_FILTER_WEIGHT 0.05f           //weight of each voltage reading in filtered estimate (lower = smoother)
+#define BATTERY_SAG_MAX_SCALE_STEP 0.005f         //max change in scale per update (rate limit - avoids lurches on current spikes)
+#define BATTERY_SAG_UPDATE_INTERVAL_MS 10         //voltage is read at most this often
+
 
 //----------NORMAL DRIVING MODE----------
 #define NORMAL_DRIVING_MODE_STEERING_DEADZONE 0.1    // Deadzone for steering inputs in normal driving mode (0.0-1.0)
@@ -4,38 +4,332 @@
 #include "melty_config.h"
 #include "motor_driver.h"
 #include "debug_handler.h"
-#include "rc_handler.h"  // Include for rc_get_translation_percent()
+#include "dshot.h"
+#include "oneshot.h"
+#include "servo_mcpwm.h"
+#include "battery_monitor.h"
+#include "telemetry_registry.h"
 #include <ESP32Servo.h>  // Using ESP32-specific servo library
 
 // Servo objects for ESC control when using SERVO_PWM_THROTTLE
 Servo motor1_servo;
 Servo motor2_servo;
 
-// Variables to store current PWM values
-int current_motor1_pulse_width = 1500;
-int current_motor2_pulse_width = 1500;
+// Per-motor output state
+typedef struct motor_state_t {
+  int pin;                  // MOTOR_PIN1 / MOTOR_PIN2
+  int index;                // 0 = motor 1, 1 = motor 2 (DShot / Oneshot channel)
+  Servo *servo;             // only used with SERVO_PWM_THROTTLE
+  int pulse_width;          // last servo-style pulse width commanded (μs)
+  int on_pulse_width;       // pulse width latched by last motor_on (coast is scaled from this)
+  int32_t output_value;     // last value written to peripheral (-1 = nothing written yet)
+  float throttle_percent;   // last throttle passed to motor_on (for debug output)
+  bool is_translating;      // last translating flag passed to motor_on (for debug output)
+  bool is_on;               // true if last call was motor_on (for debug output)
+  unsigned int calls;       // motor_on / coast / off calls this rotation
+  unsigned int writes;      // peripheral writes this rotation
+  unsigned int calls_last_rotation;
+  unsigned int writes_last_rotation;
+} motor_state_t;
+
+static motor_state_t motor_states[2] = {
+  { MOTOR_PIN1, 0, &motor1_servo, 1500, 1500, -1, 0.0f, false, false, 0, 0, 0, 0 },
+  { MOTOR_PIN2, 1, &motor2_servo, 1500, 1500, -1, 0.0f, false, false, 0, 0, 0, 0 }
+};
+
+// Translation values - set once per melty parameter update (not per motor call)
+static float translation_scale = 0.0f;         // 0-1 steering stick distance from center
+static int translate_pulse_width = 1500;       // ESC pulse width for powered phase while translating
+static float scaled_coast_percent = 1.0f;      // portion of powered pulse width used while coasting
+
+// Battery sag compensation - throttle is multiplied by voltage_scale (1.0 when disabled)
+static float filtered_battery_voltage = 0.0f;
+static float voltage_scale = 1.0f;
+
+static inline motor_state_t *motor_state_for_pin(int motor_pin) {
+  return (motor_pin == MOTOR_PIN2) ? &motor_states[1] : &motor_states[0];
+}
+
+// Records a value about to be written to a motor's peripheral
+// Returns false if it matches the last value written (nothing needs to be sent)
+static inline bool latch_output(motor_state_t *motor, int32_t value) {
+  if (value == motor->output_value) return false;
+  motor->output_value = value;
+  motor->writes++;
+  return true;
+}
+
+// Converts a servo-style pulse width to the value an ESC peripheral is written with - specialized per ESC protocol
+// Values are compared in these units so changes finer than the peripheral can output don't cause writes
+template <throttle_modes T> static inline int32_t esc_output_value(int pulse_width) {
+  return pulse_width;  // Servo PWM - writeMicroseconds() takes whole μs
+}
+
+template <> inline int32_t esc_output_value<DSHOT_THROTTLE>(int pulse_width) {
+  return dshot_value_from_pulse_width(pulse_width, DSHOT_3D_MODE);
+}
+
+template <> inline int32_t esc_output_value<ONESHOT125_THROTTLE>(int pulse_width) {
+  return oneshot_duty_from_pulse_width(pulse_width);
+}
+
+template <> inline int32_t esc_output_value<ONESHOT42_THROTTLE>(int pulse_width) {
+  return oneshot_duty_from_pulse_width(pulse_width);
+}
+
+template <> inline int32_t esc_output_value<MULTISHOT_THROTTLE>(int pulse_width) {
+  return oneshot_duty_from_pulse_width(pulse_width);
+}
+
+// Sends a value from esc_output_value to an ESC - specialized per ESC protocol (no-op for non-ESC throttle types)
+template <throttle_modes T> static inline void esc_write(motor_state_t *motor, int32_t value) {}
+
+template <> inline void esc_write<SERVO_PWM_THROTTLE>(motor_state_t *motor, int32_t value) {
+  if (SERVO_PWM_USE_MCPWM) {
+    servo_mcpwm_write(motor->index, value);  // output by motors_sync_output()
+  } else {
+    motor->servo->writeMicroseconds(value);
+  }
+}
+
+template <> inline void esc_write<DSHOT_THROTTLE>(motor_state_t *motor, int32_t value) {
+  dshot_write(motor->index, value);
+}
+
+template <> inline void esc_write<ONESHOT125_THROTTLE>(motor_state_t *motor, int32_t value) {
+  oneshot_write(motor->index, value);
+}
+
+template <> inline void esc_write<ONESHOT42_THROTTLE>(motor_state_t *motor, int32_t value) {
+  oneshot_write(motor->index, value);
+}
+
+template <> inline void esc_write<MULTISHOT_THROTTLE>(motor_state_t *motor, int32_t value) {
+  oneshot_write(motor->index, value);
+}
+
+static inline void write_motor_pulse_width(motor_state_t *motor, int pulse_width) {
+  motor->pulse_width = pulse_width;
+  int32_t value = esc_output_value<THROTTLE_TYPE>(pulse_width);
+  if (latch_output(motor, value)) esc_write<THROTTLE_TYPE>(motor, value);
+}
+
+static void write_motor_pulse_width(int motor_pin, int pulse_width) {
+  write_motor_pulse_width(motor_state_for_pin(motor_pin), pulse_width);
+}
+
+// Output policies - one per throttle type, selected at compile time by THROTTLE_TYPE
+// on() / coast() / off() are called from the rotation loop so they contain no THROTTLE_TYPE branches or debug output
+template <throttle_modes T> struct motor_output_policy;
+
+template <> struct motor_output_policy<BINARY_THROTTLE> {
+  static inline void on(motor_state_t *motor, float throttle_percent, bool is_translating) {
+    if (latch_output(motor, HIGH)) digitalWrite(motor->pin, HIGH);
+  }
+  static inline void coast(motor_state_t *motor) {
+    if (latch_output(motor, LOW)) digitalWrite(motor->pin, LOW);  //same as "off" for brushed motors
+  }
+  static inline void off(motor_state_t *motor) {
+    if (latch_output(motor, LOW)) digitalWrite(motor->pin, LOW);
+  }
+};
+
+template <> struct motor_output_policy<FIXED_PWM_THROTTLE> {
+  static inline void on(motor_state_t *motor, float throttle_percent, bool is_translating) {
+    if (latch_output(motor, PWM_MOTOR_ON)) analogWrite(motor->pin, PWM_MOTOR_ON);
+  }
+  static inline void coast(motor_state_t *motor) {
+    if (latch_output(motor, PWM_MOTOR_COAST)) analogWrite(motor->pin, PWM_MOTOR_COAST);
+  }
+  static inline void off(motor_state_t *motor) {
+    if (latch_output(motor, PWM_MOTOR_OFF)) analogWrite(motor->pin, PWM_MOTOR_OFF);
+  }
+};
+
+template <> struct motor_output_policy<DYNAMIC_PWM_THROTTLE> : motor_output_policy<FIXED_PWM_THROTTLE> {
+  //PWM is scaled between PWM_MOTOR_COAST and PWM_MOTOR_ON
+  //Applies over range defined by DYNAMIC_PWM_THROTTLE_PERCENT_MAX - maxed at PWM_MOTOR_ON above this
+  static inline void on(motor_state_t *motor, float throttle_percent, bool is_translating) {
+    float throttle_pwm = PWM_MOTOR_COAST + ((throttle_percent / DYNAMIC_PWM_THROTTLE_PERCENT_MAX) * (PWM_MOTOR_ON - PWM_MOTOR_COAST));
+    if (throttle_pwm > PWM_MOTOR_ON) throttle_pwm = PWM_MOTOR_ON;
+
+    // analogWrite() takes whole duty cycle steps
+    int duty = throttle_pwm;
+    if (latch_output(motor, duty)) analogWrite(motor->pin, duty);
+  }
+};
 
 // Flag to enable direct ESC control (bypasses translational drift)
 bool direct_esc_control = false;
 
+// Bi-directional ESCs (servo PWM / DShot / Oneshot) - 1500μs is neutral, only the write differs per protocol
+template <throttle_modes T> struct esc_output_policy {
+  static inline void on(motor_state_t *motor, float throttle_percent, bool is_translating) {
+    int pulse_width = 1500;
+
+    // Only proceed if throttle is actually above 0
+    if (throttle_percent > 0) {
+      if (is_translating && !direct_esc_control) {
+        // Translational movement - scaled by steering stick position (see motors_set_translation_percent)
+        pulse_width = translate_pulse_width;
+      } else {
+        // Normal spinning (no translation) or direct ESC control - use throttle directly
+        pulse_width = 1500 + (throttle_percent * 500);
+      }
+    }
+
+    motor->on_pulse_width = pulse_width;
+    write_motor_pulse_width(motor, pulse_width);
+  }
+
+  static inline void coast(motor_state_t *motor) {
+    if (SERVO_PWM_COAST_PERCENT <= 0.0f) {
+      // Use neutral (1500μs) if coast percent is zero
+      write_motor_pulse_width(motor, 1500);
+    } else {
+      // Calculate pulse width as a percentage of the powered phase throttle
+      // (scaled from the latched "on" value - scaling the current output would compound every call)
+      int throttle_range = motor->on_pulse_width - 1500;
+      write_motor_pulse_width(motor, 1500 + (throttle_range * scaled_coast_percent));
+    }
+  }
+
+  static inline void off(motor_state_t *motor) {
+    // For bi-directional ESCs, send neutral pulse width (1500μs = 0% throttle)
+    motor->on_pulse_width = 1500;
+    write_motor_pulse_width(motor, 1500);
+  }
+};
+
+template <> struct motor_output_policy<SERVO_PWM_THROTTLE> : esc_output_policy<SERVO_PWM_THROTTLE> {};
+template <> struct motor_output_policy<DSHOT_THROTTLE> : esc_output_policy<DSHOT_THROTTLE> {};
+template <> struct motor_output_policy<ONESHOT125_THROTTLE> : esc_output_policy<ONESHOT125_THROTTLE> {};
+template <> struct motor_output_policy<ONESHOT42_THROTTLE> : esc_output_policy<ONESHOT42_THROTTLE> {};
+template <> struct motor_output_policy<MULTISHOT_THROTTLE> : esc_output_policy<MULTISHOT_THROTTLE> {};
+
+typedef motor_output_policy<THROTTLE_TYPE> output_policy;
+
+// Called after motor outputs are updated at a rotation phase edge
+// Oneshot / Multishot restart their frame so the new throttle reaches the ESC without waiting for the frame to end
+// MCPWM servo output applies both motors' pulse widths together so they switch in the same frame
+void motors_sync_output() {
+  if (THROTTLE_TYPE_IS_ONESHOT) oneshot_sync_frame();
+  if (THROTTLE_TYPE == SERVO_PWM_THROTTLE && SERVO_PWM_USE_MCPWM) servo_mcpwm_update();
+}
+
+// Applies battery sag compensation to a throttle (0-1.0) - capped at full throttle
+static inline float compensate_throttle(float throttle_percent) {
+  float compensated = throttle_percent * voltage_scale;
+  return (compensated > 1.0f) ? 1.0f : compensated;
+}
+
+// Updates battery sag compensation from a filtered voltage reading (rate limited - cheap to call often)
+void motors_update_voltage_compensation() {
+  if (!BATTERY_SAG_COMPENSATION_ENABLED) return;
+
+  static unsigned long last_update = 0;
+  if (millis() - last_update < BATTERY_SAG_UPDATE_INTERVAL_MS) return;
+  last_update = millis();
+
+  float voltage = get_battery_voltage();
+  if (filtered_battery_voltage <= 0.0f) {
+    filtered_battery_voltage = voltage;
+  } else {
+    filtered_battery_voltage += (voltage - filtered_battery_voltage) * BATTERY_SAG_FILTER_WEIGHT;
+  }
+
+  // No (or implausible) battery reading - don't compensate
+  float target_scale = 1.0f;
+  if (filtered_battery_voltage >= BATTERY_SAG_MIN_VOLTAGE) {
+    target_scale = BATTERY_SAG_NOMINAL_VOLTAGE / filtered_battery_voltage;
+    target_scale = constrain(target_scale, 1.0f, BATTERY_SAG_MAX_SCALE);
+  }
+
+  // Rate limit so a current spike (brief sag) doesn't make the output lurch
+  float step = constrain(target_scale - voltage_scale, -BATTERY_SAG_MAX_SCALE_STEP, BATTERY_SAG_MAX_SCALE_STEP);
+  voltage_scale += step;
+}
+
+float motors_get_voltage_scale() {
+  return voltage_scale;
+}
+
+// Sets translation scaling used by motor_on / motor_coast (call once per melty parameter update)
+void motors_set_translation_percent(float translation_percent) {
+  translation_scale = translation_percent;
+
+  // Only scale the portion above 1.0 since 1.0 is neutral
+  float scaled_translate_percent = 1.0 + ((SERVO_PWM_TRANSLATE_PERCENT - 1.0) * translation_scale);
+  // Battery sag compensation - capped at the full translation setting
+  scaled_translate_percent = fmin(scaled_translate_percent * voltage_scale, SERVO_PWM_TRANSLATE_PERCENT);
+  translate_pulse_width = 1500 + (scaled_translate_percent * 500);
+
+  // Scale the coast percentage based on translation
+  // At translation_scale = 0: Use 1.0 (no coasting)
+  // At translation_scale = 1: Use SERVO_PWM_COAST_PERCENT (max coasting)
+  scaled_coast_percent = 1.0 * (1.0 - translation_scale) + (SERVO_PWM_COAST_PERCENT * translation_scale);
+}
+
+// Prints motor state (rate limited) - called from diagnostics rather than from the motor functions
+void motors_print_debug() {
+  if (!LOG_ENABLED(DEBUG_VERBOSE, MOTOR)) return;
+  static unsigned long last_debug = 0;
+  if (millis() - last_debug <= 500) return;
+  last_debug = millis();
+
+  for (int i = 0; i < 2; i++) {
+    const motor_state_t *motor = &motor_states[i];
+    if (THROTTLE_TYPE_IS_ESC) {
+      LOG_VERBOSE(MOTOR, "Motor %d %s - Throttle: %.2f%%, Translating: %d, Translation scale: %.2f, Coast: %.2f, Output PWM: %d μs, Writes/rotation: %u of %u",
+                   i + 1, motor->is_on ? "on" : "coast/off", motor->throttle_percent * 100, motor->is_translating,
+                   translation_scale, scaled_coast_percent, motor->pulse_width, motor->writes_last_rotation, motor->calls_last_rotation);
+    } else {
+      LOG_VERBOSE(MOTOR, "Motor %d %s - Throttle: %.2f%%, Motor pin: %d",
+                   i + 1, motor->is_on ? "on" : "coast/off", motor->throttle_percent * 100, motor->pin);
+    }
+  }
+}
+
 // Getter functions for current PWM values
 int get_motor1_pulse_width() {
-  return current_motor1_pulse_width;
+  return motor_states[0].pulse_width;
 }
 
 int get_motor2_pulse_width() {
-  return current_motor2_pulse_width;
+  return motor_states[1].pulse_width;
+}
+
+// Throttle shown in telemetry - forward part of pulse width range for ESC throttle types (1500-2000μs = 0-100%)
+static int get_motor_throttle_percent(const motor_state_t *motor) {
+  if (THROTTLE_TYPE_IS_ESC) return (motor->pulse_width > 1500) ? (motor->pulse_width - 1500) / 5 : 0;
+  return motor->is_on ? (int)(motor->throttle_percent * 100) : 0;
+}
+
+static int get_motor1_throttle_percent() {
+  return get_motor_throttle_percent(&motor_states[0]);
+}
+
+static int get_motor2_throttle_percent() {
+  return get_motor_throttle_percent(&motor_states[1]);
+}
+
+static unsigned long get_motor1_writes_per_rotation() {
+  return motor_states[0].writes_last_rotation;
+}
+
+static unsigned long get_motor2_writes_per_rotation() {
+  return motor_states[1].writes_last_rotation;
 }
 
 // Function to enable/disable direct ESC control
 void set_direct_esc_control(bool enable) {
   direct_esc_control = enable;
   if (enable) {
-    debug_print_level(DEBUG_WARNING, "MOTOR", "DIRECT ESC CONTROL ENABLED");
-    debug_print("MOTOR", "Bypassing translational drift for direct throttle testing");
+    LOG_WARNING(MOTOR, "DIRECT ESC CONTROL ENABLED");
+    LOG_INFO(MOTOR, "Bypassing translational drift for direct throttle testing");
   } else {
-    debug_print("MOTOR", "DIRECT ESC CONTROL DISABLED");
-    debug_print("MOTOR", "Returning to normal translational drift control");
+    LOG_INFO(MOTOR, "DIRECT ESC CONTROL DISABLED");
+    LOG_INFO(MOTOR, "Returning to normal translational drift control");
   }
 }
 
@@ -43,7 +337,7 @@ void set_direct_esc_control(bool enable) {
 // steering_x and steering_y should be normalized from -1.0 to 1.0
 // where (0,1)=forward, (0,-1)=backward, (1,0)=right, (-1,0)=left
 void normal_driving_mode(float steering_x, float steering_y) {
-  if (THROTTLE_TYPE != SERVO_PWM_THROTTLE) return;
+  if (!THROTTLE_TYPE_IS_ESC) return;
 
   // Apply deadzone from config
   if (fabs(steering_x) <= NORMAL_DRIVING_MODE_STEERING_DEADZONE) steering_x = 0.0;
@@ -62,24 +356,24 @@ void normal_driving_mode(float steering_x, float steering_y) {
   left_motor = constrain(left_motor, -1.0, 1.0);
   right_motor = constrain(right_motor, -1.0, 1.0);
 
+  // Battery sag compensation (scale is only updated from here when not spinning)
+  motors_update_voltage_compensation();
+  left_motor = constrain(left_motor * voltage_scale, -1.0, 1.0);
+  right_motor = constrain(right_motor * voltage_scale, -1.0, 1.0);
+
   // Map from -1.0,1.0 to pulse width (1000-2000μs)
   // 1500μs is neutral, 2000μs is full forward, 1000μs is full reverse
   int left_pulse = 1500 + (left_motor * 500);
   int right_pulse = 1500 + (right_motor * 500);
 
   // Send values to motors
-  current_motor1_pulse_width = left_pulse;
-  current_motor2_pulse_width = right_pulse;
-  motor1_servo.writeMicroseconds(left_pulse);
-  motor2_servo.writeMicroseconds(right_pulse);
+  write_motor_pulse_width(&motor_states[0], left_pulse);
+  write_motor_pulse_width(&motor_states[1], right_pulse);
+  motors_sync_output();
 
   // Debug output
-  static unsigned long last_debug = 0;
-  if (millis() - last_debug > 500) {
-    debug_printf("MOTOR", "Normal driving mode - Steering X: %.2f, Y: %.2f, Left PWM: %d, Right PWM: %d",
-                steering_x, steering_y, left_pulse, right_pulse);
-    last_debug = millis();
-  }
+  LOG_EVERY_MS(DEBUG_VERBOSE, MOTOR, 500, "Normal driving mode - Steering X: %.2f, Y: %.2f, Left PWM: %d, Right PWM: %d",
+               steering_x, steering_y, left_pulse, right_pulse);
 }
 
 // Function to directly set ESC throttle for testing
@@ -87,7 +381,7 @@ void normal_driving_mode(float steering_x, float steering_y) {
 void set_esc_throttle(float throttle_percent) {
   if (!direct_esc_control) return;
 
-  if (THROTTLE_TYPE == SERVO_PWM_THROTTLE) {
+  if (THROTTLE_TYPE_IS_ESC) {
     // Map throttle_percent (0-1.0) to pulse width (1500-2000μs)
     int pulse_width = 1500;
     if (throttle_percent > 0) {
@@ -95,30 +389,25 @@ void set_esc_throttle(float throttle_percent) {
     }
 
     // Set both ESCs to the same throttle
-    current_motor1_pulse_width = pulse_width;
-    current_motor2_pulse_width = pulse_width;
-    motor1_servo.writeMicroseconds(pulse_width);
-    motor2_servo.writeMicroseconds(pulse_width);
+    write_motor_pulse_width(&motor_states[0], pulse_width);
+    write_motor_pulse_width(&motor_states[1], pulse_width);
+    motors_sync_output();
 
-    debug_printf("MOTOR", "Direct ESC Control - Throttle: %.1f%%, PWM: %d", throttle_percent * 100, pulse_width);
+    LOG_VERBOSE(MOTOR, "Direct ESC Control - Throttle: %.1f%%, PWM: %d", throttle_percent * 100, pulse_width);
   }
 }
 
 // Function to update PWM values for diagnostics
 void update_pwm_values(int motor1_pwm, int motor2_pwm) {
-  current_motor1_pulse_width = motor1_pwm;
-  current_motor2_pulse_width = motor2_pwm;
+  motor_states[0].pulse_width = motor1_pwm;
+  motor_states[1].pulse_width = motor2_pwm;
 }
 
 // Function to directly set servo PWM values
 void set_servo_pwm(int motor_pin, int pulse_width) {
-  if (motor_pin == MOTOR_PIN1) {
-    current_motor1_pulse_width = pulse_width;
-    motor1_servo.writeMicroseconds(pulse_width);
-  } else if (motor_pin == MOTOR_PIN2) {
-    current_motor2_pulse_width = pulse_width;
-    motor2_servo.writeMicroseconds(pulse_width);
-  }
+  if (motor_pin != MOTOR_PIN1 && motor_pin != MOTOR_PIN2) return;
+  write_motor_pulse_width(motor_pin, pulse_width);
+  motors_sync_output();
 }
 
 // Function to arm or calibrate ESCs
@@ -127,36 +416,37 @@ void set_servo_pwm(int motor_pin, int pulse_width) {
 void arm_calibrate_escs(bool calibrate) {
   if (THROTTLE_TYPE != SERVO_PWM_THROTTLE) return;
 
-  // Attach servos to pins
-  motor1_servo.attach(MOTOR_PIN1);
-  motor2_servo.attach(MOTOR_PIN2);
+  if (SERVO_PWM_USE_MCPWM) {
+    init_servo_mcpwm(MOTOR_PIN1, MOTOR_PIN2);
+  } else {
+    // Attach servos to pins
+    motor1_servo.attach(MOTOR_PIN1);
+    motor2_servo.attach(MOTOR_PIN2);
+  }
 
   if (calibrate) {
     // ESC Calibration sequence
     // 1. Send max signal (this usually enters programming mode)
-    debug_print("MOTOR", "Calibration: Set throttle to maximum");
-    motor1_servo.writeMicroseconds(2000);
-    motor2_servo.writeMicroseconds(2000);
-    current_motor1_pulse_width = 2000;
-    current_motor2_pulse_width = 2000;
+    LOG_INFO(MOTOR, "Calibration: Set throttle to maximum");
+    write_motor_pulse_width(MOTOR_PIN1, 2000);
+    write_motor_pulse_width(MOTOR_PIN2, 2000);
+    motors_sync_output();
     delay(5000);
 
     // 2. Send neutral signal
-    debug_print("MOTOR", "Calibration: Set throttle to neutral");
-    motor1_servo.writeMicroseconds(1500);
-    motor2_servo.writeMicroseconds(1500);
-    current_motor1_pulse_width = 1500;
-    current_motor2_pulse_width = 1500;
+    LOG_INFO(MOTOR, "Calibration: Set throttle to neutral");
+    write_motor_pulse_width(MOTOR_PIN1, 1500);
+    write_motor_pulse_width(MOTOR_PIN2, 1500);
+    motors_sync_output();
     delay(5000);
 
-    debug_print("MOTOR", "Calibration complete - ESCs should now be calibrated");
+    LOG_INFO(MOTOR, "Calibration complete - ESCs should now be calibrated");
   } else {
     // Normal arming sequence
     // Start with neutral signal
-    motor1_servo.writeMicroseconds(1500);
-    motor2_servo.writeMicroseconds(1500);
-    current_motor1_pulse_width = 1500;
-    current_motor2_pulse_width = 1500;
+    write_motor_pulse_width(MOTOR_PIN1, 1500);
+    write_motor_pulse_width(MOTOR_PIN2, 1500);
+    motors_sync_output();
     delay(1000);  // Give ESCs time to initialize
   }
 }
@@ -165,194 +455,126 @@ void arm_calibrate_escs(bool calibrate) {
 //motor_X_coast functions are used for the unpowered phase of each rotation
 //motor_X_off functions are used for when the robot is spun-down
 
-void motor_on(float throttle_percent, int motor_pin, bool is_translating) {
-
-  // Debug output every 500ms
-  static unsigned long last_debug = 0;
-  if (millis() - last_debug > 500) {
-    debug_printf("MOTOR", "Motor_on called - Throttle percent: %.2f%%, Motor pin: %d, Translating: %d",
-               throttle_percent * 100, motor_pin, is_translating);
-    last_debug = millis();
-  }
-
-  if (THROTTLE_TYPE == BINARY_THROTTLE) {
-    digitalWrite(motor_pin, HIGH);
-  }
-
-  if (THROTTLE_TYPE == FIXED_PWM_THROTTLE) {
-    analogWrite(motor_pin, PWM_MOTOR_ON);
-  }
-
-  //If DYNAMIC_PWM_THROTTLE - PWM is scaled between PWM_MOTOR_COAST and PWM_MOTOR_ON
-  //Applies over range defined by DYNAMIC_PWM_THROTTLE_PERCENT_MAX - maxed at PWM_MOTOR_ON above this
-  if (THROTTLE_TYPE == DYNAMIC_PWM_THROTTLE) {
-    float throttle_pwm = PWM_MOTOR_COAST + ((throttle_percent / DYNAMIC_PWM_THROTTLE_PERCENT_MAX) * (PWM_MOTOR_ON - PWM_MOTOR_COAST));
-    if (throttle_pwm > PWM_MOTOR_ON) throttle_pwm = PWM_MOTOR_ON;
-    analogWrite(motor_pin, throttle_pwm);
-  }
-
-  if (THROTTLE_TYPE == SERVO_PWM_THROTTLE) {
-    // For standard RC servo PWM with bi-directional ESCs
-    int pulse_width = 1500;
+static inline void motor_state_on(motor_state_t *motor, float throttle_percent, bool is_translating) {
+  throttle_percent = compensate_throttle(throttle_percent);
+  motor->calls++;
+  motor->throttle_percent = throttle_percent;
+  motor->is_translating = is_translating;
+  motor->is_on = true;
+  output_policy::on(motor, throttle_percent, is_translating);
+}
 
-    // Only proceed if throttle is actually above 0
-    if (throttle_percent > 0) {
-      if (direct_esc_control) {
-        // Direct ESC control mode - just use throttle directly
-        pulse_width = 1500 + (throttle_percent * 500);
-      }
-      else if (is_translating) {
-        // Translational movement - scale by steering stick position
-        float translation_scale = rc_get_translation_percent();
-        // Only scale the portion above 1.0 since 1.0 is neutral
-        float scaled_translate_percent = 1.0 + ((SERVO_PWM_TRANSLATE_PERCENT - 1.0) * translation_scale);
-        pulse_width = 1500 + (scaled_translate_percent * 500);
-      }
-      else {
-        // Normal spinning (no translation) - use throttle directly
-      pulse_width = 1500 + (throttle_percent * 500);
-      }
-    }
+static inline void motor_state_coast(motor_state_t *motor) {
+  motor->calls++;
+  motor->is_on = false;
+  output_policy::coast(motor);
+}
 
-    // Debug pulse width calculation
-    if (millis() - last_debug > 500) {
-      if (is_translating) {
-        float translation_scale = rc_get_translation_percent();
-        // Only scale the portion above 1.0 since 1.0 is neutral
-        float scaled_translate_percent = 1.0 + ((SERVO_PWM_TRANSLATE_PERCENT - 1.0) * translation_scale);
-        debug_printf("MOTOR", "Translation mode - Input throttle: %.2f%%, Scale: %.2f, SERVO_PWM_TRANSLATE_PERCENT: %.2f, Scaled: %.2f, Output PWM: %d μs",
-                    throttle_percent * 100, translation_scale, SERVO_PWM_TRANSLATE_PERCENT,
-                    scaled_translate_percent, pulse_width);
-      } else {
-        debug_printf("MOTOR", "Spin mode - Input throttle: %.2f%%, Output PWM: %d μs",
-                    throttle_percent * 100, pulse_width);
-      }
-    }
+static inline void motor_state_off(motor_state_t *motor) {
+  motor->calls++;
+  motor->throttle_percent = 0.0f;
+  motor->is_on = false;
+  output_policy::off(motor);
+}
 
-    if (motor_pin == MOTOR_PIN1) {
-      current_motor1_pulse_width = pulse_width;
-      motor1_servo.writeMicroseconds(pulse_width);
-    } else if (motor_pin == MOTOR_PIN2) {
-      current_motor2_pulse_width = pulse_width;
-      motor2_servo.writeMicroseconds(pulse_width);
-    }
-  }
+void motor_on(float throttle_percent, int motor_pin, bool is_translating) {
+  motor_state_on(motor_state_for_pin(motor_pin), throttle_percent, is_translating);
 }
 
 void motor_1_on(float throttle_percent, bool is_translating) {
-  motor_on(throttle_percent, MOTOR_PIN1, is_translating);
+  motor_state_on(&motor_states[0], throttle_percent, is_translating);
 }
 
 void motor_2_on(float throttle_percent, bool is_translating) {
-  motor_on(throttle_percent, MOTOR_PIN2, is_translating);
+  motor_state_on(&motor_states[1], throttle_percent, is_translating);
 }
 
 void motor_coast(int motor_pin) {
-  if (THROTTLE_TYPE == FIXED_PWM_THROTTLE || THROTTLE_TYPE == DYNAMIC_PWM_THROTTLE) {
-    analogWrite(motor_pin, PWM_MOTOR_COAST);
-  }
-  if (THROTTLE_TYPE == BINARY_THROTTLE) {
-    digitalWrite(motor_pin, LOW);  //same as "off" for brushed motors
-  }
-  if (THROTTLE_TYPE == SERVO_PWM_THROTTLE) {
-    // Get the translation percentage scaling factor
-    float translation_scale = rc_get_translation_percent();
-
-    // For bi-directional ESCs, handle coast mode based on SERVO_PWM_COAST_PERCENT
-    if (motor_pin == MOTOR_PIN1) {
-      if (SERVO_PWM_COAST_PERCENT <= 0.0f) {
-        // Use neutral (1500μs) if coast percent is zero
-        current_motor1_pulse_width = 1500;
-        motor1_servo.writeMicroseconds(1500);
-      } else {
-        // Scale the coast percentage based on translation
-        // At translation_scale = 0: Use 1.0 (no coasting)
-        // At translation_scale = 1: Use SERVO_PWM_COAST_PERCENT (max coasting)
-        float scaled_coast_percent = 1.0 * (1.0 - translation_scale) + (SERVO_PWM_COAST_PERCENT * translation_scale);
-
-        // Calculate pulse width as a percentage of the current throttle
-        int pulse_width = 1500;
-        int throttle_range = current_motor1_pulse_width - 1500;
-        pulse_width = 1500 + (throttle_range * scaled_coast_percent);
-
-        // Debug output every 500ms
-        static unsigned long last_debug = 0;
-        if (millis() - last_debug > 500) {
-          debug_printf("MOTOR", "Coast mode - Scale: %.2f, Original Coast: %.2f, Scaled Coast: %.2f, PWM: %d μs",
-                     translation_scale, SERVO_PWM_COAST_PERCENT, scaled_coast_percent, pulse_width);
-          last_debug = millis();
-        }
-
-        current_motor1_pulse_width = pulse_width;
-        motor1_servo.writeMicroseconds(pulse_width);
-      }
-    } else if (motor_pin == MOTOR_PIN2) {
-      if (SERVO_PWM_COAST_PERCENT <= 0.0f) {
-        // Use neutral (1500μs) if coast percent is zero
-        current_motor2_pulse_width = 1500;
-        motor2_servo.writeMicroseconds(1500);
-      } else {
-        // Scale the coast percentage based on translation
-        // At translation_scale = 0: Use 1.0 (no coasting)
-        // At translation_scale = 1: Use SERVO_PWM_COAST_PERCENT (max coasting)
-        float scaled_coast_percent = 1.0 * (1.0 - translation_scale) + (SERVO_PWM_COAST_PERCENT * translation_scale);
-
-        // Calculate pulse width as a percentage of the current throttle
-        int pulse_width = 1500;
-        int throttle_range = current_motor2_pulse_width - 1500;
-        pulse_width = 1500 + (throttle_range * scaled_coast_percent);
-        current_motor2_pulse_width = pulse_width;
-        motor2_servo.writeMicroseconds(pulse_width);
-      }
-    }
-  }
+  motor_state_coast(motor_state_for_pin(motor_pin));
 }
 
 void motor_1_coast() {
-  motor_coast(MOTOR_PIN1);
+  motor_state_coast(&motor_states[0]);
 }
 
 void motor_2_coast() {
-  motor_coast(MOTOR_PIN2);
+  motor_state_coast(&motor_states[1]);
 }
 
 void motor_off(int motor_pin) {
-  if (THROTTLE_TYPE == FIXED_PWM_THROTTLE || THROTTLE_TYPE == DYNAMIC_PWM_THROTTLE) {
-    analogWrite(motor_pin, PWM_MOTOR_OFF);
-  }
-  if (THROTTLE_TYPE == BINARY_THROTTLE) {
-    digitalWrite(motor_pin, LOW);  //same as "off" for brushed motors
-  }
-  if (THROTTLE_TYPE == SERVO_PWM_THROTTLE) {
-    // For bi-directional ESCs, send neutral pulse width (1500μs = 0% throttle)
-    if (motor_pin == MOTOR_PIN1) {
-      current_motor1_pulse_width = 1500;
-      motor1_servo.writeMicroseconds(1500);
-    } else if (motor_pin == MOTOR_PIN2) {
-      current_motor2_pulse_width = 1500;
-      motor2_servo.writeMicroseconds(1500);
-    }
-  }
+  motor_state_off(motor_state_for_pin(motor_pin));
 }
 
 void motor_1_off() {
-  motor_off(MOTOR_PIN1);
+  motor_state_off(&motor_states[0]);
 }
 
 void motor_2_off() {
-  motor_off(MOTOR_PIN2);
+  motor_state_off(&motor_states[1]);
 }
 
 void motors_off() {
   motor_1_off();
   motor_2_off();
+  motors_sync_output();
+}
+
+// Latches call / write counts for the rotation just completed
+void motors_rotation_complete() {
+  for (int i = 0; i < 2; i++) {
+    motor_states[i].calls_last_rotation = motor_states[i].calls;
+    motor_states[i].writes_last_rotation = motor_states[i].writes;
+    motor_states[i].calls = 0;
+    motor_states[i].writes = 0;
+  }
+}
+
+unsigned int motors_get_calls_per_rotation(int motor_index) {
+  return motor_states[motor_index].calls_last_rotation;
+}
+
+unsigned int motors_get_writes_per_rotation(int motor_index) {
+  return motor_states[motor_index].writes_last_rotation;
+}
+
+// Times the motor calls made by the rotation loop (results are written to debug output)
+// Outputs ARE driven - only run with ESCs unpowered / motors disconnected
+void motor_benchmark() {
+  const unsigned long iterations = 10000;
+  float saved_translation_scale = translation_scale;
+  motors_set_translation_percent(1.0f);
+
+  // Translating - one motor powered / one coasting
+  unsigned long start_us = micros();
+  for (unsigned long i = 0; i < iterations; i++) {
+    motor_1_on(0.5f, true);
+    motor_2_coast();
+    motors_sync_output();
+  }
+  unsigned long translate_us = micros() - start_us;
+
+  // Spinning without translation - both motors powered
+  start_us = micros();
+  for (unsigned long i = 0; i < iterations; i++) {
+    motor_1_on(0.5f, false);
+    motor_2_on(0.5f, false);
+    motors_sync_output();
+  }
+  unsigned long spin_us = micros() - start_us;
+
+  motors_set_translation_percent(saved_translation_scale);
+  motors_off();
+
+  // 2 motor calls per iteration
+  LOG_INFO(MOTOR, "Motor benchmark (THROTTLE_TYPE %d) - translating: %lu ns per call, spinning: %lu ns per call",
+               (int)THROTTLE_TYPE, (translate_us * 1000UL) / (iterations * 2), (spin_us * 1000UL) / (iterations * 2));
 }
 
 void init_motors() {
-  debug_print("MOTOR", "Initializing motor drivers...");
+  LOG_INFO(MOTOR, "Initializing motor drivers...");
 
   if (THROTTLE_TYPE == SERVO_PWM_THROTTLE) {
-    debug_print("MOTOR", "Using SERVO_PWM_THROTTLE mode");
+    LOG_INFO(MOTOR, "Using SERVO_PWM_THROTTLE mode (%s)", SERVO_PWM_USE_MCPWM ? "MCPWM" : "ESP32Servo");
 
     // First explicitly set pins as outputs for safety
     pinMode(MOTOR_PIN1, OUTPUT);
@@ -362,21 +584,52 @@ void init_motors() {
     arm_calibrate_escs(false);
 
     // Double-check neutral values are set
-    debug_print("MOTOR", "Setting motors to neutral position");
-    motor1_servo.writeMicroseconds(1500);
-    motor2_servo.writeMicroseconds(1500);
-    current_motor1_pulse_width = 1500;
-    current_motor2_pulse_width = 1500;
-
-    debug_printf("MOTOR", "Motors initialized - PWM1: %d, PWM2: %d",
-                current_motor1_pulse_width, current_motor2_pulse_width);
+    LOG_INFO(MOTOR, "Setting motors to neutral position");
+    write_motor_pulse_width(MOTOR_PIN1, 1500);
+    write_motor_pulse_width(MOTOR_PIN2, 1500);
+    motors_sync_output();
+
+    LOG_INFO(MOTOR, "Motors initialized - PWM1: %d, PWM2: %d",
+                get_motor1_pulse_width(), get_motor2_pulse_width());
+  } else if (THROTTLE_TYPE == DSHOT_THROTTLE) {
+    LOG_INFO(MOTOR, "Using DSHOT_THROTTLE mode (DShot%d, 3D: %d)", DSHOT_SPEED, DSHOT_3D_MODE);
+
+    // RMT starts sending the stop command immediately - ESCs arm after receiving it for a short time
+    init_dshot(MOTOR_PIN1, MOTOR_PIN2);
+    write_motor_pulse_width(MOTOR_PIN1, 1500);
+    write_motor_pulse_width(MOTOR_PIN2, 1500);
+    delay(DSHOT_ARM_TIME_MS);
+
+    LOG_INFO(MOTOR, "DShot ESCs armed");
+  } else if (THROTTLE_TYPE_IS_ONESHOT) {
+    LOG_INFO(MOTOR, "Using Oneshot / Multishot throttle mode");
+
+    // Oneshot ESCs arm on a neutral signal like servo PWM ESCs
+    init_oneshot(MOTOR_PIN1, MOTOR_PIN2);
+    write_motor_pulse_width(MOTOR_PIN1, 1500);
+    write_motor_pulse_width(MOTOR_PIN2, 1500);
+    motors_sync_output();
+    delay(1000);  // Give ESCs time to initialize
   } else {
     // For non-servo throttle types
-    debug_print("MOTOR", "Using non-servo throttle mode");
+    LOG_INFO(MOTOR, "Using non-servo throttle mode");
     pinMode(MOTOR_PIN1, OUTPUT);
     pinMode(MOTOR_PIN2, OUTPUT);
   }
   // Ensure motors are off
   motors_off();
-  debug_print("MOTOR", "Motors set to off state");
+  LOG_INFO(MOTOR, "Motors set to off state");
+
+  telemetry_register_int("motor1Throttle", "%", get_motor1_throttle_percent);
+  telemetry_register_int("motor2Throttle", "%", get_motor2_throttle_percent);
+  if (THROTTLE_TYPE_IS_ESC) {
+    telemetry_register_int_ptr("motor1PulseWidth", "us", &motor_states[0].pulse_width);
+    telemetry_register_int_ptr("motor2PulseWidth", "us", &motor_states[1].pulse_width);
+  }
+  // Peripheral writes in last rotation (writes are only made when a motor's output value changes)
+  telemetry_register_ulong("motor1WritesPerRotation", "", get_motor1_writes_per_rotation);
+  telemetry_register_ulong("motor2WritesPerRotation", "", get_motor2_writes_per_rotation);
+  if (BATTERY_SAG_COMPENSATION_ENABLED) {
+    telemetry_register_float_ptr("sagCompensation", "", 3, &voltage_scale);
+  }
 }
@@ -41,3 +41,29 @@ void motors_off();
 void motor_1_coast();
 void motor_2_coast();
 
+//call after motor_X_on / motor_X_coast at each step of a rotation (starts new Oneshot / Multishot frame at phase edges)
+void motors_sync_output();
+
+//sets translation scaling (0-1 steering stick distance from center) used by ESC throttle types - call once per melty parameter update
+void motors_set_translation_percent(float translation_percent);
+
+//battery sag compensation (BATTERY_SAG_COMPENSATION_ENABLED) - reads battery voltage at most every BATTERY_SAG_UPDATE_INTERVAL_MS
+//call once per melty parameter update - motor throttle is scaled by nominal / filtered voltage (capped / rate limited)
+void motors_update_voltage_compensation();
+
+//current throttle scale applied by battery sag compensation (1.0 = none)
+float motors_get_voltage_scale();
+
+//call at end of each rotation - latches motor call / peripheral write counts for that rotation
+void motors_rotation_complete();
+
+//motor_X_on / coast / off calls and actual peripheral writes (only made when output value changes) in the last rotation
+unsigned int motors_get_calls_per_rotation(int motor_index);
+unsigned int motors_get_writes_per_rotation(int motor_index);
+
+//prints motor state to debug output (rate limited - motor functions themselves don't print)
+void motors_print_debug();
+
+//times motor_X_on / motor_X_coast calls and prints result (drives outputs - ESCs must be unpowered)
+void motor_benchmark();
+
@@ -0,0 +1,150 @@
+//this module generates Oneshot125 / Oneshot42 / Multishot pulses for the ESCs using the ESP32 LEDC peripheral
+//(only initialized when THROTTLE_TYPE is ONESHOT125_THROTTLE, ONESHOT42_THROTTLE or MULTISHOT_THROTTLE)
+
+#include <Arduino.h>
+#include "melty_config.h"
+#include "oneshot.h"
+#include "debug_handler.h"
+#include "driver/ledc.h"
+#include "soc/ledc_struct.h"
+
+#define ONESHOT_LEDC_MODE LEDC_LOW_SPEED_MODE        //ESP32-S3 only has low speed mode
+#define ONESHOT_LEDC_CLOCK_HZ 80000000UL             //APB clock
+#define ONESHOT_LEDC_MAX_RESOLUTION_BITS 14
+
+#define ONESHOT_MIN_LOW_TIME_NS 2000                  //signal must go low between pulses (even at full throttle)
+#define ONESHOT_SYNC_END_MARGIN_NS 2000               //no restart this close to the end of a frame (next pulse could start before the reset)
+
+static const ledc_channel_t oneshot_channels[ONESHOT_MOTOR_COUNT] = {
+  ONESHOT_LEDC_CHANNEL_MOTOR1,
+  ONESHOT_LEDC_CHANNEL_MOTOR2
+};
+
+static uint32_t frame_rate_hz = ONESHOT_FRAME_RATE_HZ;
+static uint32_t resolution_bits = ONESHOT_LEDC_MAX_RESOLUTION_BITS;
+static uint32_t sync_end_margin_duty = 0;
+
+static uint32_t duties[ONESHOT_MOTOR_COUNT] = { 0, 0 };
+
+static bool sync_pending = false;
+static uint32_t longest_replaced_duty = 0;         //pulses replaced since last sync may still be in progress
+
+//pulse range (ns) of selected protocol
+static void get_protocol_range_ns(uint32_t *min_ns, uint32_t *max_ns) {
+  if (THROTTLE_TYPE == ONESHOT42_THROTTLE) {
+    *min_ns = 42000;
+    *max_ns = 84000;
+  } else if (THROTTLE_TYPE == MULTISHOT_THROTTLE) {
+    *min_ns = 5000;
+    *max_ns = 25000;
+  } else {
+    *min_ns = 125000;
+    *max_ns = 250000;
+  }
+}
+
+uint32_t oneshot_pulse_ns_from_pulse_width(int pulse_width) {
+  uint32_t min_ns, max_ns;
+  get_protocol_range_ns(&min_ns, &max_ns);
+
+  if (pulse_width < 1000) pulse_width = 1000;
+  if (pulse_width > 2000) pulse_width = 2000;
+
+  return min_ns + (((uint32_t)(pulse_width - 1000) * (max_ns - min_ns)) / 1000);
+}
+
+static uint32_t duty_from_pulse_ns(uint32_t ns) {
+  return (uint32_t)(((uint64_t)ns * frame_rate_hz * (1UL << resolution_bits)) / 1000000000ULL);
+}
+
+uint32_t oneshot_duty_from_pulse_width(int pulse_width) {
+  return duty_from_pulse_ns(oneshot_pulse_ns_from_pulse_width(pulse_width));
+}
+
+void oneshot_write(int motor_index, uint32_t duty) {
+  if (duty == duties[motor_index]) return;
+
+  //LEDC latches new duty at start of next frame
+  ledc_set_duty(ONESHOT_LEDC_MODE, oneshot_channels[motor_index], duty);
+  ledc_update_duty(ONESHOT_LEDC_MODE, oneshot_channels[motor_index]);
+
+  if (duties[motor_index] > longest_replaced_duty) longest_replaced_duty = duties[motor_index];
+  duties[motor_index] = duty;
+  sync_pending = true;
+}
+
+void oneshot_sync_frame() {
+  if (!ONESHOT_SYNC_TO_ROTATION || !sync_pending) return;
+
+  //don't cut a pulse short - ESC would see a lower throttle (retried on next call)
+  uint32_t longest_duty = longest_replaced_duty;
+  for (int motor = 0; motor < ONESHOT_MOTOR_COUNT; motor++) {
+    if (duties[motor] > longest_duty) longest_duty = duties[motor];
+  }
+
+  //position in the frame comes from the LEDC timer itself (micros() isn't locked to the LEDC clock so an estimate would drift)
+  //pulses start at count 0 (hpoint) and end at count = duty
+  uint32_t count = LEDC.timer_group[ONESHOT_LEDC_MODE].timer[ONESHOT_LEDC_TIMER].value.timer_cnt;
+  if (count <= longest_duty + 1) return;
+  if (count >= (1UL << resolution_bits) - sync_end_margin_duty) return;
+
+  //restarting the shared timer starts a new frame (with the new duty) on both motors now
+  ledc_timer_rst(ONESHOT_LEDC_MODE, ONESHOT_LEDC_TIMER);
+  sync_pending = false;
+  longest_replaced_duty = 0;
+}
+
+uint32_t oneshot_get_frame_rate_hz() {
+  return frame_rate_hz;
+}
+
+void init_oneshot(int motor1_pin, int motor2_pin) {
+  uint32_t min_ns, max_ns;
+  get_protocol_range_ns(&min_ns, &max_ns);
+
+  //full throttle pulse plus a low period must fit in each frame
+  uint32_t max_frame_rate_hz = 1000000000UL / (max_ns + ONESHOT_MIN_LOW_TIME_NS);
+  frame_rate_hz = ONESHOT_FRAME_RATE_HZ;
+  if (frame_rate_hz > max_frame_rate_hz) {
+    LOG_WARNING(MOTOR, "ONESHOT_FRAME_RATE_HZ too high for protocol - using %u Hz", max_frame_rate_hz);
+    frame_rate_hz = max_frame_rate_hz;
+  }
+
+  //highest resolution supported at this frame rate
+  resolution_bits = ONESHOT_LEDC_MAX_RESOLUTION_BITS;
+  while (resolution_bits > 1 && ((uint64_t)frame_rate_hz << resolution_bits) > ONESHOT_LEDC_CLOCK_HZ) resolution_bits--;
+  sync_end_margin_duty = duty_from_pulse_ns(ONESHOT_SYNC_END_MARGIN_NS) + 1;
+
+  ledc_timer_config_t timer_config = {};
+  timer_config.speed_mode = ONESHOT_LEDC_MODE;
+  timer_config.duty_resolution = (ledc_timer_bit_t)resolution_bits;
+  timer_config.timer_num = ONESHOT_LEDC_TIMER;
+  timer_config.freq_hz = frame_rate_hz;
+  timer_config.clk_cfg = LEDC_AUTO_CLK;
+
+  esp_err_t result = ledc_timer_config(&timer_config);
+  if (result != ESP_OK) {
+    LOG_ERROR(MOTOR, "Oneshot LEDC timer init failed: %s", esp_err_to_name(result));
+    return;
+  }
+
+  const int pins[ONESHOT_MOTOR_COUNT] = { motor1_pin, motor2_pin };
+  for (int motor = 0; motor < ONESHOT_MOTOR_COUNT; motor++) {
+    ledc_channel_config_t channel_config = {};
+    channel_config.gpio_num = pins[motor];
+    channel_config.speed_mode = ONESHOT_LEDC_MODE;
+    channel_config.channel = oneshot_channels[motor];
+    channel_config.intr_type = LEDC_INTR_DISABLE;
+    channel_config.timer_sel = ONESHOT_LEDC_TIMER;
+    channel_config.duty = 0;
+    channel_config.hpoint = 0;
+
+    result = ledc_channel_config(&channel_config);
+    if (result != ESP_OK) {
+      LOG_ERROR(MOTOR, "Oneshot LEDC channel init failed for motor %d: %s", motor + 1, esp_err_to_name(result));
+    }
+  }
+
+  LOG_INFO(MOTOR, "Oneshot output started - %u Hz frame rate, %u bit resolution (%u ns per step)",
+               frame_rate_hz, resolution_bits, (uint32_t)(1000000000ULL / ((uint64_t)frame_rate_hz << resolution_bits)));
+}
@@ -0,0 +1,31 @@
+#ifndef ONESHOT_H
+#define ONESHOT_H
+
+#include <stdint.h>
+
+//Oneshot125 / Oneshot42 / Multishot ESC protocols generated by an LEDC timer (shared by both motors)
+//Same signal as servo PWM - but with much shorter pulses sent at a much higher frame rate (ONESHOT_FRAME_RATE_HZ)
+//With ONESHOT_SYNC_TO_ROTATION the frame is restarted when throttle changes so the ESC sees it at the phase edge (not up to a frame later)
+
+#define ONESHOT_MOTOR_COUNT 2
+
+//converts a servo-style pulse width (1000-2000us) to a pulse length in ns for the selected protocol (THROTTLE_TYPE)
+uint32_t oneshot_pulse_ns_from_pulse_width(int pulse_width);
+
+//configures LEDC timer / channels for both motors
+void init_oneshot(int motor1_pin, int motor2_pin);
+
+//converts a servo-style pulse width to an LEDC duty value (the resolution of the generated pulse)
+uint32_t oneshot_duty_from_pulse_width(int pulse_width);
+
+//sets duty (from oneshot_duty_from_pulse_width) of pulse sent to a motor (motor_index 0 or 1) - only touches LEDC if value changed
+void oneshot_write(int motor_index, uint32_t duty);
+
+//restarts the frame if pulses changed since last call (waits until any pulse in progress has finished)
+//call after updating both motors - cheap if nothing changed
+void oneshot_sync_frame();
+
+//returns actual frame rate (may be lower than ONESHOT_FRAME_RATE_HZ if a full throttle pulse would not fit)
+uint32_t oneshot_get_frame_rate_hz();
+
+#endif // ONESHOT_H
@@ -1,15 +1,20 @@
 //See melty_config.h for configuration parameters
 
 #include "rc_handler.h"
+#include "rc_curves.h"
 #include "melty_config.h"
 #include "motor_driver.h"
 #include "accel_handler.h"
 #include "spin_control.h"
 #include "config_storage.h"
 #include "led_driver.h"
+#include "led_patterns.h"
 #include "battery_monitor.h"
+#include "adc_sampler.h"
 #include "web_server.h"
 #include "debug_handler.h"
+#include "latency_tracer.h"
+#include "flight_log.h"
 #include <WiFi.h>
 #include <WebServer.h>
 #include <math.h>  // For fabs() function used in normal driving mode
@@ -41,8 +46,7 @@ static void wait_for_rc_good_and_zero_throttle() {
     while (rc_signal_is_healthy() == false || rc_get_throttle_percent() > 0) {
 
       //"slow on/off" for LED while waiting for signal
-      heading_led_on(0); delay(250);
-      heading_led_off(); delay(250);
+      led_pattern_show(LED_PATTERN_WAITING_FOR_SIGNAL);
 
       //services watchdog and echo diagnostics while we are waiting for RC signal
       service_watchdog();
@@ -61,18 +65,20 @@ void setup() {
   // Initialize debug handler first before any debug calls
   init_debug_handler();
 
-  debug_print("SYSTEM", "*** OpenMelt starting up... ***");
+  LOG_INFO(SYSTEM, "*** OpenMelt starting up... ***");
 
   //get motor drivers setup (and off!) first thing
   init_motors();
   init_led();
+  init_adc_sampler();   //battery voltage / current sampled in background from here on
+  init_battery_monitor();
 
 #ifdef ENABLE_WATCHDOG
   //returns actual watchdog timeout MS
-  debug_print("SYSTEM", "Enabling watchdog with increased timeout");
+  LOG_INFO(SYSTEM, "Enabling watchdog with increased timeout");
   // Use a longer timeout for initial setup
   int watchdog_ms = Watchdog.enable(WATCH_DOG_TIMEOUT_MS); // Increased from 2000ms
-  debug_printf("SYSTEM", "Watchdog timeout set to: %d ms", watchdog_ms);
+  LOG_INFO(SYSTEM, "Watchdog timeout set to: %d ms", watchdog_ms);
 #endif
 
   init_rc();
@@ -81,21 +87,28 @@ void setup() {
   init_accel();   //accelerometer uses i2c - which can fail blocking (so only initializing it -after- the watchdog is running)
   service_watchdog(); // Reset watchdog
 
+  init_spin_control();
+
+#ifdef ENABLE_FLIGHT_LOG
+  init_flight_log();
+#endif
+
 //load settings on boot
 #ifdef ENABLE_EEPROM_STORAGE
-  debug_print("SYSTEM", "Initializing EEPROM for persistent storage");
+  LOG_INFO(SYSTEM, "Initializing EEPROM for persistent storage");
   // Initialize EEPROM first before loading settings
   init_eeprom();
   service_watchdog(); // Reset watchdog
 
-  debug_print("SYSTEM", "Loading stored configuration");
+  LOG_INFO(SYSTEM, "Loading stored configuration");
   load_melty_config_settings();
+  load_rc_curve_settings();
   service_watchdog(); // Reset watchdog
 #endif
 
 #ifdef ENABLE_WIFI
   // Setup WiFi - using longer delays to ensure stability
-  debug_print("WIFI", "Setting up WiFi Access Point...");
+  LOG_INFO(WIFI, "Setting up WiFi Access Point...");
 
   // Complete WiFi reset
   WiFi.disconnect(true);
@@ -111,7 +124,7 @@ void setup() {
   delay(500);
 
   // Set WiFi mode explicitly
-  debug_print("WIFI", "Setting WiFi mode to AP");
+  LOG_INFO(WIFI, "Setting WiFi mode to AP");
   WiFi.mode(WIFI_AP);
   service_watchdog(); // Reset watchdog
   delay(500);
@@ -119,39 +132,39 @@ void setup() {
 #ifdef DISABLE_WIFI_POWER_SAVE
   // Disable power saving mode to prevent random GPIO signals
   WiFi.setSleep(false);
-  debug_print("WIFI", "WiFi power saving mode disabled");
+  LOG_INFO(WIFI, "WiFi power saving mode disabled");
   service_watchdog(); // Reset watchdog
   delay(100);
 #endif
 
   // Create the access point with configured power level
-  debug_printf("WIFI", "Creating access point with SSID: %s", ssid);
+  LOG_INFO(WIFI, "Creating access point with SSID: %s", ssid);
   WiFi.setTxPower(WIFI_POWER_LEVEL); // Use configured power level
   bool apStarted = WiFi.softAP(ssid, password);
   service_watchdog(); // Reset watchdog
   delay(500); // More time for AP to stabilize
 
   if (apStarted) {
-    debug_print("WIFI", "Access point created successfully");
+    LOG_INFO(WIFI, "Access point created successfully");
     IPAddress IP = WiFi.softAPIP();
-    debug_printf("WIFI", "AP IP address: %s", IP.toString().c_str());
+    LOG_INFO(WIFI, "AP IP address: %s", IP.toString().c_str());
   } else {
-    debug_print_level(DEBUG_ERROR, "WIFI", "Failed to create access point!");
+    LOG_ERROR(WIFI, "Failed to create access point!");
   }
   service_watchdog(); // Reset watchdog
 
   // Initialize web server
-  debug_print("SYSTEM", "Starting web server task...");
+  LOG_INFO(SYSTEM, "Starting web server task...");
   init_web_server();
   service_watchdog(); // Reset watchdog
 #else
-  debug_print("WIFI", "WiFi disabled by configuration");
+  LOG_INFO(WIFI, "WiFi disabled by configuration");
 #endif // ENABLE_WIFI
 
   // Give system time to stabilize before continuing
   delay(500);
 
-  debug_print("SYSTEM", "Setup complete!");
+  LOG_INFO(SYSTEM, "Setup complete!");
 
 //if JUST_DO_DIAGNOSTIC_LOOP - then we just loop and display debug info via USB (good for testing)
 #ifdef JUST_DO_DIAGNOSTIC_LOOP
@@ -162,6 +175,17 @@ void setup() {
   }
 #endif
 
+//if JUST_DO_MOTOR_BENCHMARK - then we just loop timing motor output and log calls (results in debug output)
+#ifdef JUST_DO_MOTOR_BENCHMARK
+  while (1) {
+    service_watchdog();
+    motor_benchmark();
+    debug_log_benchmark();
+    echo_diagnostics();
+    delay(1000);
+  }
+#endif
+
 #if defined(VERIFY_RC_THROTTLE_ZERO_AT_BOOT)
   wait_for_rc_good_and_zero_throttle();     //Wait for good RC signal at zero throttle
   delay(MAX_MS_BETWEEN_RC_UPDATES + 1);     //Wait for first RC signal to have expired
@@ -170,7 +194,7 @@ void setup() {
 
 }
 
-//dumps out diagnostics info
+//keeps diagnostics current while not spinning (debug output itself is printed by the log task on core 0)
 static void echo_diagnostics() {
   // Don't update diagnostics too frequently - at most once every 100ms
   unsigned long current_time = millis();
@@ -179,70 +203,99 @@ static void echo_diagnostics() {
   }
   last_diagnostic_update = current_time;
 
-  // Use the new debug handler to update and get diagnostics
-  update_standard_diagnostics();
+  // Reading the accelerometer keeps its telemetry current while not spinning (telemetry reads the cached axes)
+  get_accel_force_g();
 }
 
 //Used to flash out max recorded RPM 100's of RPMs
-static void display_rpm_if_requested() {
-  //triggered by user pushing throttle up while bot is at idle for 750ms
-  if (rc_get_forback_enum() == RC_FORBACK_FORWARD) {
-    delay(750);
-     //verify throttle at zero to prevent accidental entry into RPM flash
-    if (rc_get_forback_enum() == RC_FORBACK_FORWARD && rc_get_throttle_percent() == 0) {
-
-      //throttle up cancels RPM count
-      for (int x = 0; x < get_max_rpm() && rc_get_throttle_percent() == 0; x = x + 100) {
-        service_watchdog();   //flashing out RPM can take a while - need to assure watchdog doesn't trigger
-        delay(600); heading_led_on(0);
-        delay(20); heading_led_off();
+//returns true while the count is being flashed out (LED pattern is in use)
+static bool display_rpm_if_requested() {
+  static bool flashing = false;
+  static bool forward_held = false;
+  static unsigned long forward_start_ms = 0;
+
+  if (flashing) {
+    //throttle up cancels RPM count
+    if (rc_get_throttle_percent() > 0) {
+      flashing = false;
+      return false;
+    }
+
+    //flash-out punctuated with pause to make clear RPM count has completed
+    if (led_pattern_finished()) {
+      if (led_pattern_get() == LED_PATTERN_RPM_FLASH) {
+        led_pattern_start(LED_PATTERN_RPM_FLASH_END, 1);
+      } else {
+        flashing = false;
+        return false;
       }
-      delay(1500);  //flash-out punctuated with delay to make clear RPM count has completed
     }
+    led_pattern_show(led_pattern_get());
+    return true;
+  }
+
+  //triggered by user pushing throttle up while bot is at idle for 750ms
+  if (rc_get_forback_enum() != RC_FORBACK_FORWARD) {
+    forward_held = false;
+    return false;
+  }
+  if (forward_held == false) {
+    forward_held = true;
+    forward_start_ms = millis();
+    return false;
+  }
+
+  //verify throttle at zero to prevent accidental entry into RPM flash
+  if (millis() - forward_start_ms >= 750 && rc_get_throttle_percent() == 0) {
+    forward_held = false;
+    flashing = true;
+    led_pattern_start(LED_PATTERN_RPM_FLASH, (get_max_rpm() + 99) / 100);
+    led_pattern_show(LED_PATTERN_RPM_FLASH);
+    return true;
   }
+  return false;
 }
 
 //checks if user has requested to enter / exit config mode
-// DISABLED: Config mode is now only accessible via the web UI
+//config mode is toggled from the web UI or by flipping an RC_FUNCTION_CONFIG_TOGGLE switch (if mapped)
+//switch flips are only acted on while idle - entering config mode samples the accelerometer 0g offset (bot must be still)
 static void check_config_mode() {
-  // Config mode toggle is now handled via web UI button only
-  // This prevents accidental config mode entry during normal/melty driving
-
-  /* Original RC controller config mode check - DISABLED
-  if (rc_get_forback_enum() == RC_FORBACK_BACKWARD) {
-    delay(5000); // 5 second delay - config delay
-    if (rc_get_forback_enum() == RC_FORBACK_BACKWARD) {
-      toggle_config_mode();
-      if (get_config_mode() == false) save_melty_config_settings();    //save melty settings on config mode exit
-
-      //wait for user to release stick - so we don't re-toggle modes
-      while (rc_get_forback_enum() == RC_FORBACK_BACKWARD) {
-        service_watchdog();
-      }
-    }
+  static bool switch_position_known = false;
+  static bool last_switch_position = false;
+
+  if (rc_function_is_mapped(RC_FUNCTION_CONFIG_TOGGLE) == false) return;
+
+  bool switch_position = rc_get_state()->config_switch;
+
+  //don't treat the switch position at boot as a flip
+  if (switch_position_known == false) {
+    last_switch_position = switch_position;
+    switch_position_known = true;
+    return;
+  }
+
+  if (switch_position != last_switch_position) {
+    last_switch_position = switch_position;
+    toggle_config_mode();
+    if (get_config_mode() == false) save_melty_config_settings();    //save melty settings on config mode exit
+    LOG_INFO(SYSTEM, "Config mode %s via RC switch", get_config_mode() ? "ENABLED" : "DISABLED");
   }
-  */
 }
 
 //handles the bot when not spinning (with RC good)
 static void handle_bot_idle() {
     // Original idle behavior
     motors_off();               //assure motors are off
+    flight_log_idle();          //flight log blocks can be written to flash (stalls this loop briefly)
 
-    //normal LED "fast flash" - indicates RC signal is good while sitting idle
-    heading_led_on(0); delay(30);
-    heading_led_off(); delay(120);
+    check_config_mode();          //check if user requests we enter / exit config mode
 
-    //if in config mode blip LED again to show "double-flash"
-    if (get_config_mode() == true) {
-        heading_led_off(); delay(400);
-        heading_led_on(0); delay(30);
-        heading_led_off(); delay(140);
+    //flashes out RPM if user has requested - otherwise normal LED "fast flash" indicates RC signal is good while sitting idle
+    //(in config mode LED "double-flashes")
+    if (display_rpm_if_requested() == false) {
+        led_pattern_show(get_config_mode() ? LED_PATTERN_IDLE_CONFIG : LED_PATTERN_IDLE);
     }
 
-    check_config_mode();          //check if user requests we enter / exit config mode
-    display_rpm_if_requested();   //flashed out RPM if user has requested
-
     echo_diagnostics();           //echo diagnostics if bot is idle
 }
 
@@ -256,15 +309,18 @@ void loop() {
   static unsigned long last_steering_active_time = 0;
   static unsigned long last_throttle_active_time = 0;
 
+  // Decode all RC channels once for this pass
+  const struct rc_state_t *rc_state = rc_update_state();
+
   // Check if RC is healthy before reading values
-  if (!rc_signal_is_healthy()) {
+  if (!rc_state->healthy) {
     // If RC signal is not healthy, ensure motors are off
     motors_off();
+    flight_log_idle();
     in_normal_driving_mode = false;
 
     // Show slow flash for no signal
-    heading_led_on(0); delay(30);
-    heading_led_off(); delay(600);
+    led_pattern_show(LED_PATTERN_NO_SIGNAL);
 
     //services watchdog and echo diagnostics while we are waiting for RC signal
     service_watchdog();
@@ -272,9 +328,16 @@ void loop() {
     return; // Skip the rest of the loop until RC is healthy
   }
 
+  // Arm switch off (if mapped) - no spinning or driving
+  if (!rc_state->armed) {
+    in_normal_driving_mode = false;
+    handle_bot_idle();
+    return;
+  }
+
   // RC signal is healthy, proceed with normal operation
   // Get throttle with deadzone
-  int throttle_percent = rc_get_throttle_percent();
+  int throttle_percent = rc_state->throttle_percent;
   bool throttle_is_zero = (throttle_percent <= THROTTLE_DEADZONE_PERCENT);
 
   // If throttle has been activated, record the time
@@ -292,8 +355,8 @@ void loop() {
     // Throttle is zero, determine if we should be in normal driving mode or idle
 
     // Get steering stick values
-    float steering_x = rc_get_leftright() / 450.0;  // Normalize to -1.0 to 1.0 range
-    float steering_y = rc_get_forback() / 450.0;    // Normalize to -1.0 to 1.0 range
+    float steering_x = rc_state->leftright / 450.0;  // Normalize to -1.0 to 1.0 range
+    float steering_y = rc_state->forback / 450.0;    // Normalize to -1.0 to 1.0 range
 
     // Apply deadzone
     bool steering_x_active = (fabs(steering_x) > NORMAL_DRIVING_MODE_STEERING_DEADZONE);
@@ -313,18 +376,17 @@ void loop() {
     if (in_normal_driving_mode) {
       if (steering_x_active || steering_y_active) {
         // Continue normal driving mode
-        if (THROTTLE_TYPE == SERVO_PWM_THROTTLE) {
+        if (THROTTLE_TYPE_IS_ESC) {
           // Zero out steering values inside deadzone for smoother control
           if (fabs(steering_x) <= NORMAL_DRIVING_MODE_STEERING_DEADZONE) steering_x = 0.0;
           if (fabs(steering_y) <= NORMAL_DRIVING_MODE_STEERING_DEADZONE) steering_y = 0.0;
 
           normal_driving_mode(steering_x, steering_y);
 
+          latency_record(LATENCY_STAGE_MOTOR, rc_state->frame_timestamp_us, micros());
+
           // LED pattern - quick double blink for driving mode
-          heading_led_on(0); delay(20);
-          heading_led_off(); delay(80);
-          heading_led_on(0); delay(20);
-          heading_led_off(); delay(120);
+          led_pattern_show(LED_PATTERN_DRIVING);
         } else {
           // If not using servo PWM, fall back to idle mode
           in_normal_driving_mode = false;
@@ -339,14 +401,12 @@ void loop() {
       }
       else {
         // Steering is inactive but timeout hasn't elapsed, stay in driving mode
-        if (THROTTLE_TYPE == SERVO_PWM_THROTTLE) {
+        if (THROTTLE_TYPE_IS_ESC) {
           normal_driving_mode(0.0, 0.0);  // Zero inputs to stop movement
+          latency_record(LATENCY_STAGE_MOTOR, rc_state->frame_timestamp_us, micros());
 
           // LED pattern - quick double blink for driving mode
-          heading_led_on(0); delay(20);
-          heading_led_off(); delay(80);
-          heading_led_on(0); delay(20);
-          heading_led_off(); delay(120);
+          led_pattern_show(LED_PATTERN_DRIVING);
         } else {
           // If not using servo PWM, fall back to idle mode
           in_normal_driving_mode = false;
@@ -360,18 +420,17 @@ void loop() {
         // Steering is active, switch to driving mode
         in_normal_driving_mode = true;
 
-        if (THROTTLE_TYPE == SERVO_PWM_THROTTLE) {
+        if (THROTTLE_TYPE_IS_ESC) {
           // Zero out steering values inside deadzone for smoother control
           if (fabs(steering_x) <= NORMAL_DRIVING_MODE_STEERING_DEADZONE) steering_x = 0.0;
           if (fabs(steering_y) <= NORMAL_DRIVING_MODE_STEERING_DEADZONE) steering_y = 0.0;
 
           normal_driving_mode(steering_x, steering_y);
 
+          latency_record(LATENCY_STAGE_MOTOR, rc_state->frame_timestamp_us, micros());
+
           // LED pattern - quick double blink for driving mode
-          heading_led_on(0); delay(20);
-          heading_led_off(); delay(80);
-          heading_led_on(0); delay(20);
-          heading_led_off(); delay(120);
+          led_pattern_show(LED_PATTERN_DRIVING);
         } else {
           // If not using servo PWM, fall back to idle mode
           in_normal_driving_mode = false;
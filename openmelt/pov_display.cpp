@@ -0,0 +1,232 @@
+//this module draws persistence-of-vision content with the RGB LEDs while spinning
+//content is drawn into a polar framebuffer (column bitmasks) outside the rotation loop timing - rendering is just a lookup
+
+#include <Arduino.h>
+#include "melty_config.h"
+#include "pov_display.h"
+#include "led_driver.h"
+#include "spin_control.h"
+#include "battery_monitor.h"
+#include "debug_handler.h"
+
+#if USE_RGB_LED
+#define POV_LED_COUNT NUM_RGB_LEDS
+#else
+#define POV_LED_COUNT 1
+#endif
+
+#define POV_BYTES_PER_COLUMN ((POV_LED_COUNT + 7) / 8)
+
+#define POV_FONT_WIDTH 3
+#define POV_FONT_HEIGHT 5
+
+static_assert(POV_ANGLE_BINS <= 255, "POV_ANGLE_BINS must fit in bitmap header");
+
+//3x5 digits - one byte per column, bit 0 = top row
+static const uint8_t pov_font_digits[10][POV_FONT_WIDTH] = {
+  { 0x1F, 0x11, 0x1F },   //0
+  { 0x00, 0x1F, 0x00 },   //1
+  { 0x1D, 0x15, 0x17 },   //2
+  { 0x15, 0x15, 0x1F },   //3
+  { 0x07, 0x04, 0x1F },   //4
+  { 0x17, 0x15, 0x1D },   //5
+  { 0x1F, 0x15, 0x1D },   //6
+  { 0x01, 0x01, 0x1F },   //7
+  { 0x1F, 0x15, 0x1F },   //8
+  { 0x17, 0x15, 0x1F }    //9
+};
+
+static const char *pov_content_names[POV_CONTENT_COUNT] = { "off", "image", "rpm", "battery" };
+
+static pov_content_t content = POV_CONTENT_OFF;
+
+//framebuffer used by pov_render (only touched on core 1)
+static uint32_t columns[POV_ANGLE_BINS] = {};
+static uint32_t column_color = 0;
+
+//copy of the framebuffer taken after each redraw - read by pov_get_bitmap (web server task on core 0)
+static portMUX_TYPE snapshot_mux = portMUX_INITIALIZER_UNLOCKED;
+static uint32_t snapshot_columns[POV_ANGLE_BINS] = {};
+static uint32_t snapshot_color = 0;
+
+//uploaded image - written by web server task, copied by pov_update
+static portMUX_TYPE image_mux = portMUX_INITIALIZER_UNLOCKED;
+static uint32_t image_columns[POV_ANGLE_BINS] = {};
+static uint32_t image_color = 0xFFFFFF;
+static volatile bool image_changed = false;
+
+static unsigned long last_redraw = 0;
+
+const char *pov_content_name(pov_content_t content) {
+  if (content < 0 || content >= POV_CONTENT_COUNT) return "unknown";
+  return pov_content_names[content];
+}
+
+void pov_set_content(pov_content_t new_content) {
+  if (new_content < 0 || new_content >= POV_CONTENT_COUNT) return;
+  content = new_content;
+  image_changed = true;   //forces redraw at next pov_update
+  LOG_INFO(POV, "POV content: %s", pov_content_name(content));
+}
+
+pov_content_t pov_get_content() {
+  return content;
+}
+
+bool pov_is_active() {
+  return content != POV_CONTENT_OFF;
+}
+
+//font row (0 = top) to LED - top of glyphs is furthest from center
+static int get_row_led(int row) {
+  //LEDs sample font rows if there are fewer LEDs than rows
+  int led = (row * POV_LED_COUNT) / POV_FONT_HEIGHT;
+  if (POV_LED_COUNT > POV_FONT_HEIGHT) led = row;
+  return POV_LED0_IS_OUTER ? led : (POV_LED_COUNT - 1 - led);
+}
+
+static uint32_t get_glyph_column_mask(uint8_t glyph_column) {
+  uint32_t mask = 0;
+  for (int row = 0; row < POV_FONT_HEIGHT; row++) {
+    if (glyph_column & (1 << row)) mask |= 1UL << get_row_led(row);
+  }
+  return mask;
+}
+
+//draws a number centered on the heading (columns run clockwise - left to right when read from outside the robot)
+static void draw_number(int value) {
+  char digits[8];
+  int length = snprintf(digits, sizeof(digits), "%d", value);
+  int width = (length * (POV_FONT_WIDTH + 1)) - 1;
+  int start_bin = POV_ANGLE_BINS - (width / 2);
+
+  for (int i = 0; i < length; i++) {
+    if (digits[i] < '0' || digits[i] > '9') continue;
+    for (int x = 0; x < POV_FONT_WIDTH; x++) {
+      int bin = (start_bin + (i * (POV_FONT_WIDTH + 1)) + x) % POV_ANGLE_BINS;
+      columns[bin] = get_glyph_column_mask(pov_font_digits[digits[i] - '0'][x]);
+    }
+  }
+}
+
+//arc from heading - length proportional to charge (red / yellow / green)
+static void draw_battery_gauge() {
+  float charge = (get_battery_voltage() - POV_BATTERY_EMPTY_VOLTAGE) / (POV_BATTERY_FULL_VOLTAGE - POV_BATTERY_EMPTY_VOLTAGE);
+  charge = constrain(charge, 0.0f, 1.0f);
+
+  int filled_bins = charge * POV_ANGLE_BINS;
+  for (int bin = 0; bin < filled_bins; bin++) columns[bin] = (1UL << POV_LED_COUNT) - 1;
+
+  if (charge > 0.5f) {
+    column_color = 0x00FF00;
+  } else if (charge > 0.2f) {
+    column_color = 0xFFFF00;
+  } else {
+    column_color = 0xFF0000;
+  }
+}
+
+static void redraw() {
+  memset(columns, 0, sizeof(columns));
+  column_color = 0xFFFFFF;
+
+  switch (content) {
+    case POV_CONTENT_IMAGE:
+      portENTER_CRITICAL(&image_mux);
+      memcpy(columns, image_columns, sizeof(columns));
+      column_color = image_color;
+      portEXIT_CRITICAL(&image_mux);
+      break;
+    case POV_CONTENT_RPM:
+      column_color = getColorValue(RGB_LED_COLOR);
+      draw_number(get_current_rpm());
+      break;
+    case POV_CONTENT_BATTERY:
+      draw_battery_gauge();
+      break;
+    default:
+      break;
+  }
+
+  led_set_column_color(column_color);
+
+  portENTER_CRITICAL(&snapshot_mux);
+  memcpy(snapshot_columns, columns, sizeof(snapshot_columns));
+  snapshot_color = column_color;
+  portEXIT_CRITICAL(&snapshot_mux);
+}
+
+void pov_update() {
+  if (content == POV_CONTENT_OFF) return;
+
+  bool live_content = (content == POV_CONTENT_RPM || content == POV_CONTENT_BATTERY);
+  if (!image_changed && !(live_content && millis() - last_redraw >= POV_REDRAW_INTERVAL_MS)) return;
+
+  image_changed = false;
+  last_redraw = millis();
+  redraw();
+}
+
+void pov_render(unsigned long time_spent_this_rotation_us, unsigned long rotation_interval_us, unsigned long heading_offset_us) {
+  unsigned long phase_us = (time_spent_this_rotation_us + rotation_interval_us - heading_offset_us) % rotation_interval_us;
+  int bin = (phase_us * POV_ANGLE_BINS) / rotation_interval_us;
+
+  //LED driver only sends a frame if the column differs from the last one requested
+  led_show_column(columns[bin]);
+}
+
+bool pov_load_bitmap(const uint8_t *data, size_t length) {
+  if (length < POV_BITMAP_HEADER_SIZE || memcmp(data, "POV1", 4) != 0) return false;
+
+  int bins = data[4];
+  int leds = data[5];
+  int bytes_per_column = (leds + 7) / 8;
+  if (bins == 0 || leds == 0 || leds > 32 || length < POV_BITMAP_HEADER_SIZE + ((size_t)bins * bytes_per_column)) return false;
+
+  //resample to framebuffer size (nearest bin / LED)
+  uint32_t loaded_columns[POV_ANGLE_BINS];
+  for (int bin = 0; bin < POV_ANGLE_BINS; bin++) {
+    const uint8_t *column = &data[POV_BITMAP_HEADER_SIZE + (((bin * bins) / POV_ANGLE_BINS) * bytes_per_column)];
+    uint32_t mask = 0;
+    for (int led = 0; led < POV_LED_COUNT; led++) {
+      int source_led = (led * leds) / POV_LED_COUNT;
+      if (column[source_led / 8] & (1 << (source_led % 8))) mask |= 1UL << led;
+    }
+    loaded_columns[bin] = mask;
+  }
+
+  portENTER_CRITICAL(&image_mux);
+  memcpy(image_columns, loaded_columns, sizeof(image_columns));
+  image_color = ((uint32_t)data[6] << 16) | ((uint32_t)data[7] << 8) | data[8];
+  portEXIT_CRITICAL(&image_mux);
+  image_changed = true;
+
+  LOG_INFO(POV, "POV image loaded (%d bins x %d LEDs)", bins, leds);
+  return true;
+}
+
+size_t pov_get_bitmap(uint8_t *buffer, size_t buffer_size) {
+  size_t length = POV_BITMAP_HEADER_SIZE + (POV_ANGLE_BINS * POV_BYTES_PER_COLUMN);
+  if (buffer_size < length) return 0;
+
+  //framebuffer may be mid-redraw on core 1 - use the last complete one
+  uint32_t bitmap_columns[POV_ANGLE_BINS];
+  uint32_t bitmap_color;
+  portENTER_CRITICAL(&snapshot_mux);
+  memcpy(bitmap_columns, snapshot_columns, sizeof(bitmap_columns));
+  bitmap_color = snapshot_color;
+  portEXIT_CRITICAL(&snapshot_mux);
+
+  memcpy(buffer, "POV1", 4);
+  buffer[4] = POV_ANGLE_BINS;
+  buffer[5] = POV_LED_COUNT;
+  buffer[6] = (bitmap_color >> 16) & 0xFF;
+  buffer[7] = (bitmap_color >> 8) & 0xFF;
+  buffer[8] = bitmap_color & 0xFF;
+
+  for (int bin = 0; bin < POV_ANGLE_BINS; bin++) {
+    uint8_t *column = &buffer[POV_BITMAP_HEADER_SIZE + (bin * POV_BYTES_PER_COLUMN)];
+    for (int byte = 0; byte < POV_BYTES_PER_COLUMN; byte++) column[byte] = (bitmap_columns[bin] >> (byte * 8)) & 0xFF;
+  }
+  return length;
+}
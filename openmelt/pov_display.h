@@ -0,0 +1,50 @@
+#ifndef POV_DISPLAY_H
+#define POV_DISPLAY_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+//persistence-of-vision display - the RGB LEDs draw an image as the robot spins
+//framebuffer is polar: POV_ANGLE_BINS columns per rotation (bin 0 starts at the heading) x NUM_RGB_LEDS rows
+//each column is a bitmask of lit LEDs (one color per image)
+//
+//bitmap format (web upload / download, tools/pov_tool.py):
+//  "POV1" | angle bins (1 byte) | LED count (1 byte) | color R, G, B (3 bytes) | columns
+//  each column is (LED count + 7) / 8 bytes, LSB of first byte = LED 0 (first in chain) - columns run clockwise from heading
+//  images with a different bin / LED count are resampled to POV_ANGLE_BINS / NUM_RGB_LEDS
+
+#define POV_BITMAP_HEADER_SIZE 9
+#define POV_BITMAP_MAX_SIZE (POV_BITMAP_HEADER_SIZE + (255 * 4))
+
+enum pov_content_t {
+  POV_CONTENT_OFF = 0,            //normal heading LED
+  POV_CONTENT_IMAGE,              //uploaded bitmap
+  POV_CONTENT_RPM,                //current RPM in digits
+  POV_CONTENT_BATTERY,            //battery gauge (arc length = charge)
+  POV_CONTENT_COUNT
+};
+
+//selects what is drawn while spinning
+void pov_set_content(pov_content_t content);
+pov_content_t pov_get_content();
+const char *pov_content_name(pov_content_t content);
+
+//loads a bitmap (see format above) to be shown as POV_CONTENT_IMAGE - safe to call from web server task
+//returns false if data isn't a valid bitmap
+bool pov_load_bitmap(const uint8_t *data, size_t length);
+
+//writes current framebuffer (as of the last redraw) in bitmap format - safe to call from web server task
+//returns length written (0 if buffer too small)
+size_t pov_get_bitmap(uint8_t *buffer, size_t buffer_size);
+
+//applies uploads / redraws RPM and battery content (rate limited) - call once per melty parameter update
+void pov_update();
+
+//returns true if POV content is being drawn (heading LED is replaced)
+bool pov_is_active();
+
+//lights the column for the current point in the rotation - only does integer math / requests a LED update if column changed
+//(safe to call on every pass of rotation loop)
+void pov_render(unsigned long time_spent_this_rotation_us, unsigned long rotation_interval_us, unsigned long heading_offset_us);
+
+#endif // POV_DISPLAY_H
@@ -0,0 +1,199 @@
+//this module compiles RC input curves into lookup tables
+//tables are rebuilt (outside the control loop) whenever a curve changes - typically from the web UI
+//two copies of each table are kept so a rebuild never exposes a half-written table to the control loop
+
+#include <Arduino.h>
+#include "melty_config.h"
+#include "rc_handler.h"
+#include "rc_curves.h"
+#include "config_storage.h"
+#include "debug_handler.h"
+
+//one entry per microsecond of valid RC pulse length
+#define RC_CURVE_TABLE_SIZE (MAX_RC_PULSE_LENGTH - MIN_RC_PULSE_LENGTH + 1)
+
+static rc_curve_t curves[RC_CURVE_COUNT];
+
+static uint8_t throttle_tables[2][RC_CURVE_TABLE_SIZE];
+static int16_t steering_tables[2][RC_CURVE_TABLE_SIZE];
+
+//index of table currently used by the control loop
+static volatile int active_throttle_table = 0;
+static volatile int active_steering_table = 0;
+
+static rc_curve_t default_curve(rc_curve_channel_enum channel) {
+  rc_curve_t curve = {};
+  if (channel == RC_CURVE_THROTTLE) {
+    //defaults match previous fixed mapping - standard TX uses IDLE-FULL range
+    //bidirectional TX sending ~1500us at minimum stick is handled by the neutral window around center
+    curve.min_us = IDLE_THROTTLE_PULSE_LENGTH;
+    curve.center_us = CENTER_LEFTRIGHT_PULSE_LENGTH;
+    curve.max_us = FULL_THROTTLE_PULSE_LENGTH;
+    curve.deadband_us = 50;
+  } else {
+    //full stick deflection is half of NOMINAL_PULSE_RANGE either side of center
+    curve.min_us = CENTER_LEFTRIGHT_PULSE_LENGTH - (NOMINAL_PULSE_RANGE / 2);
+    curve.center_us = CENTER_LEFTRIGHT_PULSE_LENGTH;
+    curve.max_us = CENTER_LEFTRIGHT_PULSE_LENGTH + (NOMINAL_PULSE_RANGE / 2);
+    curve.deadband_us = LR_NORMAL_DEADZONE_WIDTH;
+  }
+  curve.expo_percent = 0;
+  curve.curve_points = 0;
+  return curve;
+}
+
+//applies expo or custom curve to normalized stick position
+//x is 0 to 1 for unipolar channels, -1 to 1 for bipolar channels
+static float shape_input(const rc_curve_t *curve, float x, bool bipolar) {
+  if (curve->curve_points >= 2) {
+    //custom curve points are evenly spaced over the input range
+    float input_min = bipolar ? -1.0f : 0.0f;
+    float position = (x - input_min) / (1.0f - input_min) * (curve->curve_points - 1);
+    int segment = (int)position;
+    if (segment >= curve->curve_points - 1) segment = curve->curve_points - 2;
+    if (segment < 0) segment = 0;
+    float fraction = position - segment;
+    float y0 = curve->curve[segment] / (float)RC_CURVE_OUTPUT_MAX;
+    float y1 = curve->curve[segment + 1] / (float)RC_CURVE_OUTPUT_MAX;
+    return y0 + ((y1 - y0) * fraction);
+  }
+
+  float expo = curve->expo_percent / 100.0f;
+  return ((1.0f - expo) * x) + (expo * x * x * x);
+}
+
+//throttle - returns 0 to 1
+static float evaluate_throttle(const rc_curve_t *curve, int pulse_length) {
+  if (pulse_length <= curve->min_us) return 0.0f;
+
+  float x;
+  int neutral_top = curve->center_us + curve->deadband_us;
+  if (curve->deadband_us > 0 && abs(pulse_length - curve->center_us) <= curve->deadband_us) {
+    //bidirectional transmitter at minimum stick
+    return 0.0f;
+  } else if (curve->deadband_us > 0 && pulse_length > neutral_top) {
+    x = (float)(pulse_length - neutral_top) / (float)(curve->max_us - neutral_top);
+  } else {
+    x = (float)(pulse_length - curve->min_us) / (float)(curve->max_us - curve->min_us);
+  }
+
+  x = constrain(x, 0.0f, 1.0f);
+  return constrain(shape_input(curve, x, false), 0.0f, 1.0f);
+}
+
+//steering - returns -1 to 1
+static float evaluate_steering(const rc_curve_t *curve, int pulse_length) {
+  int offset = pulse_length - curve->center_us;
+  if (abs(offset) <= curve->deadband_us) return 0.0f;
+
+  float x;
+  if (offset > 0) {
+    x = (float)(offset - curve->deadband_us) / (float)(curve->max_us - curve->center_us - curve->deadband_us);
+  } else {
+    x = (float)(offset + curve->deadband_us) / (float)(curve->center_us - curve->min_us - curve->deadband_us);
+  }
+
+  x = constrain(x, -1.0f, 1.0f);
+  return constrain(shape_input(curve, x, true), -1.0f, 1.0f);
+}
+
+//rebuilds the inactive table for a channel - then makes it active
+static void build_table(rc_curve_channel_enum channel) {
+  const rc_curve_t *curve = &curves[channel];
+
+  if (channel == RC_CURVE_THROTTLE) {
+    int target = 1 - active_throttle_table;
+    for (int i = 0; i < RC_CURVE_TABLE_SIZE; i++) {
+      //small bias keeps exact multiples (ie 100%) from truncating down due to float error
+      throttle_tables[target][i] = (uint8_t)((evaluate_throttle(curve, i + MIN_RC_PULSE_LENGTH) * 100.0f) + 0.0001f);
+    }
+    active_throttle_table = target;
+  } else {
+    int target = 1 - active_steering_table;
+    for (int i = 0; i < RC_CURVE_TABLE_SIZE; i++) {
+      steering_tables[target][i] = (int16_t)lroundf(evaluate_steering(curve, i + MIN_RC_PULSE_LENGTH) * RC_CURVE_OUTPUT_MAX);
+    }
+    active_steering_table = target;
+  }
+}
+
+static bool curve_is_valid(rc_curve_channel_enum channel, const rc_curve_t *curve) {
+  if (curve->min_us < MIN_RC_PULSE_LENGTH || curve->max_us > MAX_RC_PULSE_LENGTH) return false;
+  if (curve->deadband_us < 0 || curve->expo_percent < 0 || curve->expo_percent > 100) return false;
+  if (curve->curve_points != 0 && (curve->curve_points < 2 || curve->curve_points > RC_CURVE_MAX_POINTS)) return false;
+
+  if (channel == RC_CURVE_THROTTLE) {
+    if (curve->max_us <= curve->min_us) return false;
+    //neutral window must leave room for a throttle range above it
+    if (curve->deadband_us > 0 && curve->center_us + curve->deadband_us >= curve->max_us) return false;
+  } else {
+    if (curve->center_us - curve->deadband_us <= curve->min_us) return false;
+    if (curve->center_us + curve->deadband_us >= curve->max_us) return false;
+  }
+
+  int output_min = (channel == RC_CURVE_THROTTLE) ? 0 : -RC_CURVE_OUTPUT_MAX;
+  for (int i = 0; i < curve->curve_points; i++) {
+    if (curve->curve[i] < output_min || curve->curve[i] > RC_CURVE_OUTPUT_MAX) return false;
+  }
+  return true;
+}
+
+void init_rc_curves() {
+  for (int channel = 0; channel < RC_CURVE_COUNT; channel++) {
+    curves[channel] = default_curve((rc_curve_channel_enum)channel);
+    build_table((rc_curve_channel_enum)channel);
+  }
+}
+
+void load_rc_curve_settings() {
+#ifdef ENABLE_EEPROM_STORAGE
+  rc_curve_t stored[RC_CURVE_COUNT];
+  if (load_rc_curves(stored, RC_CURVE_COUNT) == false) return;
+
+  for (int channel = 0; channel < RC_CURVE_COUNT; channel++) {
+    if (curve_is_valid((rc_curve_channel_enum)channel, &stored[channel])) {
+      curves[channel] = stored[channel];
+      build_table((rc_curve_channel_enum)channel);
+    } else {
+      LOG_WARNING(RC, "Stored curve %d invalid - using default", channel);
+    }
+  }
+#endif
+}
+
+void save_rc_curve_settings() {
+#ifdef ENABLE_EEPROM_STORAGE
+  save_rc_curves(curves, RC_CURVE_COUNT);
+#endif
+}
+
+rc_curve_t rc_curve_get(rc_curve_channel_enum channel) {
+  return curves[channel];
+}
+
+bool rc_curve_set(rc_curve_channel_enum channel, const rc_curve_t *curve) {
+  if (channel < 0 || channel >= RC_CURVE_COUNT) return false;
+  if (curve_is_valid(channel, curve) == false) return false;
+  curves[channel] = *curve;
+  build_table(channel);
+  return true;
+}
+
+void rc_curve_reset(rc_curve_channel_enum channel) {
+  curves[channel] = default_curve(channel);
+  build_table(channel);
+}
+
+static inline int table_index(unsigned long pulse_length) {
+  if (pulse_length <= MIN_RC_PULSE_LENGTH) return 0;
+  if (pulse_length >= MAX_RC_PULSE_LENGTH) return RC_CURVE_TABLE_SIZE - 1;
+  return pulse_length - MIN_RC_PULSE_LENGTH;
+}
+
+int rc_curve_throttle_percent(unsigned long pulse_length) {
+  return throttle_tables[active_throttle_table][table_index(pulse_length)];
+}
+
+int rc_curve_steering_permille(unsigned long pulse_length) {
+  return steering_tables[active_steering_table][table_index(pulse_length)];
+}
@@ -0,0 +1,52 @@
+#ifndef RC_CURVES_H
+#define RC_CURVES_H
+
+#include <stdint.h>
+
+//Per-channel input curves (endpoints / deadband / expo / custom curve) for throttle and steering
+//Each curve is compiled into a lookup table indexed by pulse width in microseconds
+//so mapping a pulse in the control loop is a single array read (no branches / divides)
+
+#define RC_CURVE_MAX_POINTS 9                   //maximum number of points in a custom (piecewise-linear) curve
+#define RC_CURVE_OUTPUT_MAX 1000                //curve outputs are in permille (steering: -1000 to 1000, throttle: 0 to 1000)
+
+typedef enum {
+  RC_CURVE_THROTTLE = 0,                        //unipolar: 0 to 100% throttle
+  RC_CURVE_STEERING = 1,                        //bipolar: full left (-) to full right (+)
+  RC_CURVE_COUNT
+} rc_curve_channel_enum;
+
+//curve definition for a single channel (all pulse lengths in microseconds)
+typedef struct rc_curve_t {
+  int16_t min_us;                               //pulse length for 0% throttle / full left
+  int16_t center_us;                            //neutral pulse length (throttle: center of bidirectional TX neutral window)
+  int16_t max_us;                               //pulse length for 100% throttle / full right
+  int16_t deadband_us;                          //+/- around center_us treated as neutral (0 disables for throttle)
+  int8_t expo_percent;                          //0 = linear, 100 = fully cubic (ignored if custom curve is used)
+  int8_t curve_points;                          //0 = no custom curve, otherwise 2 to RC_CURVE_MAX_POINTS
+  int16_t curve[RC_CURVE_MAX_POINTS];           //custom curve outputs (permille) at evenly spaced stick positions
+} rc_curve_t;
+
+//resets curves to defaults (from rc_handler.h / melty_config.h) and builds lookup tables
+void init_rc_curves();
+
+//loads curves from EEPROM (if previously saved) and rebuilds lookup tables
+void load_rc_curve_settings();
+
+//saves current curves to EEPROM
+void save_rc_curve_settings();
+
+//returns the current curve definition for a channel
+rc_curve_t rc_curve_get(rc_curve_channel_enum channel);
+
+//validates / applies a new curve definition (returns false if rejected)
+bool rc_curve_set(rc_curve_channel_enum channel, const rc_curve_t *curve);
+
+//restores default curve for a channel
+void rc_curve_reset(rc_curve_channel_enum channel);
+
+//table lookups - pulse_length is in microseconds (values outside valid RC range are clamped)
+int rc_curve_throttle_percent(unsigned long pulse_length);    //0 to 100
+int rc_curve_steering_permille(unsigned long pulse_length);   //-1000 to 1000
+
+#endif // RC_CURVES_H
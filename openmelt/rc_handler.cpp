@@ -4,6 +4,8 @@
 #include "Arduino.h"
 #include "melty_config.h"
 #include "debug_handler.h"
+#include "rc_curves.h"
+#include "telemetry_registry.h"
 #include <math.h>  // For sqrt function
 
 #define RC_DATA_UNLOCKED 0
@@ -14,32 +16,41 @@ static int rc_data_lock_state = RC_DATA_UNLOCKED;
 //config / current values for each RC channel
 struct rc_channel_t {
   int pin;                        //pin channel is connected to
+  rc_channel_function function;   //role assigned to this channel in RC_CHANNEL_MAP
   unsigned long pulse_length;     //most recent pulse length in us
   unsigned long pulse_start_time; //time stamp of when RC pin last went high
   unsigned long last_good_signal; //time stamp (MS) of when last pulse of valid length was received
+  unsigned long last_pulse_end;   //time stamp (US) of when last pulse of valid length ended (tags RC frames for latency tracing)
 };
 
-static struct rc_channel_t forback_rc_channel = {
-  .pin = FORBACK_RC_CHANNEL_PIN,
-  .pulse_length = MIN_RC_PULSE_LENGTH,
-  .pulse_start_time = 0,
-  .last_good_signal = 0
+//channel map from melty_config.h
+struct rc_channel_map_t {
+  int pin;
+  rc_channel_function function;
 };
 
-static struct rc_channel_t leftright_rc_channel = {
-  .pin = LEFTRIGHT_RC_CHANNEL_PIN,
-  .pulse_length = MIN_RC_PULSE_LENGTH,
-  .pulse_start_time = 0,
-  .last_good_signal = 0
-};
+static const struct rc_channel_map_t rc_channel_map[] = RC_CHANNEL_MAP;
+
+#define RC_CHANNEL_COUNT (sizeof(rc_channel_map) / sizeof(rc_channel_map[0]))
 
-static struct rc_channel_t throttle_rc_channel = {
-  .pin = THROTTLE_RC_CHANNEL_PIN,
-  .pulse_length = MIN_RC_PULSE_LENGTH,
+static struct rc_channel_t rc_channels[RC_CHANNEL_COUNT];
+
+//functions that aren't in RC_CHANNEL_MAP point at this (always neutral / never healthy)
+static struct rc_channel_t unmapped_rc_channel = {
+  .pin = -1,
+  .function = RC_FUNCTION_NONE,
+  .pulse_length = CENTER_LEFTRIGHT_PULSE_LENGTH,
   .pulse_start_time = 0,
-  .last_good_signal = 0
+  .last_good_signal = 0,
+  .last_pulse_end = 0
 };
 
+//channel assigned to each function (looked up once at init)
+static struct rc_channel_t *function_channels[RC_FUNCTION_COUNT];
+
+//most recently decoded RC frame
+static struct rc_state_t rc_state = {};
+
 //prevent RC data from changing when in use
 static void lock_rc_data() {
   rc_data_lock_state = RC_DATA_LOCKED;
@@ -49,8 +60,9 @@ static void unlock_rc_data() {
   rc_data_lock_state = RC_DATA_UNLOCKED;
 }
 
-//updates RC channels with latest values
-static void update_rc_channel(struct rc_channel_t *rc_channel) {
+//updates RC channels with latest values (ISR - shared by all channels)
+static void update_rc_channel(void *arg) {
+  struct rc_channel_t *rc_channel = (struct rc_channel_t *)arg;
 
 //if we are using the rc channel info - don't update it!
 
@@ -72,6 +84,7 @@ static void update_rc_channel(struct rc_channel_t *rc_channel) {
       if (new_pulse_length <= MAX_RC_PULSE_LENGTH && new_pulse_length >= MIN_RC_PULSE_LENGTH) {
         rc_channel->pulse_length = new_pulse_length;
         rc_channel->last_good_signal = millis();
+        rc_channel->last_pulse_end = micros();
       }
     }
   }
@@ -82,28 +95,19 @@ static void update_rc_channel(struct rc_channel_t *rc_channel) {
 bool rc_signal_is_healthy() {
 
   lock_rc_data();
-  unsigned long last_good_signal = throttle_rc_channel.last_good_signal;
+  unsigned long last_good_signal = function_channels[RC_FUNCTION_THROTTLE]->last_good_signal;
   unlock_rc_data();
 
   //initial signal not received
   if (last_good_signal == 0) {
     // Debug output every 1000ms to show we're waiting for initial signal
-    static unsigned long last_debug = 0;
-    if (millis() - last_debug > 1000) {
-      debug_print("RC", "Waiting for initial RC signal");
-      last_debug = millis();
-    }
+    LOG_EVERY_MS(DEBUG_INFO, RC, 1000, "Waiting for initial RC signal");
     return false;
   }
 
   if (millis() - last_good_signal > MAX_MS_BETWEEN_RC_UPDATES) {
     // Debug output when signal is lost after previously being good
-    static unsigned long last_debug = 0;
-    if (millis() - last_debug > 1000) {
-      debug_printf("RC", "RC signal lost - Last good signal: %lums ago",
-                 millis() - last_good_signal);
-      last_debug = millis();
-    }
+    LOG_EVERY_MS(DEBUG_INFO, RC, 1000, "RC signal lost - Last good signal: %lums ago", millis() - last_good_signal);
     return false;
   }
 
@@ -111,57 +115,32 @@ bool rc_signal_is_healthy() {
 }
 
 //returns at integer from 0 to 100 based on throttle position
-//default values are intended to have "dead zones" at both top
-//and bottom of stick for 0 and 100 percent
+//mapping (endpoints / bidirectional TX neutral window / expo) comes from the throttle curve lookup table (see rc_curves.cpp)
 int rc_get_throttle_percent() {
 
   lock_rc_data();
-  unsigned long pulse_length = throttle_rc_channel.pulse_length;
+  unsigned long pulse_length = function_channels[RC_FUNCTION_THROTTLE]->pulse_length;
   unlock_rc_data();
 
   // Debug output every 1000ms
-  static unsigned long last_debug = 0;
-  if (millis() - last_debug > 1000) {
-    debug_printf("RC", "RC signal - Raw pulse: %dμs, Thresholds - Idle: %dμs, Full: %dμs",
-               pulse_length, IDLE_THROTTLE_PULSE_LENGTH, FULL_THROTTLE_PULSE_LENGTH);
-    last_debug = millis();
-  }
-
-  if (pulse_length >= FULL_THROTTLE_PULSE_LENGTH) return 100;
-
-  // For bidirectional transmitters sending ~1500μs at minimum stick position
-  // Check if we're in the neutral/minimum range (1450-1550μs)
-  if (pulse_length >= 1450 && pulse_length <= 1550) return 0;
-
-  // For standard transmitters with true minimum (below IDLE_THROTTLE_PULSE_LENGTH)
-  if (pulse_length <= IDLE_THROTTLE_PULSE_LENGTH) return 0;
+  LOG_EVERY_MS(DEBUG_VERBOSE, RC, 1000, "RC signal - Raw pulse: %luμs, Throttle: %d%%",
+               pulse_length, rc_curve_throttle_percent(pulse_length));
 
-  // If signal is in the middle range, map it 0-100%
-  // For signals above neutral (1550μs) but below full throttle
-  if (pulse_length > 1550) {
-    long throttle_percent = (pulse_length - 1550) * 100;
-    throttle_percent = throttle_percent / (FULL_THROTTLE_PULSE_LENGTH - 1550);
+  //throttle is held at zero while disarmed (if an arm switch is mapped)
+  if (rc_is_armed() == false) return 0;
 
-    // Make sure we cap at 100% (in case calculation exceeds 100%)
-    if (throttle_percent > 100) throttle_percent = 100;
+  return rc_curve_throttle_percent(pulse_length);
+}
 
-    // Debug the throttle calculation for values above 1550μs
-    static unsigned long last_calc_debug = 0;
-    if (millis() - last_calc_debug > 2000) {
-      debug_printf("RC", "Throttle calculation: (%d - 1550) * 100 / (%d - 1550) = %d%%",
-                 pulse_length, FULL_THROTTLE_PULSE_LENGTH, (int)throttle_percent);
-      last_calc_debug = millis();
-    }
+//returns -1000 (full left) to 1000 (full right) from the steering curve lookup table
+//deadband is applied by the curve
+int rc_get_steering_permille() {
 
-    return (int)throttle_percent;
-  }
+  lock_rc_data();
+  unsigned long pulse_length = function_channels[RC_FUNCTION_LEFTRIGHT]->pulse_length;
+  unlock_rc_data();
 
-  // For traditional RC transmitters with signals between idle and full
-  // This branch should rarely be hit with bidirectional controllers
-  long throttle_percent = (pulse_length - IDLE_THROTTLE_PULSE_LENGTH) * 100;
-  throttle_percent = throttle_percent / (FULL_THROTTLE_PULSE_LENGTH - IDLE_THROTTLE_PULSE_LENGTH);
-  if (throttle_percent > 100) throttle_percent = 100;
-  return (int)throttle_percent;
+  return rc_curve_steering_permille(pulse_length);
 }
 
 bool rc_get_is_lr_in_config_deadzone() {
@@ -179,7 +158,7 @@ bool rc_get_is_lr_in_normal_deadzone() {
 rc_forback_enum rc_get_forback_enum() {
 
   lock_rc_data();
-  unsigned long pulse_length = forback_rc_channel.pulse_length;
+  unsigned long pulse_length = function_channels[RC_FUNCTION_FORBACK]->pulse_length;
   unlock_rc_data();
 
   int rc_forback_offset = pulse_length - CENTER_FORBACK_PULSE_LENGTH;
@@ -194,7 +173,7 @@ rc_forback_enum rc_get_forback_enum() {
 int rc_get_leftright() {
 
   lock_rc_data();
-  unsigned long pulse_length = leftright_rc_channel.pulse_length;
+  unsigned long pulse_length = function_channels[RC_FUNCTION_LEFTRIGHT]->pulse_length;
   unlock_rc_data();
 
   return pulse_length - CENTER_LEFTRIGHT_PULSE_LENGTH;
@@ -204,7 +183,7 @@ int rc_get_leftright() {
 //positive for forward, negative for backward, 0 for center
 int rc_get_forback() {
   lock_rc_data();
-  unsigned long pulse_length = forback_rc_channel.pulse_length;
+  unsigned long pulse_length = function_channels[RC_FUNCTION_FORBACK]->pulse_length;
   unlock_rc_data();
 
   return pulse_length - CENTER_FORBACK_PULSE_LENGTH;
@@ -225,12 +204,8 @@ float rc_get_translation_percent() {
   const float MAX_TRANSLATION_DISTANCE = 450.0; // Distance at which we want 100% translation
 
   // Debug output every 1000ms
-  static unsigned long last_debug = 0;
-  if (millis() - last_debug > 1000) {
-    debug_printf("RC", "Translation calculation: Distance=%0.1f, Min=%0.1f, Max=%0.1f",
-                distance, MIN_TRANSLATION_DISTANCE, MAX_TRANSLATION_DISTANCE);
-    last_debug = millis();
-  }
+  LOG_EVERY_MS(DEBUG_VERBOSE, RC, 1000, "Translation calculation: Distance=%0.1f, Min=%0.1f, Max=%0.1f",
+               distance, MIN_TRANSLATION_DISTANCE, MAX_TRANSLATION_DISTANCE);
 
   // Check if we're in the center deadzone
   if (distance <= MIN_TRANSLATION_DISTANCE) return 0.0;
@@ -244,33 +219,120 @@ float rc_get_translation_percent() {
   return percent;
 }
 
-//ISRs for each RC interrupt pin
-void forback_rc_change() {
-  update_rc_channel(&forback_rc_channel);
+//reads a channel assigned to a function (unmapped functions read as neutral)
+static unsigned long get_function_pulse_length(rc_channel_function function) {
+  lock_rc_data();
+  unsigned long pulse_length = function_channels[function]->pulse_length;
+  unlock_rc_data();
+  return pulse_length;
 }
-void leftright_rc_change() {
-  update_rc_channel(&leftright_rc_channel);
+
+bool rc_function_is_mapped(rc_channel_function function) {
+  return function_channels[function] != &unmapped_rc_channel;
 }
-void throttle_rc_change() {
-  update_rc_channel(&throttle_rc_channel);
+
+//switches read high above RC_SWITCH_HIGH_PULSE_LENGTH
+//unmapped arm switch reads as armed (no arm switch = always armed)
+bool rc_is_armed() {
+  if (rc_function_is_mapped(RC_FUNCTION_ARM) == false) return true;
+  return get_function_pulse_length(RC_FUNCTION_ARM) > RC_SWITCH_HIGH_PULSE_LENGTH;
+}
+
+//decodes all channels into rc_state (call once per control frame)
+const struct rc_state_t *rc_update_state() {
+  rc_state.healthy = rc_signal_is_healthy();
+  rc_state.armed = rc_is_armed();
+  rc_state.throttle_percent = rc_get_throttle_percent();
+  rc_state.leftright = rc_get_leftright();
+  rc_state.forback = rc_get_forback();
+  rc_state.forback_enum = rc_get_forback_enum();
+  rc_state.steering_permille = rc_get_steering_permille();
+  rc_state.translation_percent = rc_get_translation_percent();
+
+  //frame is identified by when its throttle pulse arrived
+  lock_rc_data();
+  rc_state.frame_timestamp_us = function_channels[RC_FUNCTION_THROTTLE]->last_pulse_end;
+  unlock_rc_data();
+
+  rc_state.config_switch = get_function_pulse_length(RC_FUNCTION_CONFIG_TOGGLE) > RC_SWITCH_HIGH_PULSE_LENGTH;
+  rc_state.governor_enabled = get_function_pulse_length(RC_FUNCTION_RPM_GOVERNOR) > RC_SWITCH_HIGH_PULSE_LENGTH;
+
+  //3 position switch: low = normal, mid = inverted steering, high = spin only
+  unsigned long translation_mode_pulse = get_function_pulse_length(RC_FUNCTION_TRANSLATION_MODE);
+  if (rc_function_is_mapped(RC_FUNCTION_TRANSLATION_MODE) == false || translation_mode_pulse < RC_SWITCH_LOW_PULSE_LENGTH) {
+    rc_state.translation_mode = RC_TRANSLATION_NORMAL;
+  } else if (translation_mode_pulse > RC_SWITCH_HIGH_PULSE_LENGTH) {
+    rc_state.translation_mode = RC_TRANSLATION_SPIN_ONLY;
+  } else {
+    rc_state.translation_mode = RC_TRANSLATION_INVERTED;
+  }
+
+  //heading trim knob - center is no trim
+  int trim_offset = (int)get_function_pulse_length(RC_FUNCTION_HEADING_TRIM) - CENTER_LEFTRIGHT_PULSE_LENGTH;
+  rc_state.heading_trim_permille = constrain(trim_offset * 2, -1000, 1000);
+
+  return &rc_state;
+}
+
+//returns most recently decoded RC frame (without decoding a new one)
+const struct rc_state_t *rc_get_state() {
+  return &rc_state;
+}
+
+//telemetry reads the latest decoded frame (rc_get_* functions log - and aren't meant for core 0)
+static bool get_state_healthy() {
+  return rc_state.healthy;
+}
+
+static int get_state_forback_enum() {
+  return rc_state.forback_enum;
 }
 
 //attach interrupts to rc pins
 void init_rc(void) {
-  // Initialize RC channel pulse values to neutral/center to avoid spurious values at startup
-  forback_rc_channel.pulse_length = CENTER_FORBACK_PULSE_LENGTH;
-  leftright_rc_channel.pulse_length = CENTER_LEFTRIGHT_PULSE_LENGTH;
-  throttle_rc_channel.pulse_length = CENTER_LEFTRIGHT_PULSE_LENGTH;
-
-  // Set pins as inputs
-  pinMode(forback_rc_channel.pin, INPUT);
-  pinMode(leftright_rc_channel.pin, INPUT);
-  pinMode(throttle_rc_channel.pin, INPUT);
-
-  // Attach interrupts
-  attachInterrupt(digitalPinToInterrupt(forback_rc_channel.pin), forback_rc_change, CHANGE);
-  attachInterrupt(digitalPinToInterrupt(leftright_rc_channel.pin), leftright_rc_change, CHANGE);
-  attachInterrupt(digitalPinToInterrupt(throttle_rc_channel.pin), throttle_rc_change, CHANGE);
-
-  debug_print("RC", "RC interrupt handlers initialized");
+  for (int function = 0; function < RC_FUNCTION_COUNT; function++) {
+    function_channels[function] = &unmapped_rc_channel;
+  }
+
+  for (unsigned int i = 0; i < RC_CHANNEL_COUNT; i++) {
+    struct rc_channel_t *rc_channel = &rc_channels[i];
+    rc_channel->pin = rc_channel_map[i].pin;
+    rc_channel->function = rc_channel_map[i].function;
+    rc_channel->pulse_start_time = 0;
+    rc_channel->last_good_signal = 0;
+    rc_channel->last_pulse_end = 0;
+
+    // Initialize RC channel pulse values to neutral/center to avoid spurious values at startup
+    rc_channel->pulse_length = CENTER_LEFTRIGHT_PULSE_LENGTH;
+
+    if (rc_channel->function != RC_FUNCTION_NONE) {
+      if (function_channels[rc_channel->function] != &unmapped_rc_channel) {
+        LOG_WARNING(RC, "Function %d mapped to more than one channel - using pin %d",
+                           rc_channel->function, function_channels[rc_channel->function]->pin);
+        continue;
+      }
+      function_channels[rc_channel->function] = rc_channel;
+    }
+
+    // Set pin as input and attach interrupt
+    pinMode(rc_channel->pin, INPUT);
+    attachInterruptArg(digitalPinToInterrupt(rc_channel->pin), update_rc_channel, rc_channel, CHANGE);
+  }
+
+  if (rc_function_is_mapped(RC_FUNCTION_THROTTLE) == false) {
+    LOG_ERROR(RC, "No throttle channel in RC_CHANNEL_MAP - RC signal will never be healthy");
+  }
+
+  // Build throttle / steering lookup tables from default curves (stored curves are loaded with other EEPROM settings)
+  init_rc_curves();
+
+  rc_update_state();
+
+  telemetry_register_bool("rcHealthy", get_state_healthy);
+  telemetry_register_int_ptr("rcThrottle", "%", &rc_state.throttle_percent);
+  telemetry_register_int_ptr("rcSteering", "permille", &rc_state.steering_permille);
+  telemetry_register_int_ptr("rcLeftRight", "us", &rc_state.leftright);
+  telemetry_register_int("rcForBack", "", get_state_forback_enum);
+
+  LOG_INFO(RC, "RC interrupt handlers initialized for %d channels", (int)RC_CHANNEL_COUNT);
 }
@@ -1,3 +1,5 @@
+#include "melty_config.h"
+
 //used to return forward / back control stick position
 typedef enum {
     RC_FORBACK_FORWARD = 1,     //control stick pushed forward
@@ -5,8 +7,44 @@ typedef enum {
     RC_FORBACK_BACKWARD = -1     //control stick held back
 } rc_forback_enum;
 
+//translation modes selected by RC_FUNCTION_TRANSLATION_MODE switch
+typedef enum {
+    RC_TRANSLATION_NORMAL = 0,       //normal translational drift
+    RC_TRANSLATION_INVERTED = 1,     //left / right steering reversed (driving with bot upside down)
+    RC_TRANSLATION_SPIN_ONLY = 2     //forward / back ignored - bot just spins (steering still adjusts heading)
+} rc_translation_mode_enum;
+
+//all RC inputs decoded for a single control frame
+struct rc_state_t {
+    bool healthy;                              //RC signal is good
+    bool armed;                                //arm switch is on (always true if no arm switch is mapped)
+    int throttle_percent;                      //0-100 (0 if disarmed)
+    int leftright;                             //offset in microseconds from center
+    int forback;                               //offset in microseconds from center
+    rc_forback_enum forback_enum;              //forward / neutral / backward
+    int steering_permille;                     //-1000 to 1000 after steering curve
+    float translation_percent;                 //0-1 steering stick distance from center (see rc_get_translation_percent)
+    bool config_switch;                        //current position of config toggle switch
+    rc_translation_mode_enum translation_mode; //selected translation mode
+    bool governor_enabled;                     //RPM governor switch is on
+    int heading_trim_permille;                 //-1000 to 1000 heading trim knob position
+    unsigned long frame_timestamp_us;          //micros() when the latest throttle pulse ended (0 = none yet) - used for latency tracing
+};
+
 void init_rc();
 
+//decodes all RC channels into a single state struct - call once per control frame
+const struct rc_state_t *rc_update_state();
+
+//returns the most recently decoded state (doesn't decode a new frame)
+const struct rc_state_t *rc_get_state();
+
+//returns true if a function is assigned to a channel in RC_CHANNEL_MAP
+bool rc_function_is_mapped(rc_channel_function function);
+
+//returns true if arm switch is on (or no arm switch is mapped)
+bool rc_is_armed();
+
 bool rc_signal_is_healthy();           //return true if RC signal looks good
 
 int rc_get_throttle_percent();        //returns 0-100 value indicating throttle level
@@ -14,6 +52,7 @@ int rc_get_throttle_percent();        //returns 0-100 value indicating throttle
 rc_forback_enum rc_get_forback_enum();  //returns RC_FORBACK_FORWARD, RC_FORBACK_NEUTRAL or RC_FORBACK_BACKWARD depending on stick position
 int rc_get_leftright();                 //returns offset in microseconds from center value (not converted to percentage)
 int rc_get_forback();                   //returns offset in microseconds from center value for forward/backward
+int rc_get_steering_permille();         //returns -1000 (full left) to 1000 (full right) after steering curve is applied
 float rc_get_translation_percent();       //returns 0-1 value indicating distance from center position of steering stick
 
 //these functions return true if L/R stick movement is below defined thresholds
@@ -43,6 +82,9 @@ bool rc_get_is_lr_in_normal_deadzone();
 #define LR_CONFIG_MODE_DEADZONE_WIDTH 100         //deadzone for LR when in config mode (in US) - prevents unintended tracking adjustments
 #define LR_NORMAL_DEADZONE_WIDTH 25               //deadzone for normal drive - can help with unintentional drift when moving forward / back
 
+#define RC_SWITCH_HIGH_PULSE_LENGTH 1700           //switch channels read as "on" / high above this value
+#define RC_SWITCH_LOW_PULSE_LENGTH 1300            //3 position switches read as low below this value (mid between low and high)
+
 #define MAX_MS_BETWEEN_RC_UPDATES 900             //if we don't get a valid RC update on the throttle at least this often - spin down
 
 
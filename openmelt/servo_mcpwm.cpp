@@ -0,0 +1,67 @@
+//this module generates servo PWM for the ESCs using the ESP32 MCPWM peripheral
+//(only initialized when THROTTLE_TYPE is SERVO_PWM_THROTTLE and SERVO_PWM_USE_MCPWM is true)
+
+#include <Arduino.h>
+#include "melty_config.h"
+#include "servo_mcpwm.h"
+#include "debug_handler.h"
+#include "driver/mcpwm.h"
+
+#define SERVO_MCPWM_TIMER MCPWM_TIMER_0
+
+static const mcpwm_io_signals_t servo_mcpwm_signals[SERVO_MCPWM_MOTOR_COUNT] = { MCPWM0A, MCPWM0B };
+static const mcpwm_generator_t servo_mcpwm_generators[SERVO_MCPWM_MOTOR_COUNT] = { MCPWM_OPR_A, MCPWM_OPR_B };
+
+static uint32_t pending_us[SERVO_MCPWM_MOTOR_COUNT] = { 1500, 1500 };
+static uint32_t output_us[SERVO_MCPWM_MOTOR_COUNT] = { 0, 0 };
+static bool update_pending = false;
+static bool initialized = false;
+
+void servo_mcpwm_write(int motor_index, uint32_t pulse_width_us) {
+  pending_us[motor_index] = pulse_width_us;
+  if (pulse_width_us != output_us[motor_index]) update_pending = true;
+}
+
+void servo_mcpwm_update() {
+  if (!update_pending || !initialized) return;
+
+  //compare values are shadowed and only loaded at timer zero - setting both together puts them in the same frame
+  //(only a timer zero landing between these two writes splits them - a window of a few us in each 20ms frame)
+  for (int motor = 0; motor < SERVO_MCPWM_MOTOR_COUNT; motor++) {
+    if (pending_us[motor] == output_us[motor]) continue;
+    mcpwm_set_duty_in_us(SERVO_MCPWM_UNIT, SERVO_MCPWM_TIMER, servo_mcpwm_generators[motor], pending_us[motor]);
+    output_us[motor] = pending_us[motor];
+  }
+  update_pending = false;
+}
+
+void init_servo_mcpwm(int motor1_pin, int motor2_pin) {
+  const int pins[SERVO_MCPWM_MOTOR_COUNT] = { motor1_pin, motor2_pin };
+  for (int motor = 0; motor < SERVO_MCPWM_MOTOR_COUNT; motor++) {
+    esp_err_t result = mcpwm_gpio_init(SERVO_MCPWM_UNIT, servo_mcpwm_signals[motor], pins[motor]);
+    if (result != ESP_OK) {
+      LOG_ERROR(MOTOR, "MCPWM pin init failed for motor %d: %s", motor + 1, esp_err_to_name(result));
+      return;
+    }
+  }
+
+  //one timer drives both operators - duty starts at 0 so nothing is sent until neutral is loaded below
+  mcpwm_config_t config = {};
+  config.frequency = SERVO_PWM_FREQUENCY_HZ;
+  config.cmpr_a = 0;
+  config.cmpr_b = 0;
+  config.counter_mode = MCPWM_UP_COUNTER;
+  config.duty_mode = MCPWM_DUTY_MODE_0;
+
+  esp_err_t result = mcpwm_init(SERVO_MCPWM_UNIT, SERVO_MCPWM_TIMER, &config);
+  if (result != ESP_OK) {
+    LOG_ERROR(MOTOR, "MCPWM timer init failed: %s", esp_err_to_name(result));
+    return;
+  }
+
+  initialized = true;
+  update_pending = true;
+  servo_mcpwm_update();
+
+  LOG_INFO(MOTOR, "MCPWM servo output started - %d Hz, motors share one timer", SERVO_PWM_FREQUENCY_HZ);
+}
@@ -0,0 +1,21 @@
+#ifndef SERVO_MCPWM_H
+#define SERVO_MCPWM_H
+
+#include <stdint.h>
+
+//servo PWM for both ESCs generated by one MCPWM timer (used for SERVO_PWM_THROTTLE when SERVO_PWM_USE_MCPWM is true)
+//both motors are operators of the same timer - frames start together and new pulse widths are loaded at the same timer zero
+//so changes made by servo_mcpwm_update() take effect on both ESCs in the same frame
+
+#define SERVO_MCPWM_MOTOR_COUNT 2
+
+//configures MCPWM timer / operators for both motors (outputs neutral 1500us)
+void init_servo_mcpwm(int motor1_pin, int motor2_pin);
+
+//sets pending pulse width (us) for a motor (motor_index 0 or 1) - not output until servo_mcpwm_update()
+void servo_mcpwm_write(int motor_index, uint32_t pulse_width_us);
+
+//applies pending pulse widths of both motors back-to-back - cheap if nothing changed
+void servo_mcpwm_update();
+
+#endif // SERVO_MCPWM_H
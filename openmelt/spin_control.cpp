@@ -11,11 +11,21 @@
 #include "led_driver.h"
 #include "battery_monitor.h"
 #include "debug_handler.h"
+#include "rc_curves.h"
+#include "latency_tracer.h"
+#include "pov_display.h"
+#include "dshot.h"
+#include "esc_latency.h"
+#include "telemetry_registry.h"
+#include "flight_log.h"
 
 #define ACCEL_MOUNT_RADIUS_MINIMUM_CM 0.2                 //Never allow interactive config to set below this value
 #define LEFT_RIGHT_CONFIG_RADIUS_ADJUST_DIVISOR 50.0f     //How quick accel. radius is adjusted in config mode (larger values = slower)
 #define LEFT_RIGHT_CONFIG_LED_ADJUST_DIVISOR 0.1f         //How quick LED heading is adjusted in config mode (larger values = slower)
 
+//full steering curve output (1000 permille) corresponds to a stick offset of half of NOMINAL_PULSE_RANGE
+#define STEERING_PERMILLE_TO_RADIUS_FACTOR (0.5f / RC_CURVE_OUTPUT_MAX / LEFT_RIGHT_HEADING_CONTROL_DIVISOR)
+
 #define MAX_TRANSLATION_ROTATION_INTERVAL_US (1.0f / MIN_TRANSLATION_RPM) * 60 * 1000 * 1000
 #define MAX_TRACKING_ROTATION_INTERVAL_US MAX_TRANSLATION_ROTATION_INTERVAL_US * 2   //don't track heading if we are this slow (also puts upper limit on time spent in melty loop for safety)
 
@@ -26,6 +36,21 @@ static float led_offset_percent = DEFAULT_LED_OFFSET_PERCENT;         //stored i
 static unsigned int highest_rpm = 0;
 static bool config_mode = false;   //1 if we are in config mode
 
+static float current_rpm = 0;         //fused RPM estimate from last rotation interval calculation (before steering adjustment)
+static float erpm_body_rpm = -1;      //body RPM from motor eRPM (-1 if not available)
+static bool wheel_slip = false;       //true if eRPM and accelerometer estimates diverged
+
+static const unsigned int heading_arc_led_angles[NUM_RGB_LEDS] = HEADING_ARC_LED_ANGLES;
+
+static const unsigned int spin_up_log_rpms[] = SPIN_UP_LOG_RPMS;
+#define SPIN_UP_LOG_RPM_COUNT (sizeof(spin_up_log_rpms) / sizeof(spin_up_log_rpms[0]))
+
+static float slewed_throttle = 0;               //throttle sent to motors (after slew limit)
+static unsigned long last_slew_us = 0;
+static unsigned long spin_up_start_ms = 0;      //start of current spin-up
+static unsigned int spin_up_next_log = 0;       //index in spin_up_log_rpms of next RPM to log time to
+static unsigned long spin_up_time_ms = 0;       //time to reach MIN_TRANSLATION_RPM in latest spin-up (0 if not reached)
+
 //loads settings from EEPROM
 void load_melty_config_settings() {
 #ifdef ENABLE_EEPROM_STORAGE 
@@ -71,29 +96,203 @@ int get_max_rpm() {
   return highest_rpm;
 }
 
+int get_current_rpm() {
+  return current_rpm;
+}
+
+float get_accel_zero_g_offset() {
+  return accel_zero_g_offset;
+}
+
+int get_erpm_body_rpm() {
+  return erpm_body_rpm;
+}
+
+bool get_wheel_slip_detected() {
+  return wheel_slip;
+}
+
+unsigned long get_spin_up_time_ms() {
+  return spin_up_time_ms;
+}
+
+//latest accelerometer reading less zero g offset (as used for RPM)
+static float get_accel_used_g() {
+  float x_g, y_g, z_g;
+  get_last_accel_g(&x_g, &y_g, &z_g);
+  return x_g - accel_zero_g_offset;
+}
+
+static unsigned long get_motor_1_esc_latency_us() {
+  return esc_latency_get_us(0);
+}
+
+static unsigned long get_motor_2_esc_latency_us() {
+  return esc_latency_get_us(1);
+}
+
+static bool get_motor_1_esc_latency_measured() {
+  return esc_latency_is_measured(0);
+}
+
+static bool get_motor_2_esc_latency_measured() {
+  return esc_latency_is_measured(1);
+}
+
+//RC frame to motor output latency (histogram is scanned for each - only read when telemetry is requested)
+static float get_motor_latency_p50_ms() {
+  return latency_get_stats(LATENCY_STAGE_MOTOR).p50_us / 1000.0f;
+}
+
+static float get_motor_latency_p99_ms() {
+  return latency_get_stats(LATENCY_STAGE_MOTOR).p99_us / 1000.0f;
+}
+
+static float get_motor_latency_max_ms() {
+  return latency_get_stats(LATENCY_STAGE_MOTOR).max_us / 1000.0f;
+}
+
+void init_spin_control() {
+  telemetry_register_int("rpm", "rpm", get_current_rpm);
+  telemetry_register_int("maxRpm", "rpm", get_max_rpm);
+  telemetry_register_float("accelUsed", "g", 2, get_accel_used_g);
+  telemetry_register_bool("configMode", get_config_mode);
+  telemetry_register_ulong_ptr("spinUpTimeMs", "ms", &spin_up_time_ms);
+
+  if (THROTTLE_TYPE == DSHOT_THROTTLE && DSHOT_BIDIRECTIONAL) {
+    telemetry_register_int("erpmBodyRpm", "rpm", get_erpm_body_rpm);
+    telemetry_register_bool("wheelSlip", get_wheel_slip_detected);
+  }
+
+  //ESC latency compensation applied to each motor's on period
+  if (ESC_LATENCY_AUTO_MEASURE || MOTOR_1_ESC_LATENCY_US > 0 || MOTOR_2_ESC_LATENCY_US > 0) {
+    telemetry_register_ulong("motor1EscLatency", "us", get_motor_1_esc_latency_us);
+    telemetry_register_ulong("motor2EscLatency", "us", get_motor_2_esc_latency_us);
+    telemetry_register_bool("motor1EscLatencyMeasured", get_motor_1_esc_latency_measured);
+    telemetry_register_bool("motor2EscLatencyMeasured", get_motor_2_esc_latency_measured);
+  }
+
+  telemetry_register_float("latencyMotorP50", "ms", 1, get_motor_latency_p50_ms);
+  telemetry_register_float("latencyMotorP99", "ms", 1, get_motor_latency_p99_ms);
+  telemetry_register_float("latencyMotorMax", "ms", 1, get_motor_latency_max_ms);
+
+  //settings in use (loaded from EEPROM / adjusted in config mode)
+  telemetry_register_float_ptr("radius", "cm", 2, &accel_mount_radius_cm);
+  telemetry_register_float_ptr("ledOffset", "%", 1, &led_offset_percent);
+  telemetry_register_float_ptr("zeroG", "g", 2, &accel_zero_g_offset);
+}
+
+//limits rate throttle rises (called every pass of the rotation loop - so ramp is smooth even when parameters update slowly at low RPM)
+//a gap of SPIN_UP_RESET_MS (not spinning) starts a new spin-up - ramp starts from 0 and time to RPM logging restarts
+static float slew_throttle(float target_throttle_percent) {
+  unsigned long now_us = micros();
+  unsigned long elapsed_us = now_us - last_slew_us;
+  last_slew_us = now_us;
+
+  if (elapsed_us > SPIN_UP_RESET_MS * 1000UL) {
+    slewed_throttle = 0;
+    elapsed_us = 0;
+    spin_up_start_ms = millis();
+    spin_up_next_log = 0;
+    spin_up_time_ms = 0;
+  }
+
+  if (!SPIN_UP_PROFILE_ENABLED) return target_throttle_percent;
+
+  float max_step = elapsed_us * (THROTTLE_SLEW_PERCENT_PER_SEC / (100.0f * 1000 * 1000));
+
+  //over current limit - back off at slew rate regardless of target
+  if (SPIN_UP_CURRENT_LIMIT_A > 0 && (get_motor_current(0) + get_motor_current(1)) > SPIN_UP_CURRENT_LIMIT_A) {
+    slewed_throttle = fmax(slewed_throttle - max_step, 0.0f);
+    return fmin(slewed_throttle, target_throttle_percent);
+  }
+
+  //decreases are immediate
+  if (target_throttle_percent <= slewed_throttle + max_step) {
+    slewed_throttle = target_throttle_percent;
+  } else {
+    slewed_throttle += max_step;
+  }
+  return slewed_throttle;
+}
+
+//throttle limit while spinning up - SPIN_UP_START_THROTTLE_LIMIT at standstill rising to no limit at SPIN_UP_FULL_THROTTLE_RPM
+static float get_spin_up_throttle_limit(float rpm) {
+  if (!SPIN_UP_PROFILE_ENABLED || rpm >= SPIN_UP_FULL_THROTTLE_RPM) return 1.0f;
+  return SPIN_UP_START_THROTTLE_LIMIT + ((1.0f - SPIN_UP_START_THROTTLE_LIMIT) * (rpm / SPIN_UP_FULL_THROTTLE_RPM));
+}
+
+//logs time since start of spin-up as each of SPIN_UP_LOG_RPMS is reached (resolution is one parameter update)
+static void log_spin_up_progress(float rpm) {
+  while (spin_up_next_log < SPIN_UP_LOG_RPM_COUNT && rpm >= spin_up_log_rpms[spin_up_next_log]) {
+    unsigned long time_ms = millis() - spin_up_start_ms;
+    LOG_INFO(SPIN, "Spin-up: %u RPM in %lu ms (profile %s)", spin_up_log_rpms[spin_up_next_log], time_ms, SPIN_UP_PROFILE_ENABLED ? "on" : "off");
+    spin_up_next_log++;
+  }
+  if (spin_up_time_ms == 0 && rpm >= MIN_TRANSLATION_RPM) spin_up_time_ms = millis() - spin_up_start_ms;
+}
+
+//body RPM implied by motor eRPM (wheels rolling around WHEEL_TRACK_RADIUS_CM) - averaged over motors reporting
+//returns -1 if no motor has reported recently
+static float get_body_rpm_from_erpm() {
+  float total_rpm = 0;
+  int motors_reporting = 0;
+
+  for (int motor = 0; motor < DSHOT_MOTOR_COUNT; motor++) {
+    int32_t erpm = dshot_get_erpm(motor);
+    if (erpm == DSHOT_ERPM_INVALID) continue;
+    total_rpm += erpm;
+    motors_reporting++;
+  }
+  if (motors_reporting == 0) return -1;
+
+  float motor_rpm = (total_rpm / motors_reporting) / (MOTOR_POLE_COUNT / 2.0f);
+  return (motor_rpm / MOTOR_GEAR_RATIO) * (WHEEL_RADIUS_CM / WHEEL_TRACK_RADIUS_CM);
+}
+
+//blends accelerometer RPM with eRPM derived RPM (if available)
+//eRPM is ignored while it disagrees with the accelerometer by more than ERPM_SLIP_THRESHOLD_PERCENT (wheel slip / bot airborne)
+static float fuse_rpm_estimates(float accel_rpm) {
+  if (DSHOT_BIDIRECTIONAL == false || THROTTLE_TYPE != DSHOT_THROTTLE) return accel_rpm;
+
+  erpm_body_rpm = get_body_rpm_from_erpm();
+  if (erpm_body_rpm < 0) {
+    wheel_slip = false;
+    return accel_rpm;
+  }
+
+  float larger_rpm = fmax(accel_rpm, erpm_body_rpm);
+  wheel_slip = larger_rpm > 0 && fabs(erpm_body_rpm - accel_rpm) > larger_rpm * (ERPM_SLIP_THRESHOLD_PERCENT / 100.0f);
+  if (wheel_slip) return accel_rpm;
+
+  return (accel_rpm * (1.0f - ERPM_FUSION_WEIGHT)) + (erpm_body_rpm * ERPM_FUSION_WEIGHT);
+}
+
 //calculates time for this rotation of robot
 //robot is steered by increasing / decreasing rotation by factor relative to RC left / right position
 //ie - reducing rotation time estimate below actual results in shift of heading opposite the direction of rotation
-static float get_rotation_interval_ms(int steering_disabled) {
+static float get_rotation_interval_ms(int steering_disabled, int steering_permille) {
   
   float radius_adjustment_factor = 0;
 
-  //don't adjust steering if disabled by config mode - or we are in RC deadzone
-  if (steering_disabled == 0 && rc_get_is_lr_in_normal_deadzone() == false) {
-    radius_adjustment_factor = (float)(rc_get_leftright() / (float)NOMINAL_PULSE_RANGE) / LEFT_RIGHT_HEADING_CONTROL_DIVISOR;
+  //don't adjust steering if disabled by config mode (deadzone / expo are handled by the steering curve)
+  if (steering_disabled == 0) {
+    radius_adjustment_factor = steering_permille * STEERING_PERMILLE_TO_RADIUS_FACTOR;
   }
   
-  float effective_radius_in_cm = accel_mount_radius_cm;
-  
-  effective_radius_in_cm = effective_radius_in_cm + (effective_radius_in_cm * radius_adjustment_factor);
-
   float rpm;
   //use of absolute makes it so we don't need to worry about accel orientation
   //calculate RPM from g's - derived from "G = 0.00001118 * r * RPM^2"
   rpm = fabs(get_accel_force_g() - accel_zero_g_offset) * 89445.0f;
-  rpm = rpm / effective_radius_in_cm;
+  rpm = rpm / accel_mount_radius_cm;
   rpm = sqrt(rpm);
 
+  rpm = fuse_rpm_estimates(rpm);
+  current_rpm = rpm;
+
+  //steering scales the radius used for the estimate (RPM is proportional to 1 / sqrt(radius))
+  rpm = rpm / sqrt(1.0f + radius_adjustment_factor);
+
   if (rpm > highest_rpm || highest_rpm == 0) highest_rpm = rpm;
 
   float rotation_interval = (1.0f / rpm) * 60 * 1000;
@@ -152,15 +351,54 @@ static struct melty_parameters_t handle_config_mode(struct melty_parameters_t me
   return melty_parameters;  
 }
 
+//moves a time offset in the rotation earlier by latency_us - wrapped to stay within a single rotation
+static unsigned long get_latency_shifted_offset(unsigned long offset_us, unsigned long latency_us, unsigned long rotation_interval_us) {
+  latency_us = latency_us % rotation_interval_us;
+  if (offset_us >= latency_us) return offset_us - latency_us;
+  return (rotation_interval_us + offset_us) - latency_us;
+}
+
+//beacon color for HEADING_ARC_COLOR_MODE (config mode always uses CONFIG_LED_COLOR)
+static uint32_t get_heading_arc_color(struct melty_parameters_t melty_parameters) {
+  if (get_config_mode() == true) return getColorValue(CONFIG_LED_COLOR);
+
+  if (HEADING_ARC_COLOR_MODE == HEADING_ARC_COLOR_DIRECTION) {
+    if (melty_parameters.translate_forback == RC_FORBACK_FORWARD) return getColorValue(GREEN);
+    if (melty_parameters.translate_forback == RC_FORBACK_BACKWARD) return getColorValue(RED);
+  } else if (HEADING_ARC_COLOR_MODE == HEADING_ARC_COLOR_RPM) {
+    float rpm = 60000000.0f / melty_parameters.rotation_interval_us;
+    if (rpm < MIN_TRANSLATION_RPM) return getColorValue(RED);
+    if (rpm < HEADING_ARC_HIGH_RPM) return getColorValue(YELLOW);
+    return getColorValue(GREEN);
+  } else if (HEADING_ARC_COLOR_MODE == HEADING_ARC_COLOR_BATTERY) {
+    float voltage = get_battery_voltage();
+    if (voltage < BATTERY_ADC_WARN_VOLTAGE_THRESHOLD) return getColorValue(RED);
+    if (voltage < BATTERY_ADC_WARN_VOLTAGE_THRESHOLD + HEADING_ARC_BATTERY_MARGIN_VOLTAGE) return getColorValue(YELLOW);
+    return getColorValue(GREEN);
+  }
+  return getColorValue(RGB_LED_COLOR);
+}
+
 //Calculates all parameters need for a single rotation (motor timing, LED timing, etc.)
 //This entire section takes ~1300us on an Atmega32u4 (acceptable - fast enough to not have major impact on tracking accuracy)
 static struct melty_parameters_t get_melty_parameters(void) {
 
   struct melty_parameters_t melty_parameters = {};
 
-  float led_offset_portion = led_offset_percent / 100.0f;
+  //all RC inputs for this update are decoded once
+  const struct rc_state_t *rc_state = rc_update_state();
 
-  melty_parameters.throttle_percent = rc_get_throttle_percent() / 100.0f;
+  //heading trim knob (if mapped) shifts LED offset - wrapped to stay within a single rotation
+  float led_offset_portion = (led_offset_percent / 100.0f) + (rc_state->heading_trim_permille * (HEADING_TRIM_RANGE_PERCENT / 100000.0f));
+  if (led_offset_portion < 0.0f) led_offset_portion += 1.0f;
+  if (led_offset_portion >= 1.0f) led_offset_portion -= 1.0f;
+
+  melty_parameters.throttle_percent = rc_state->throttle_percent / 100.0f;
+  melty_parameters.rc_frame_timestamp_us = rc_state->frame_timestamp_us;
+
+  //ESC translation / coast scaling only changes with RC input - computed here rather than on every motor call
+  motors_update_voltage_compensation();
+  motors_set_translation_percent(rc_state->translation_percent);
 
   //by default motor_on_portion maps to thottle_percent input - but that can be altered
   float motor_on_portion = melty_parameters.throttle_percent;
@@ -176,15 +414,39 @@ static struct melty_parameters_t get_melty_parameters(void) {
   if (led_on_portion < 0.10f) led_on_portion = 0.10f;
   if (led_on_portion > 0.90f) led_on_portion = 0.90f;
 
-  melty_parameters.translate_forback = rc_get_forback_enum();
+  melty_parameters.translate_forback = rc_state->forback_enum;
+
+  //spin only mode - ignore forward / back
+  if (rc_state->translation_mode == RC_TRANSLATION_SPIN_ONLY) melty_parameters.translate_forback = RC_FORBACK_NEUTRAL;
+
+  //bot driven upside down - steering direction is reversed
+  int steering_permille = rc_state->steering_permille;
+  if (rc_state->translation_mode == RC_TRANSLATION_INVERTED) steering_permille = -steering_permille;
 
   //if we are in config mode - handle it (and disable steering if needed)
   if (get_config_mode() == true) {
     melty_parameters = handle_config_mode(melty_parameters);
   }
 
-  melty_parameters.rotation_interval_us = get_rotation_interval_ms(melty_parameters.steering_disabled) * 1000;
+  melty_parameters.rotation_interval_us = get_rotation_interval_ms(melty_parameters.steering_disabled, steering_permille) * 1000;
+
+  //RPM governor - scale back throttle / power portion in proportion to how far over the RPM limit we are
+  if (rc_state->governor_enabled) {
+    float governor_scale = melty_parameters.rotation_interval_us * (RPM_GOVERNOR_MAX_RPM / (60.0f * 1000 * 1000));
+    if (governor_scale < 1.0f) {
+      melty_parameters.throttle_percent = melty_parameters.throttle_percent * governor_scale;
+      motor_on_portion = motor_on_portion * governor_scale;
+    }
+  }
   
+  //spin-up profile - limits throttle at low RPM (rate of rise is limited in rotation loop)
+  float spin_up_limit = get_spin_up_throttle_limit(current_rpm);
+  if (melty_parameters.throttle_percent > spin_up_limit) melty_parameters.throttle_percent = spin_up_limit;
+  log_spin_up_progress(current_rpm);
+
+  //POV content (RPM digits / battery gauge / uploaded image) is drawn here - not in rotation loop
+  pov_update();
+
   //if under defined RPM - just try to spin up (motors on for full rotation)
   if (melty_parameters.rotation_interval_us > MAX_TRANSLATION_ROTATION_INTERVAL_US) motor_on_portion = 1;
 
@@ -205,11 +467,27 @@ static struct melty_parameters_t get_melty_parameters(void) {
   }
   
   melty_parameters.led_stop = melty_parameters.led_start + led_on_us;
+  melty_parameters.heading_offset_us = led_offset_us;
 
   //"wraps" led off time if it exceeds rotation length
   if (melty_parameters.led_stop > melty_parameters.rotation_interval_us)
     melty_parameters.led_stop = melty_parameters.led_stop - melty_parameters.rotation_interval_us;
 
+  //heading arc - each LED's part of the beacon is centered on the heading when that LED points at it (LEDs ahead of LED 0 get there earlier)
+  //started early by the LED frame time - so the LED has latched by the time it gets there
+  if (HEADING_ARC_ENABLED) {
+    unsigned long led_frame_us = led_get_frame_time_us();
+    unsigned long arc_on_us = (HEADING_ARC_WIDTH_PERCENT / 100.0f) * melty_parameters.rotation_interval_us;
+    if (arc_on_us < led_frame_us) arc_on_us = led_frame_us;
+    melty_parameters.led_arc_on_us = arc_on_us;
+
+    for (int led = 0; led < NUM_RGB_LEDS; led++) {
+      unsigned long led_lead_us = ((unsigned long long)(heading_arc_led_angles[led] % 360) * melty_parameters.rotation_interval_us) / 360;
+      melty_parameters.led_arc_start_us[led] = get_latency_shifted_offset(led_offset_us, led_lead_us + (arc_on_us / 2) + led_frame_us, melty_parameters.rotation_interval_us);
+    }
+    melty_parameters.led_arc_color = get_heading_arc_color(melty_parameters);
+  }
+
   //phase 1 timing: for motor_1 in forward translation or motor_2 in reverse
   //motor "on" period is centered at the halfway point of the rotation cycle (6 o'clock)
   melty_parameters.motor_start_phase_1 = (melty_parameters.rotation_interval_us / 2) - (motor_on_us / 2);
@@ -220,59 +498,119 @@ static struct melty_parameters_t get_melty_parameters(void) {
   melty_parameters.motor_start_phase_2 = melty_parameters.rotation_interval_us - (motor_on_us / 2);
   melty_parameters.motor_stop_phase_2 = motor_on_us / 2;
 
+  //each motor's on period for the current direction - started early by its ESC latency so power arrives at the intended phase
+  melty_parameters.motor_on_us = motor_on_us;
+  unsigned long motor_1_start = melty_parameters.motor_start_phase_1;
+  unsigned long motor_2_start = melty_parameters.motor_start_phase_2;
+  if (melty_parameters.translate_forback == RC_FORBACK_BACKWARD) {
+    motor_1_start = melty_parameters.motor_start_phase_2;
+    motor_2_start = melty_parameters.motor_start_phase_1;
+  }
+  melty_parameters.motor_start_us[0] = get_latency_shifted_offset(motor_1_start, esc_latency_get_us(0), melty_parameters.rotation_interval_us);
+  melty_parameters.motor_start_us[1] = get_latency_shifted_offset(motor_2_start, esc_latency_get_us(1), melty_parameters.rotation_interval_us);
+
   //if the battery voltage is low - shimmer the LED to let user know
 #ifdef BATTERY_ALERT_ENABLED
   if (battery_voltage_low() == true) melty_parameters.led_shimmer = 1;
 #endif
 
+  latency_record(LATENCY_STAGE_PARAMS, melty_parameters.rc_frame_timestamp_us, micros());
+
   return melty_parameters;
 }
 
-//handle translating forward
-static void translate_forward(struct melty_parameters_t melty_parameters, unsigned long time_spent_this_rotation_us) {
-  if (time_spent_this_rotation_us >= melty_parameters.motor_start_phase_1 && time_spent_this_rotation_us <= melty_parameters.motor_stop_phase_1) {
-    motor_1_on(melty_parameters.throttle_percent, true);
+//returns true if time_spent_this_rotation_us is within a period starting at start_us (handles periods wrapping past end of rotation)
+static bool is_within_period(unsigned long start_us, unsigned long length_us, unsigned long time_spent_this_rotation_us, unsigned long rotation_interval_us) {
+  unsigned long time_since_start_us = (time_spent_this_rotation_us + rotation_interval_us - start_us) % rotation_interval_us;
+  return time_since_start_us <= length_us;
+}
+
+//returns true if time_spent_this_rotation_us is within a motor's on period
+static bool is_motor_on_time(struct melty_parameters_t melty_parameters, int motor_index, unsigned long time_spent_this_rotation_us) {
+  return is_within_period(melty_parameters.motor_start_us[motor_index], melty_parameters.motor_on_us, time_spent_this_rotation_us, melty_parameters.rotation_interval_us);
+}
+
+//handle translating (forward or backward - motor on periods for the direction are set by get_melty_parameters)
+//backward swaps motor1 and motor2 timings (offset by 180 degrees)
+static void translate(struct melty_parameters_t melty_parameters, float throttle_percent, unsigned long time_spent_this_rotation_us) {
+  bool motor_1_powered = is_motor_on_time(melty_parameters, 0, time_spent_this_rotation_us);
+  bool motor_2_powered = is_motor_on_time(melty_parameters, 1, time_spent_this_rotation_us);
+
+  if (motor_1_powered) {
+    motor_1_on(throttle_percent, true);
   } else {
     motor_1_coast();
   }
-  if (time_spent_this_rotation_us >= melty_parameters.motor_start_phase_2 || time_spent_this_rotation_us <= melty_parameters.motor_stop_phase_2) {        
-    motor_2_on(melty_parameters.throttle_percent, true);
+  if (motor_2_powered) {
+    motor_2_on(throttle_percent, true);
   } else {
     motor_2_coast();
   }
+
+  if (ESC_LATENCY_AUTO_MEASURE) {
+    esc_latency_track(0, motor_1_powered);
+    esc_latency_track(1, motor_2_powered);
+  }
 }
 
-//handle translating backward (motor1 and motor2 timings are swapped - offset by 180 degrees)
-static void translate_backward(struct melty_parameters_t melty_parameters, unsigned long time_spent_this_rotation_us) {
-  if (time_spent_this_rotation_us >= melty_parameters.motor_start_phase_2 || time_spent_this_rotation_us <= melty_parameters.motor_stop_phase_2) {
-    motor_1_on(melty_parameters.throttle_percent, true);
-  } else {
-    motor_1_coast();
+//returns true if time_spent_this_rotation_us is within the heading LED beacon
+static bool is_heading_led_time(struct melty_parameters_t melty_parameters, unsigned long time_spent_this_rotation_us) {
+  if (melty_parameters.led_start > melty_parameters.led_stop) {
+    return (time_spent_this_rotation_us >= melty_parameters.led_start || time_spent_this_rotation_us <= melty_parameters.led_stop);
   }
-  if (time_spent_this_rotation_us >= melty_parameters.motor_start_phase_1 && time_spent_this_rotation_us <= melty_parameters.motor_stop_phase_1) {
-    motor_2_on(melty_parameters.throttle_percent, true);
-  } else {
-    motor_2_coast();
+  return (time_spent_this_rotation_us >= melty_parameters.led_start && time_spent_this_rotation_us <= melty_parameters.led_stop);
+}
+
+//lights each LED during its part of the heading arc (LED driver only sends a frame when the set of lit LEDs changes)
+static void update_heading_arc(struct melty_parameters_t melty_parameters, unsigned long time_spent_this_rotation_us) {
+  uint32_t led_mask = 0;
+
+  for (int led = 0; led < NUM_RGB_LEDS; led++) {
+    if (is_within_period(melty_parameters.led_arc_start_us[led], melty_parameters.led_arc_on_us, time_spent_this_rotation_us, melty_parameters.rotation_interval_us)) {
+      led_mask |= 1UL << led;
+    }
   }
+
+  //shimmer blanks the whole arc (same flicker as heading_led_on - timed by the LED driver)
+  led_set_column_color(melty_parameters.led_arc_color);
+  led_show_column(led_mask, melty_parameters.led_shimmer == 1);
 }
 
-//turns on heading LED at appropriate timing
+//turns on heading LED at appropriate timing - or draws POV column for this point in rotation (if POV content selected)
 static void update_heading_led(struct melty_parameters_t melty_parameters, unsigned long time_spent_this_rotation_us) {
-  if (melty_parameters.led_start > melty_parameters.led_stop) {
-    if (time_spent_this_rotation_us >= melty_parameters.led_start || time_spent_this_rotation_us <= melty_parameters.led_stop) {
-      heading_led_on(melty_parameters.led_shimmer);
-    } else {
-      heading_led_off();
-    }
+  bool heading_led_time = is_heading_led_time(melty_parameters, time_spent_this_rotation_us);
+
+  if (pov_is_active() && !(POV_SHOW_HEADING_BEACON && heading_led_time)) {
+    pov_render(time_spent_this_rotation_us, melty_parameters.rotation_interval_us, melty_parameters.heading_offset_us);
+  } else if (HEADING_ARC_ENABLED && USE_RGB_LED) {
+    update_heading_arc(melty_parameters, time_spent_this_rotation_us);
+  } else if (heading_led_time) {
+    heading_led_on(melty_parameters.led_shimmer);
   } else {
-    if (time_spent_this_rotation_us >= melty_parameters.led_start && time_spent_this_rotation_us <= melty_parameters.led_stop) {
-      heading_led_on(melty_parameters.led_shimmer);
-    } else {
-      heading_led_off();
-    }
+    heading_led_off();
   }
 }
 
+//queues flight recorder record for the rotation just completed
+static void log_rotation(const struct melty_parameters_t *melty_parameters, unsigned long start_time) {
+  flight_log_rotation_t record;
+  record.flags = 0;
+  if (config_mode) record.flags |= FLIGHT_LOG_FLAG_CONFIG_MODE;
+  if (melty_parameters->rotation_interval_us > MAX_TRANSLATION_ROTATION_INTERVAL_US) record.flags |= FLIGHT_LOG_FLAG_SPIN_UP;
+  if (wheel_slip) record.flags |= FLIGHT_LOG_FLAG_WHEEL_SLIP;
+  record.rpm = current_rpm;
+  record.time_us = start_time;
+  record.rotation_interval_us = melty_parameters->rotation_interval_us;
+  record.throttle_permille = melty_parameters->throttle_percent * 1000.0f;
+  record.steering_permille = rc_get_state()->steering_permille;
+  record.translate_forback = melty_parameters->translate_forback;
+  record.reserved = 0;
+  record.motor_pulse_width[0] = get_motor1_pulse_width();
+  record.motor_pulse_width[1] = get_motor2_pulse_width();
+  record.battery_mv = get_battery_voltage() * 1000.0f;
+  flight_log_rotation(&record);
+}
+
 //rotates the robot once + handles translational drift
 //(repeat as needed)
 void spin_one_rotation(void) {
@@ -306,6 +644,9 @@ void spin_one_rotation(void) {
       melty_parameters_updated_this_rotation = true;
     }
 
+    //throttle rise is rate limited (spin-up profile)
+    float throttle_percent = slew_throttle(melty_parameters.throttle_percent);
+
     // Check if we're under the minimum RPM for translation
     bool spin_up_mode = (melty_parameters.rotation_interval_us > MAX_TRANSLATION_ROTATION_INTERVAL_US);
     
@@ -318,8 +659,8 @@ void spin_one_rotation(void) {
     if (spin_up_mode || !is_translating) {
       // For non-translating operation, just keep both motors on at user's throttle level
       // Note: is_translating is FALSE here - using direct throttle control
-      motor_1_on(melty_parameters.throttle_percent, false);
-      motor_2_on(melty_parameters.throttle_percent, false);
+      motor_1_on(throttle_percent, false);
+      motor_2_on(throttle_percent, false);
       
       // The critical part: we still let rotation_interval_ms be affected by left-right input
       // This changes the tracked heading and allows steering even in simple spin mode
@@ -330,24 +671,22 @@ void spin_one_rotation(void) {
 
     //if motor 2 (or motor 1) is not present - control sequence remains identical (signal still generated for non-connected motor)
 
-    //translate forward
-    if (melty_parameters.translate_forback == RC_FORBACK_FORWARD) {
-      translate_forward(melty_parameters, time_spent_this_rotation_us);
-    }
-    //translate backward
-    else if (melty_parameters.translate_forback == RC_FORBACK_BACKWARD) {
-      translate_backward(melty_parameters, time_spent_this_rotation_us);
-    }
+    //translate forward / backward
+    translate(melty_parameters, throttle_percent, time_spent_this_rotation_us);
 
 update_led:
+    motors_sync_output();
+    latency_record(LATENCY_STAGE_MOTOR, melty_parameters.rc_frame_timestamp_us, micros());
+
     //displays heading LED at correct location
     update_heading_led(melty_parameters, time_spent_this_rotation_us);
+    latency_record(LATENCY_STAGE_LED, melty_parameters.rc_frame_timestamp_us, micros());
 
     // Update diagnostic data periodically during rotation
     // Use millis() here because we want real-time intervals, not rotation-relative time
     unsigned long current_millis = millis();
     if (current_millis - last_diagnostic_update > 100) {  // Update every 100ms
-      update_standard_diagnostics();
+      motors_print_debug();
       last_diagnostic_update = current_millis;
     }
 
@@ -355,4 +694,7 @@ update_led:
 
   }
 
+  log_rotation(&melty_parameters, start_time);
+
+  motors_rotation_complete();
 }
@@ -1,10 +1,31 @@
 
+#include <stdint.h>
+#include "melty_config.h"
+
+//registers spin control telemetry (RPM / config mode / latency / settings in use)
+void init_spin_control();
+
 //does translational drift rotation (robot spins 360 degrees)
 void spin_one_rotation(void);
 
 //returns maximum rotation speed since last entering config mode
 int get_max_rpm();
 
+//returns latest RPM estimate (accelerometer - fused with motor eRPM if bidirectional DShot is enabled)
+int get_current_rpm();
+
+//returns accelerometer reading at 0g in use (subtracted from readings before RPM is calculated)
+float get_accel_zero_g_offset();
+
+//returns body RPM derived from motor eRPM (-1 if not available)
+int get_erpm_body_rpm();
+
+//returns true if eRPM and accelerometer RPM estimates diverged (wheel slip) at last update
+bool get_wheel_slip_detected();
+
+//returns time taken to reach MIN_TRANSLATION_RPM in latest spin-up in ms (0 if not reached yet)
+unsigned long get_spin_up_time_ms();
+
 //toggles configuration mode
 void toggle_config_mode();
 
@@ -30,6 +51,13 @@ typedef struct melty_parameters_t {
 	unsigned long motor_stop_phase_1;   //time offset for when motor 1 turns off when translating forward (or motor 2 translating backwards)
 	unsigned long motor_start_phase_2;  //time offset for when motor 2 turns on when translating forward (or motor 1 translating backwards)
 	unsigned long motor_stop_phase_2;   //time offset for when motor 2 turns on when translating forward (or motor 1 translating backwards)
+  unsigned long heading_offset_us;    //time offset of heading (center of LED beacon) - start of POV image
+  unsigned long led_arc_start_us[NUM_RGB_LEDS]; //HEADING_ARC_ENABLED - when each LED starts its part of the beacon (moved earlier by LED frame time)
+  unsigned long led_arc_on_us;        //HEADING_ARC_ENABLED - length of each LED's part of the beacon
+  uint32_t led_arc_color;             //HEADING_ARC_ENABLED - beacon color (0xRRGGBB)
+  unsigned long motor_on_us;          //length of motor on period
+  unsigned long motor_start_us[2];    //when each motor turns on for current translation direction - moved earlier by ESC latency (on period may wrap past end of rotation)
   int steering_disabled;              //Prevents adjustment of left / right heading adjustment (used for configuration mode)
   int led_shimmer;                    //LED is shimmering to indicate something to the user
+  unsigned long rc_frame_timestamp_us; //RC frame these parameters were computed from (for latency tracing)
 };
@@ -0,0 +1,240 @@
+//this module holds the telemetry field registry and serializes it to JSON / CSV
+//all output is written into the caller's buffer - floats are formatted with integer math (printf %f can allocate)
+
+#include <Arduino.h>
+#include "telemetry_registry.h"
+#include "debug_handler.h"
+#include <stdarg.h>
+#include <math.h>
+
+#define TELEMETRY_MAX_DECIMALS 6
+#define TELEMETRY_FLOAT_LIMIT 2.0e9f      //larger values (and nan / inf) are written as null / empty
+
+typedef enum {
+  TELEMETRY_TYPE_BOOL = 0,
+  TELEMETRY_TYPE_INT,
+  TELEMETRY_TYPE_ULONG,
+  TELEMETRY_TYPE_FLOAT
+} telemetry_type_t;
+
+typedef struct telemetry_field_t {
+  const char *name;
+  const char *unit;
+  telemetry_type_t type;
+  uint8_t decimals;
+  bool is_pointer;
+  union {
+    telemetry_bool_getter_t get_bool;
+    telemetry_int_getter_t get_int;
+    telemetry_ulong_getter_t get_ulong;
+    telemetry_float_getter_t get_float;
+    const volatile int *int_value;
+    const volatile unsigned long *ulong_value;
+    const volatile float *float_value;
+  } source;
+} telemetry_field_t;
+
+typedef struct telemetry_writer_t {
+  char *buffer;
+  size_t size;          //space usable for output (including null terminator)
+  size_t length;
+  bool full;            //last append didn't fit (buffer holds output up to the previous append)
+} telemetry_writer_t;
+
+static const uint32_t decimal_scales[TELEMETRY_MAX_DECIMALS + 1] = { 1, 10, 100, 1000, 10000, 100000, 1000000 };
+
+static telemetry_field_t fields[TELEMETRY_MAX_FIELDS];
+static volatile int field_count = 0;    //fields are filled in before count is increased (serializer may run on other core)
+
+static telemetry_field_t *add_field(const char *name, const char *unit, telemetry_type_t type, int decimals, bool is_pointer) {
+  if (field_count >= TELEMETRY_MAX_FIELDS) {
+    LOG_WARNING(TELEMETRY, "No room for field %s (TELEMETRY_MAX_FIELDS %d)", name, TELEMETRY_MAX_FIELDS);
+    return NULL;
+  }
+  telemetry_field_t *field = &fields[field_count];
+  field->name = name;
+  field->unit = unit;
+  field->type = type;
+  field->decimals = constrain(decimals, 0, TELEMETRY_MAX_DECIMALS);
+  field->is_pointer = is_pointer;
+  return field;
+}
+
+void telemetry_register_bool(const char *name, telemetry_bool_getter_t getter) {
+  telemetry_field_t *field = add_field(name, "", TELEMETRY_TYPE_BOOL, 0, false);
+  if (field == NULL) return;
+  field->source.get_bool = getter;
+  field_count++;
+}
+
+void telemetry_register_int(const char *name, const char *unit, telemetry_int_getter_t getter) {
+  telemetry_field_t *field = add_field(name, unit, TELEMETRY_TYPE_INT, 0, false);
+  if (field == NULL) return;
+  field->source.get_int = getter;
+  field_count++;
+}
+
+void telemetry_register_ulong(const char *name, const char *unit, telemetry_ulong_getter_t getter) {
+  telemetry_field_t *field = add_field(name, unit, TELEMETRY_TYPE_ULONG, 0, false);
+  if (field == NULL) return;
+  field->source.get_ulong = getter;
+  field_count++;
+}
+
+void telemetry_register_float(const char *name, const char *unit, int decimals, telemetry_float_getter_t getter) {
+  telemetry_field_t *field = add_field(name, unit, TELEMETRY_TYPE_FLOAT, decimals, false);
+  if (field == NULL) return;
+  field->source.get_float = getter;
+  field_count++;
+}
+
+void telemetry_register_int_ptr(const char *name, const char *unit, const volatile int *value) {
+  telemetry_field_t *field = add_field(name, unit, TELEMETRY_TYPE_INT, 0, true);
+  if (field == NULL) return;
+  field->source.int_value = value;
+  field_count++;
+}
+
+void telemetry_register_ulong_ptr(const char *name, const char *unit, const volatile unsigned long *value) {
+  telemetry_field_t *field = add_field(name, unit, TELEMETRY_TYPE_ULONG, 0, true);
+  if (field == NULL) return;
+  field->source.ulong_value = value;
+  field_count++;
+}
+
+void telemetry_register_float_ptr(const char *name, const char *unit, int decimals, const volatile float *value) {
+  telemetry_field_t *field = add_field(name, unit, TELEMETRY_TYPE_FLOAT, decimals, true);
+  if (field == NULL) return;
+  field->source.float_value = value;
+  field_count++;
+}
+
+int telemetry_field_count() {
+  return field_count;
+}
+
+static void writer_init(telemetry_writer_t *writer, char *buffer, size_t size) {
+  writer->buffer = buffer;
+  writer->size = size;
+  writer->length = 0;
+  writer->full = (size == 0);
+  if (size > 0) buffer[0] = '\0';
+}
+
+static void append(telemetry_writer_t *writer, const char *format, ...) {
+  if (writer->full) return;
+  size_t space = writer->size - writer->length;
+  va_list args;
+  va_start(args, format);
+  int written = vsnprintf(writer->buffer + writer->length, space, format, args);
+  va_end(args);
+
+  if (written < 0 || (size_t)written >= space) {
+    writer->full = true;
+    writer->buffer[writer->length] = '\0';
+    return;
+  }
+  writer->length += written;
+}
+
+//writes fixed point value - null_text is written for values that can't be shown
+static void append_float(telemetry_writer_t *writer, float value, uint8_t decimals, const char *null_text) {
+  if (isnan(value) || isinf(value) || fabsf(value) >= TELEMETRY_FLOAT_LIMIT) {
+    append(writer, "%s", null_text);
+    return;
+  }
+
+  uint32_t scale = decimal_scales[decimals];
+  uint64_t scaled = (uint64_t)((double)fabsf(value) * scale + 0.5);
+  const char *sign = (value < 0 && scaled > 0) ? "-" : "";
+  unsigned long whole = (unsigned long)(scaled / scale);
+  unsigned long fraction = (unsigned long)(scaled % scale);
+
+  if (decimals == 0) {
+    append(writer, "%s%lu", sign, whole);
+  } else {
+    append(writer, "%s%lu.%0*lu", sign, whole, (int)decimals, fraction);
+  }
+}
+
+static void append_value(telemetry_writer_t *writer, const telemetry_field_t *field, const char *null_text) {
+  switch (field->type) {
+    case TELEMETRY_TYPE_BOOL:
+      append(writer, "%s", field->source.get_bool() ? "true" : "false");
+      break;
+    case TELEMETRY_TYPE_INT:
+      append(writer, "%d", field->is_pointer ? *field->source.int_value : field->source.get_int());
+      break;
+    case TELEMETRY_TYPE_ULONG:
+      append(writer, "%lu", field->is_pointer ? *field->source.ulong_value : field->source.get_ulong());
+      break;
+    case TELEMETRY_TYPE_FLOAT:
+      append_float(writer, field->is_pointer ? *field->source.float_value : field->source.get_float(), field->decimals, null_text);
+      break;
+  }
+}
+
+size_t telemetry_write_json(char *buffer, size_t buffer_size) {
+  if (buffer_size < 3) {
+    if (buffer_size > 0) buffer[0] = '\0';
+    return 0;
+  }
+
+  //one byte held back for the closing brace
+  telemetry_writer_t writer;
+  writer_init(&writer, buffer, buffer_size - 1);
+  append(&writer, "{");
+
+  int count = field_count;
+  for (int i = 0; i < count && writer.full == false; i++) {
+    size_t field_start = writer.length;
+    append(&writer, "%s\"%s\":", (i > 0) ? "," : "", fields[i].name);
+    append_value(&writer, &fields[i], "null");
+
+    //field didn't fit - drop it (and the rest) so the object stays complete
+    if (writer.full) {
+      writer.length = field_start;
+      buffer[field_start] = '\0';
+    }
+  }
+
+  buffer[writer.length++] = '}';
+  buffer[writer.length] = '\0';
+  return writer.length;
+}
+
+size_t telemetry_write_csv_header(char *buffer, size_t buffer_size) {
+  telemetry_writer_t writer;
+  writer_init(&writer, buffer, buffer_size);
+
+  int count = field_count;
+  for (int i = 0; i < count; i++) {
+    append(&writer, "%s%s", (i > 0) ? "," : "", fields[i].name);
+    if (fields[i].unit[0] != '\0') append(&writer, " (%s)", fields[i].unit);
+  }
+  append(&writer, "\n");
+
+  if (writer.full) {
+    if (buffer_size > 0) buffer[0] = '\0';
+    return 0;
+  }
+  return writer.length;
+}
+
+size_t telemetry_write_csv_row(char *buffer, size_t buffer_size) {
+  telemetry_writer_t writer;
+  writer_init(&writer, buffer, buffer_size);
+
+  int count = field_count;
+  for (int i = 0; i < count; i++) {
+    if (i > 0) append(&writer, ",");
+    append_value(&writer, &fields[i], "");
+  }
+  append(&writer, "\n");
+
+  if (writer.full) {
+    if (buffer_size > 0) buffer[0] = '\0';
+    return 0;
+  }
+  return writer.length;
+}
@@ -0,0 +1,41 @@
+#ifndef TELEMETRY_REGISTRY_H
+#define TELEMETRY_REGISTRY_H
+
+#include <stddef.h>
+
+//typed telemetry fields - each module registers the values it owns (from its init function) by pointer or getter
+//values are read when telemetry is serialized (web server task on core 0) - getters must be safe to call from there
+//(no hardware access - return cached values)
+//serializers write straight into a caller supplied buffer (no heap / String use)
+
+#define TELEMETRY_MAX_FIELDS 48
+
+typedef bool (*telemetry_bool_getter_t)();
+typedef int (*telemetry_int_getter_t)();
+typedef unsigned long (*telemetry_ulong_getter_t)();
+typedef float (*telemetry_float_getter_t)();
+
+//name is the JSON key / CSV column, unit is shown in the CSV header ("" if none) - both must be string literals (pointers are kept)
+//decimals = digits after the decimal point for floats (0-6)
+//register during setup only - fields past TELEMETRY_MAX_FIELDS are ignored (with a warning)
+void telemetry_register_bool(const char *name, telemetry_bool_getter_t getter);
+void telemetry_register_int(const char *name, const char *unit, telemetry_int_getter_t getter);
+void telemetry_register_ulong(const char *name, const char *unit, telemetry_ulong_getter_t getter);
+void telemetry_register_float(const char *name, const char *unit, int decimals, telemetry_float_getter_t getter);
+void telemetry_register_int_ptr(const char *name, const char *unit, const volatile int *value);
+void telemetry_register_ulong_ptr(const char *name, const char *unit, const volatile unsigned long *value);
+void telemetry_register_float_ptr(const char *name, const char *unit, int decimals, const volatile float *value);
+
+//returns number of registered fields
+int telemetry_field_count();
+
+//writes all fields as a JSON object ({"name":value,...}) - returns length written (excluding null terminator)
+//fields that don't fit in the buffer are left off (output is always a complete object)
+size_t telemetry_write_json(char *buffer, size_t buffer_size);
+
+//writes CSV header line ("name (unit),...") / one line of current values (each ending in a newline)
+//return length written - 0 if the whole line doesn't fit in the buffer
+size_t telemetry_write_csv_header(char *buffer, size_t buffer_size);
+size_t telemetry_write_csv_row(char *buffer, size_t buffer_size);
+
+#endif // TELEMETRY_REGISTRY_H
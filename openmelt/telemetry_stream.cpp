@@ -0,0 +1,281 @@
+//this module streams telemetry to web UI clients over a WebSocket
+//uses the IDF HTTP server on its own port (Arduino WebServer on port 80 is unchanged) - the stream task only builds frames and
+//queues sends, the HTTP server task does the socket writes (so a blocked socket never delays frame building)
+
+#include <Arduino.h>
+#include "melty_config.h"
+#include "telemetry_stream.h"
+#include "web_server.h"
+#include "spin_control.h"
+#include "accel_handler.h"
+#include "motor_driver.h"
+#include "rc_handler.h"
+#include "battery_monitor.h"
+#include "latency_tracer.h"
+#include "debug_handler.h"
+#include "telemetry_registry.h"
+#include <esp_http_server.h>
+#include <lwip/sockets.h>
+
+#define TELEMETRY_STREAM_TASK_STACK_SIZE 4096
+#define TELEMETRY_LATENCY_INTERVAL_MS 250     //latency percentiles recomputed this often (scans histogram)
+#define TELEMETRY_LOG_BUFFER_SIZE 2048        //same as web log buffer
+#define TELEMETRY_CLIENT_FRAME_MAX_SIZE 16    //clients don't send anything useful - larger frames close the connection
+#define TELEMETRY_SEND_TIMEOUT_MS (1000 / TELEMETRY_STREAM_RATE_HZ)   //a client socket full for one frame period is disconnected
+
+static_assert(sizeof(telemetry_frame_t) == 51, "telemetry frame layout changed - update decodeTelemetryFrame in web_server.cpp");
+static_assert(offsetof(telemetry_accel_frame_t, samples) == TELEMETRY_ACCEL_FRAME_HEADER_SIZE && sizeof(telemetry_accel_sample_t) == 10,
+              "accel frame layout changed - update decodeAccelFrame in web_server.cpp");
+static_assert(TELEMETRY_STREAM_RATE_HZ >= 50 && TELEMETRY_STREAM_RATE_HZ <= 200, "TELEMETRY_STREAM_RATE_HZ must be 50-200");
+
+typedef struct stream_client_t {
+  int fd;                            //socket (-1 = slot free)
+  uint8_t queued;                    //sends waiting in HTTP server task
+  uint16_t last_sent_sequence;       //newest frame already sent (queued sends skip duplicates)
+  uint32_t last_sent_log_version;
+} stream_client_t;
+
+static httpd_handle_t stream_server = NULL;
+static portMUX_TYPE stream_mux = portMUX_INITIALIZER_UNLOCKED;
+static stream_client_t clients[TELEMETRY_STREAM_MAX_CLIENTS];
+static telemetry_frame_t latest_frame = {};
+static telemetry_accel_frame_t latest_accel_frame = {};     //samples read with latest_frame
+static volatile uint32_t dropped_frames = 0;
+
+//only touched by HTTP server task
+static char log_send_buffer[TELEMETRY_LOG_BUFFER_SIZE];
+static telemetry_accel_frame_t accel_send_frame;
+
+unsigned long telemetry_stream_get_dropped_frames() {
+  return dropped_frames;
+}
+
+static void release_client(int client_index) {
+  portENTER_CRITICAL(&stream_mux);
+  clients[client_index].fd = -1;
+  portEXIT_CRITICAL(&stream_mux);
+}
+
+static esp_err_t send_ws_frame(int fd, httpd_ws_type_t type, const void *data, size_t length) {
+  httpd_ws_frame_t packet = {};
+  packet.final = true;
+  packet.type = type;
+  packet.payload = (uint8_t *)data;
+  packet.len = length;
+  return httpd_ws_send_frame_async(stream_server, fd, &packet);
+}
+
+//runs in HTTP server task - sends newest frame (and log text if it changed) to one client
+static void send_work(void *arg) {
+  int client_index = (int)(intptr_t)arg;
+  stream_client_t *client = &clients[client_index];
+
+  portENTER_CRITICAL(&stream_mux);
+  telemetry_frame_t frame = latest_frame;
+  size_t accel_length = TELEMETRY_ACCEL_FRAME_HEADER_SIZE + latest_accel_frame.count * sizeof(telemetry_accel_sample_t);
+  memcpy(&accel_send_frame, &latest_accel_frame, accel_length);
+  int fd = client->fd;
+  portEXIT_CRITICAL(&stream_mux);
+
+  //a client that misses a frame also misses the accel samples sent with it
+  esp_err_t result = ESP_OK;
+  if (fd >= 0 && frame.sequence != client->last_sent_sequence) {
+    result = send_ws_frame(fd, HTTPD_WS_TYPE_BINARY, &frame, sizeof(frame));
+    if (result == ESP_OK && accel_send_frame.count > 0) {
+      result = send_ws_frame(fd, HTTPD_WS_TYPE_BINARY, &accel_send_frame, accel_length);
+    }
+    client->last_sent_sequence = frame.sequence;
+  }
+
+  uint32_t log_version = web_get_log_version();
+  if (fd >= 0 && result == ESP_OK && log_version != client->last_sent_log_version) {
+    size_t length = web_copy_logs(log_send_buffer, sizeof(log_send_buffer));
+    result = send_ws_frame(fd, HTTPD_WS_TYPE_TEXT, log_send_buffer, length);
+    client->last_sent_log_version = log_version;
+  }
+
+  //send fails if the client disconnected (or its socket stayed full for TELEMETRY_SEND_TIMEOUT_MS)
+  //a timed out send may have written part of a frame - the connection can't be reused, the page reconnects
+  if (fd >= 0 && result != ESP_OK) {
+    httpd_sess_trigger_close(stream_server, fd);
+    release_client(client_index);
+    LOG_INFO(WEB, "Telemetry stream client %d disconnected", client_index);
+  }
+
+  portENTER_CRITICAL(&stream_mux);
+  client->queued--;
+  portEXIT_CRITICAL(&stream_mux);
+}
+
+//all sends run in the one HTTP server task - the server's send_wait_timeout is whole seconds, so a single full
+//client socket would stall every other client that long. send timeout is cut to one frame period instead
+static esp_err_t open_client_socket(httpd_handle_t server, int sockfd) {
+  struct timeval timeout = {};
+  timeout.tv_sec = 0;
+  timeout.tv_usec = TELEMETRY_SEND_TIMEOUT_MS * 1000;
+  setsockopt(sockfd, SOL_SOCKET, SO_SNDTIMEO, &timeout, sizeof(timeout));
+  return ESP_OK;
+}
+
+//WebSocket handshake registers client - frames from client are read and ignored
+static esp_err_t stream_handler(httpd_req_t *req) {
+  int fd = httpd_req_to_sockfd(req);
+
+  if (req->method == HTTP_GET) {
+    int client_index = -1;
+    portENTER_CRITICAL(&stream_mux);
+    for (int i = 0; i < TELEMETRY_STREAM_MAX_CLIENTS; i++) {
+      if (clients[i].fd == fd || (client_index < 0 && clients[i].fd < 0)) client_index = i;
+    }
+    if (client_index >= 0) {
+      clients[client_index].fd = fd;
+      clients[client_index].last_sent_sequence = latest_frame.sequence;
+      clients[client_index].last_sent_log_version = 0;
+    }
+    portEXIT_CRITICAL(&stream_mux);
+
+    if (client_index < 0) {
+      LOG_WARNING(WEB, "Telemetry stream full - connection refused");
+      return ESP_FAIL;
+    }
+    LOG_INFO(WEB, "Telemetry stream client %d connected", client_index);
+    return ESP_OK;
+  }
+
+  uint8_t buffer[TELEMETRY_CLIENT_FRAME_MAX_SIZE];
+  httpd_ws_frame_t packet = {};
+  esp_err_t result = httpd_ws_recv_frame(req, &packet, 0);
+  if (result != ESP_OK || packet.len > sizeof(buffer)) return ESP_FAIL;
+  if (packet.len > 0) {
+    packet.payload = buffer;
+    result = httpd_ws_recv_frame(req, &packet, sizeof(buffer));
+  }
+  return result;
+}
+
+static void build_frame(telemetry_frame_t *frame, const latency_stats_t *motor_latency) {
+  const struct rc_state_t *rc_state = rc_get_state();
+
+  frame->version = TELEMETRY_FRAME_VERSION;
+  frame->flags = 0;
+  if (get_config_mode()) frame->flags |= TELEMETRY_FLAG_CONFIG_MODE;
+  if (rc_state->healthy) frame->flags |= TELEMETRY_FLAG_RC_HEALTHY;
+  frame->sequence++;
+  frame->time_ms = millis();
+  frame->rpm = get_current_rpm();
+  frame->battery_mv = get_battery_voltage() * 1000.0f;
+
+  float x_g, y_g, z_g;
+  get_last_accel_g(&x_g, &y_g, &z_g);
+  frame->accel_g = x_g;
+  frame->accel_used_g = x_g - get_accel_zero_g_offset();
+  frame->accel_x_g = x_g;
+  frame->accel_y_g = y_g;
+  frame->accel_z_g = z_g;
+
+  frame->motor_pulse_width[0] = get_motor1_pulse_width();
+  frame->motor_pulse_width[1] = get_motor2_pulse_width();
+  frame->rc_throttle_percent = rc_state->throttle_percent;
+  frame->rc_steering_permille = rc_state->steering_permille;
+
+  frame->latency_motor_p50_us = motor_latency->p50_us;
+  frame->latency_motor_p99_us = motor_latency->p99_us;
+  frame->latency_motor_max_us = motor_latency->max_us;
+}
+
+//copies accelerometer samples read since the previous frame
+static void build_accel_frame(telemetry_accel_frame_t *frame, uint32_t *next_sample) {
+  accel_sample_t samples[TELEMETRY_ACCEL_FRAME_MAX_SAMPLES];
+  int count = accel_read_samples(samples, TELEMETRY_ACCEL_FRAME_MAX_SAMPLES, next_sample);
+
+  frame->id = TELEMETRY_ACCEL_FRAME_ID;
+  frame->count = count;
+  frame->time_ms = millis();
+  frame->time_us = micros();
+  frame->g_per_count = accel_counts_to_g(1);
+  for (int i = 0; i < count; i++) {
+    frame->samples[i].time_us = samples[i].time_us;
+    frame->samples[i].x = samples[i].x;
+    frame->samples[i].y = samples[i].y;
+    frame->samples[i].z = samples[i].z;
+  }
+}
+
+static void telemetry_stream_task(void *parameter) {
+  telemetry_frame_t frame = {};
+  static telemetry_accel_frame_t accel_frame;
+  uint32_t next_accel_sample = 0;
+  latency_stats_t motor_latency = {};
+  unsigned long last_latency_update_ms = 0;
+  TickType_t last_wake = xTaskGetTickCount();
+
+  while (true) {
+    vTaskDelayUntil(&last_wake, pdMS_TO_TICKS(1000 / TELEMETRY_STREAM_RATE_HZ));
+
+    if (millis() - last_latency_update_ms >= TELEMETRY_LATENCY_INTERVAL_MS) {
+      last_latency_update_ms = millis();
+      motor_latency = latency_get_stats(LATENCY_STAGE_MOTOR);
+    }
+    build_frame(&frame, &motor_latency);
+    build_accel_frame(&accel_frame, &next_accel_sample);
+    size_t accel_length = TELEMETRY_ACCEL_FRAME_HEADER_SIZE + accel_frame.count * sizeof(telemetry_accel_sample_t);
+
+    portENTER_CRITICAL(&stream_mux);
+    latest_frame = frame;
+    memcpy(&latest_accel_frame, &accel_frame, accel_length);
+    portEXIT_CRITICAL(&stream_mux);
+
+    //queue a send for each client - unless it still has TELEMETRY_STREAM_MAX_QUEUED waiting (slow client misses this frame)
+    for (int i = 0; i < TELEMETRY_STREAM_MAX_CLIENTS; i++) {
+      bool queue_send = false;
+      portENTER_CRITICAL(&stream_mux);
+      if (clients[i].fd >= 0) {
+        if (clients[i].queued < TELEMETRY_STREAM_MAX_QUEUED) {
+          clients[i].queued++;
+          queue_send = true;
+        } else {
+          dropped_frames++;
+        }
+      }
+      portEXIT_CRITICAL(&stream_mux);
+
+      if (queue_send && httpd_queue_work(stream_server, send_work, (void *)(intptr_t)i) != ESP_OK) {
+        portENTER_CRITICAL(&stream_mux);
+        clients[i].queued--;
+        dropped_frames++;
+        portEXIT_CRITICAL(&stream_mux);
+      }
+    }
+  }
+}
+
+void init_telemetry_stream() {
+  for (int i = 0; i < TELEMETRY_STREAM_MAX_CLIENTS; i++) clients[i].fd = -1;
+
+  httpd_config_t config = HTTPD_DEFAULT_CONFIG();
+  config.server_port = TELEMETRY_STREAM_PORT;
+  config.core_id = 0;
+  config.max_open_sockets = TELEMETRY_STREAM_MAX_CLIENTS + 1;
+  config.lru_purge_enable = true;
+  config.open_fn = open_client_socket;                    //sets send timeout (replaces send_wait_timeout)
+
+  esp_err_t result = httpd_start(&stream_server, &config);
+  if (result != ESP_OK) {
+    LOG_ERROR(WEB, "Telemetry stream server start failed: %s", esp_err_to_name(result));
+    return;
+  }
+
+  httpd_uri_t stream_uri = {};
+  stream_uri.uri = "/stream";
+  stream_uri.method = HTTP_GET;
+  stream_uri.handler = stream_handler;
+  stream_uri.is_websocket = true;
+  httpd_register_uri_handler(stream_server, &stream_uri);
+
+  //frames not sent to slow clients
+  telemetry_register_ulong("streamDrops", "", telemetry_stream_get_dropped_frames);
+
+  xTaskCreatePinnedToCore(telemetry_stream_task, "telemetry_stream", TELEMETRY_STREAM_TASK_STACK_SIZE, NULL, 1, NULL, 0);
+
+  LOG_INFO(WEB, "Telemetry stream on port %d at %d Hz", TELEMETRY_STREAM_PORT, TELEMETRY_STREAM_RATE_HZ);
+}
@@ -0,0 +1,64 @@
+#ifndef TELEMETRY_STREAM_H
+#define TELEMETRY_STREAM_H
+
+#include <stdint.h>
+
+//telemetry pushed to web UI clients over a WebSocket (ws://<robot ip>:TELEMETRY_STREAM_PORT/stream)
+//a packed binary frame is sent TELEMETRY_STREAM_RATE_HZ times a second - log text is sent as a text frame when it changes
+//accelerometer samples read since the previous frame follow it in a second binary frame (every sample, not just the latest)
+//each client has at most TELEMETRY_STREAM_MAX_QUEUED sends waiting - a slow client misses frames instead of stalling the stream
+
+#define TELEMETRY_FRAME_VERSION 1
+
+#define TELEMETRY_FLAG_CONFIG_MODE 0x01
+#define TELEMETRY_FLAG_RC_HEALTHY 0x02
+
+//all fields little-endian - decoded in the web UI with DataView (keep decodeTelemetryFrame in web_server.cpp in sync)
+typedef struct __attribute__((packed)) telemetry_frame_t {
+  uint8_t version;              //TELEMETRY_FRAME_VERSION
+  uint8_t flags;                //TELEMETRY_FLAG_*
+  uint16_t sequence;            //increments every frame (gaps = frames dropped for this client)
+  uint32_t time_ms;             //millis() when frame was built
+  uint16_t rpm;                 //latest RPM estimate
+  uint16_t battery_mv;          //battery voltage (0 if not available)
+  float accel_g;                //latest accelerometer reading used for RPM (X axis)
+  float accel_used_g;           //accel_g less zero g offset
+  float accel_x_g;
+  float accel_y_g;
+  float accel_z_g;
+  uint16_t motor_pulse_width[2]; //servo-style pulse width (us) of each motor
+  uint8_t rc_throttle_percent;
+  int16_t rc_steering_permille;
+  uint32_t latency_motor_p50_us; //RC frame to motor output latency
+  uint32_t latency_motor_p99_us;
+  uint32_t latency_motor_max_us;
+} telemetry_frame_t;
+
+#define TELEMETRY_ACCEL_FRAME_ID 0xA1            //first byte of accel frames (telemetry frames start with TELEMETRY_FRAME_VERSION)
+#define TELEMETRY_ACCEL_FRAME_MAX_SAMPLES 32
+#define TELEMETRY_ACCEL_FRAME_HEADER_SIZE 14
+
+typedef struct __attribute__((packed)) telemetry_accel_sample_t {
+  uint32_t time_us;             //micros() when read
+  int16_t x;                    //raw counts (multiply by g_per_count)
+  int16_t y;
+  int16_t z;
+} telemetry_accel_sample_t;
+
+//only the header and count samples are sent (keep decodeAccelFrame in web_server.cpp in sync)
+typedef struct __attribute__((packed)) telemetry_accel_frame_t {
+  uint8_t id;                   //TELEMETRY_ACCEL_FRAME_ID
+  uint8_t count;                //samples in frame
+  uint32_t time_ms;             //millis() / micros() when frame was built - sample times are converted using the difference
+  uint32_t time_us;
+  float g_per_count;
+  telemetry_accel_sample_t samples[TELEMETRY_ACCEL_FRAME_MAX_SAMPLES];
+} telemetry_accel_frame_t;
+
+//starts WebSocket server / stream task (core 0) - call once WiFi is up
+void init_telemetry_stream();
+
+//returns number of frames not sent to a client because it had TELEMETRY_STREAM_MAX_QUEUED sends waiting
+unsigned long telemetry_stream_get_dropped_frames();
+
+#endif // TELEMETRY_STREAM_H
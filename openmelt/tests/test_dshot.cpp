@@ -0,0 +1,110 @@
+//host tests for DShot packet encoding / eRPM decoding (dshot_packet.cpp) - build and run with "make" in this directory
+
+#include <stdio.h>
+#include "dshot.h"
+
+static int failures = 0;
+
+#define CHECK_EQUAL(expected, actual) check_equal((long)(expected), (long)(actual), #actual, __LINE__)
+
+static void check_equal(long expected, long actual, const char *expression, int line) {
+  if (expected == actual) return;
+  printf("line %d: %s = %ld (0x%lx), expected %ld (0x%lx)\n", line, expression, actual, actual, expected, expected);
+  failures++;
+}
+
+static void test_make_packet() {
+  //value 1046 -> 0x82C6 is the worked example from the DShot protocol description
+  CHECK_EQUAL(0x82C6, dshot_make_packet(1046, false, false));
+  CHECK_EQUAL(0x0000, dshot_make_packet(DSHOT_VALUE_STOP, false, false));
+  CHECK_EQUAL(0x0606, dshot_make_packet(DSHOT_VALUE_MIN, false, false));
+  CHECK_EQUAL(0xFFEE, dshot_make_packet(DSHOT_VALUE_MAX, false, false));
+
+  //values past 11 bits are masked
+  CHECK_EQUAL(0x0000, dshot_make_packet(2048, false, false));
+
+  //telemetry request bit (set for ESC commands 1-47)
+  CHECK_EQUAL(0x82D7, dshot_make_packet(1046, true, false));
+  CHECK_EQUAL(0x0154, dshot_make_packet(10, true, false));
+
+  //bidirectional - CRC inverted
+  CHECK_EQUAL(0x82C9, dshot_make_packet(1046, false, true));
+  CHECK_EQUAL(0x000F, dshot_make_packet(DSHOT_VALUE_STOP, false, true));
+  CHECK_EQUAL(0xFFE1, dshot_make_packet(DSHOT_VALUE_MAX, false, true));
+
+  //every value: top 12 bits carry value + telemetry bit, CRC nibble is the XOR of the other three
+  for (int value = 0; value <= DSHOT_VALUE_MAX; value++) {
+    for (int telemetry = 0; telemetry <= 1; telemetry++) {
+      uint16_t packet = dshot_make_packet(value, telemetry, false);
+      uint16_t inverted = dshot_make_packet(value, telemetry, true);
+      CHECK_EQUAL((value << 1) | telemetry, packet >> 4);
+      CHECK_EQUAL(((packet >> 4) ^ (packet >> 8) ^ (packet >> 12)) & 0x0F, packet & 0x0F);
+      CHECK_EQUAL(packet ^ 0x0F, inverted);
+    }
+  }
+}
+
+static void test_value_from_pulse_width() {
+  //forward only - neutral and below stop, 1000us span maps to 48-2047
+  CHECK_EQUAL(DSHOT_VALUE_STOP, dshot_value_from_pulse_width(1500, false));
+  CHECK_EQUAL(DSHOT_VALUE_STOP, dshot_value_from_pulse_width(1000, false));
+  CHECK_EQUAL(51, dshot_value_from_pulse_width(1501, false));
+  CHECK_EQUAL(1047, dshot_value_from_pulse_width(1750, false));
+  CHECK_EQUAL(DSHOT_VALUE_MAX, dshot_value_from_pulse_width(2000, false));
+
+  //3D - 48-1047 reverse, 1048-2047 forward
+  CHECK_EQUAL(DSHOT_VALUE_STOP, dshot_value_from_pulse_width(1500, true));
+  CHECK_EQUAL(1049, dshot_value_from_pulse_width(1501, true));
+  CHECK_EQUAL(DSHOT_VALUE_MAX, dshot_value_from_pulse_width(2000, true));
+  CHECK_EQUAL(49, dshot_value_from_pulse_width(1499, true));
+  CHECK_EQUAL(1047, dshot_value_from_pulse_width(1000, true));
+
+  //out of range pulses are clamped
+  CHECK_EQUAL(DSHOT_VALUE_MAX, dshot_value_from_pulse_width(2600, false));
+  CHECK_EQUAL(DSHOT_VALUE_STOP, dshot_value_from_pulse_width(400, false));
+  CHECK_EQUAL(DSHOT_VALUE_MAX, dshot_value_from_pulse_width(3000, true));
+  CHECK_EQUAL(1047, dshot_value_from_pulse_width(0, true));
+
+  //never lands in the command range (1-47)
+  for (int pulse_width = 900; pulse_width <= 2100; pulse_width++) {
+    for (int mode_3d = 0; mode_3d <= 1; mode_3d++) {
+      uint16_t value = dshot_value_from_pulse_width(pulse_width, mode_3d);
+      if (value != DSHOT_VALUE_STOP && (value < DSHOT_VALUE_MIN || value > DSHOT_VALUE_MAX)) {
+        CHECK_EQUAL(DSHOT_VALUE_MIN, value);
+      }
+    }
+  }
+}
+
+//reply words below were built from the bidirectional DShot description (independent of dshot_packet.cpp):
+//12 bit period (3 bit shift + 9 bit mantissa) + CRC nibble (XOR of all four = 0xF) -> 4 GCR symbols -> start bit + 20 bits
+static void test_decode_erpm() {
+  CHECK_EQUAL(60000, dshot_decode_erpm(0x19BFB7));     //0x3F47 - 500 << 1 = 1000us
+  CHECK_EQUAL(600000, dshot_decode_erpm(0x1CDBAD));    //0x064D - 100us
+  CHECK_EQUAL(3005, dshot_decode_erpm(0x16CF49));      //0xD389 - 312 << 6 = 19968us
+  CHECK_EQUAL(0, dshot_decode_erpm(0x17BDF9));         //0xFFF0 - motor stopped
+
+  //start bit is ignored
+  CHECK_EQUAL(60000, dshot_decode_erpm(0x09BFB7));
+
+  //bad CRC (CRC nibble 7 -> 6)
+  CHECK_EQUAL(DSHOT_ERPM_INVALID, dshot_decode_erpm(0x19BFB6));
+
+  //invalid GCR symbols (0x00 / 0x1F don't map to a nibble)
+  CHECK_EQUAL(DSHOT_ERPM_INVALID, dshot_decode_erpm(0x19BFA0));
+  CHECK_EQUAL(DSHOT_ERPM_INVALID, dshot_decode_erpm(0x19BFBF));
+  CHECK_EQUAL(DSHOT_ERPM_INVALID, dshot_decode_erpm(0));
+}
+
+int main() {
+  test_make_packet();
+  test_value_from_pulse_width();
+  test_decode_erpm();
+
+  if (failures > 0) {
+    printf("test_dshot: %d failures\n", failures);
+    return 1;
+  }
+  printf("test_dshot: passed\n");
+  return 0;
+}
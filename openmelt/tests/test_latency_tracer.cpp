@@ -0,0 +1,97 @@
+//host tests for latency histograms (latency_tracer.cpp) - build and run with "make" in this directory
+
+#include <stdio.h>
+#include "latency_tracer.h"
+
+static int failures = 0;
+
+#define CHECK_EQUAL(expected, actual) check_equal((long)(expected), (long)(actual), #actual, __LINE__)
+
+static void check_equal(long expected, long actual, const char *expression, int line) {
+  if (expected == actual) return;
+  printf("line %d: %s = %ld, expected %ld\n", line, expression, actual, expected);
+  failures++;
+}
+
+static void test_percentiles() {
+  //one frame in each of bins 0-99 (50us into the bin)
+  for (uint32_t i = 0; i < 100; i++) {
+    uint32_t frame_us = 1000 + (i * 100000);
+    latency_record(LATENCY_STAGE_PARAMS, frame_us, frame_us + (i * LATENCY_BIN_US) + 50);
+  }
+
+  latency_stats_t stats = latency_get_stats(LATENCY_STAGE_PARAMS);
+  CHECK_EQUAL(100, stats.count);
+  CHECK_EQUAL(5000, stats.p50_us);     //50th frame is in bin 49 - upper edge
+  CHECK_EQUAL(9900, stats.p99_us);     //99th frame is in bin 98
+  CHECK_EQUAL(9950, stats.max_us);     //exact
+}
+
+static void test_top_bin_clamped() {
+  for (uint32_t i = 0; i < 99; i++) latency_record(LATENCY_STAGE_MOTOR, 1000 + i, 1000 + i + 150);
+  latency_record(LATENCY_STAGE_MOTOR, 2000, 2000 + 30000);
+
+  latency_stats_t stats = latency_get_stats(LATENCY_STAGE_MOTOR);
+  CHECK_EQUAL(100, stats.count);
+  CHECK_EQUAL(200, stats.p50_us);
+  CHECK_EQUAL(200, stats.p99_us);
+  CHECK_EQUAL(30000, stats.max_us);
+
+  //past the last bin - p99 reports the top of the histogram, max stays exact
+  latency_record(LATENCY_STAGE_MOTOR, 3000, 3000 + 40000);
+  latency_record(LATENCY_STAGE_MOTOR, 4000, 4000 + 40000);
+  stats = latency_get_stats(LATENCY_STAGE_MOTOR);
+  CHECK_EQUAL(102, stats.count);
+  CHECK_EQUAL(LATENCY_BINS * LATENCY_BIN_US, stats.p99_us);
+  CHECK_EQUAL(40000, stats.max_us);
+}
+
+static void test_repeats_and_wrap() {
+  //first output for a frame counts - later outputs for the same frame are ignored
+  latency_record(LATENCY_STAGE_LED, 5000, 5300);
+  latency_record(LATENCY_STAGE_LED, 5000, 9000);
+
+  //no frame captured yet
+  latency_record(LATENCY_STAGE_LED, 0, 9000);
+
+  latency_stats_t stats = latency_get_stats(LATENCY_STAGE_LED);
+  CHECK_EQUAL(1, stats.count);
+  CHECK_EQUAL(300, stats.max_us);
+
+  //micros() wrapped between frame and output
+  latency_record(LATENCY_STAGE_LED, 0xFFFFFF00UL, 0x00000100UL);
+  stats = latency_get_stats(LATENCY_STAGE_LED);
+  CHECK_EQUAL(2, stats.count);
+  CHECK_EQUAL(512, stats.max_us);
+}
+
+static void test_reset() {
+  latency_reset();
+
+  //cleared by the recorder - reads as empty until the next record
+  for (int stage = 0; stage < LATENCY_STAGE_COUNT; stage++) {
+    CHECK_EQUAL(0, latency_get_stats((latency_stage_enum)stage).count);
+    CHECK_EQUAL(0, latency_get_stats((latency_stage_enum)stage).max_us);
+  }
+
+  latency_record(LATENCY_STAGE_PARAMS, 7000, 7100);
+  latency_stats_t stats = latency_get_stats(LATENCY_STAGE_PARAMS);
+  CHECK_EQUAL(1, stats.count);
+  CHECK_EQUAL(100, stats.max_us);
+  CHECK_EQUAL(0, latency_get_stats(LATENCY_STAGE_MOTOR).count);
+  CHECK_EQUAL(0, latency_get_stats(LATENCY_STAGE_LED).count);
+}
+
+int main() {
+  test_percentiles();
+  test_top_bin_clamped();
+  test_repeats_and_wrap();
+  test_reset();
+
+  if (failures > 0) {
+    printf("test_latency_tracer: %d failures\n", failures);
+    return 1;
+  }
+  printf("test_latency_tracer: passed\n");
+  return 0;
+}
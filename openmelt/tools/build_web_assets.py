@@ -0,0 +1,132 @@
+#!/usr/bin/env python3
+"""Web UI asset builder for openmelt.
+
+Gzips the web UI sources into web_assets.h (served by web_server.cpp with Content-Encoding: gzip and an ETag).
+Rerun after editing any of the sources below - or after changing TELEMETRY_STREAM_PORT in melty_config.h
+(web_server.cpp won't compile until the header matches). The generated header is committed so the sketch still
+builds straight from the Arduino IDE.
+
+  web/index.html               main page (%TELEMETRY_STREAM_PORT% is replaced from melty_config.h)
+  web/TinyLinePlot.js          plotting library used by the page
+
+Output is deterministic (gzip timestamp is 0) - an unchanged source gives an unchanged header and ETag.
+
+Examples:
+  build_web_assets.py                 (regenerates web_assets.h)
+  build_web_assets.py --check         (fails if web_assets.h is out of date)
+"""
+
+import argparse
+import gzip
+import hashlib
+import os
+import re
+import sys
+
+SKETCH_DIR = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+OUTPUT = os.path.join(SKETCH_DIR, "web_assets.h")
+CONFIG = os.path.join(SKETCH_DIR, "melty_config.h")
+
+#(name in web_assets.h, source, content type)
+ASSETS = [
+    ("index_html", "web/index.html", "text/html"),
+    ("tiny_line_plot_js", "web/TinyLinePlot.js", "application/javascript"),
+]
+
+#config values substituted into the sources (%NAME%) - also written to web_assets.h so a mismatch fails the build
+CONFIG_VALUES = ["TELEMETRY_STREAM_PORT"]
+
+BYTES_PER_LINE = 20
+
+
+def read_config():
+    with open(CONFIG) as file:
+        text = file.read()
+    values = {}
+    for name in CONFIG_VALUES:
+        match = re.search(r"^\s*#define\s+" + name + r"\s+(\S+)", text, re.MULTILINE)
+        if not match:
+            sys.exit(f"{name} not found in melty_config.h")
+        values[name] = match.group(1)
+    return values
+
+
+def build_asset(source, config):
+    with open(os.path.join(SKETCH_DIR, source), "rb") as file:
+        data = file.read()
+    for name, value in config.items():
+        data = data.replace(f"%{name}%".encode(), value.encode())
+    compressed = gzip.compress(data, compresslevel=9, mtime=0)
+    #strong ETag - hash of what is actually sent
+    etag = hashlib.sha256(compressed).hexdigest()[:16]
+    return data, compressed, etag
+
+
+def c_array(data):
+    lines = []
+    for offset in range(0, len(data), BYTES_PER_LINE):
+        lines.append("  " + ", ".join(f"0x{byte:02x}" for byte in data[offset:offset + BYTES_PER_LINE]) + ",")
+    return "\n".join(lines)
+
+
+def generate(config):
+    out = ["//generated by tools/build_web_assets.py - do not edit (edit the sources and rerun the script)",
+           "#ifndef WEB_ASSETS_H",
+           "#define WEB_ASSETS_H",
+           "",
+           "#include <Arduino.h>",
+           "",
+           "typedef struct web_asset_t {",
+           "  const char *content_type;",
+           "  const uint8_t *data;              //gzip compressed",
+           "  size_t length;",
+           "  const char *etag;                 //quoted (as sent in ETag / If-None-Match)",
+           "} web_asset_t;",
+           ""]
+    for name, value in config.items():
+        out.append(f"#define WEB_ASSETS_{name} {value}")
+    out.append("")
+
+    summary = []
+    for name, source, content_type in ASSETS:
+        data, compressed, etag = build_asset(source, config)
+        summary.append(f"{source}: {len(data)} -> {len(compressed)} bytes")
+        out += [f"//{source} ({len(data)} bytes uncompressed)",
+                f"static const uint8_t web_asset_{name}_gz[] PROGMEM = {{",
+                c_array(compressed),
+                "};",
+                "",
+                f"static const web_asset_t web_asset_{name} = {{",
+                f"  \"{content_type}\", web_asset_{name}_gz, sizeof(web_asset_{name}_gz), \"\\\"{etag}\\\"\"",
+                "};",
+                ""]
+    out += ["#endif // WEB_ASSETS_H", ""]
+    return "\n".join(out), summary
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("--check", action="store_true", help="only check that web_assets.h is up to date")
+    args = parser.parse_args()
+
+    header, summary = generate(read_config())
+
+    if args.check:
+        try:
+            with open(OUTPUT) as file:
+                current = file.read()
+        except FileNotFoundError:
+            current = None
+        if current != header:
+            sys.exit("web_assets.h is out of date - run tools/build_web_assets.py")
+        print("web_assets.h is up to date")
+        return
+
+    with open(OUTPUT, "w", newline="\n") as file:
+        file.write(header)
+    for line in summary:
+        print(line)
+
+
+if __name__ == "__main__":
+    main()
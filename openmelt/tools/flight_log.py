@@ -0,0 +1,178 @@
+#!/usr/bin/env python3
+"""Flight log decoder for openmelt.
+
+Converts a flight log downloaded from /flightlog (Download Flight Log in the web UI) to CSV - and Parquet if
+pandas / pyarrow are installed.
+
+Log format (see flight_log.h - all little-endian):
+  4096 byte blocks - header followed by records (records never span blocks, unused blocks are skipped)
+  header:   magic "FLG1" | sequence | session | used | dropped | version | reserved (3) | g_per_count
+  rotation: type 1 | flags | rpm | time_us | rotation_interval_us | throttle_permille | steering_permille |
+            translate_forback | reserved | motor 1 / 2 pulse width | battery_mv
+  accel:    type 2 | reserved | x | y | z (raw counts - scaled by g_per_count) | time_us
+
+Blocks are put in sequence order. Each boot starts a new session - time_us is micros() on the robot (wraps every
+~71 minutes) so time_s is unwrapped and starts at 0 for each session.
+
+Examples:
+  flight_log.py flightlog.bin                    (writes flightlog_rotations.csv / flightlog_accel.csv)
+  flight_log.py flightlog.bin --session last --parquet
+"""
+
+import argparse
+import csv
+import os
+import struct
+import sys
+
+BLOCK_SIZE = 4096
+MAGIC = 0x31474C46
+VERSION = 1
+
+HEADER = struct.Struct("<IIIHHBBHf")
+ROTATION = struct.Struct("<BBHIIHhbBHHH")
+ACCEL = struct.Struct("<BBhhhI")
+
+RECORD_ROTATION = 1
+RECORD_ACCEL = 2
+
+FLAG_CONFIG_MODE = 0x01
+FLAG_SPIN_UP = 0x02
+FLAG_WHEEL_SLIP = 0x04
+
+ROTATION_COLUMNS = ["session", "time_s", "time_us", "rpm", "rotation_interval_us", "throttle_permille",
+                    "steering_permille", "translate_forback", "motor1_pulse_us", "motor2_pulse_us", "battery_v",
+                    "config_mode", "spin_up", "wheel_slip"]
+ACCEL_COLUMNS = ["session", "time_s", "time_us", "x_g", "y_g", "z_g"]
+
+
+def read_blocks(data):
+    """returns valid blocks as (header fields, record bytes) in sequence order - repeated sequences are only kept once"""
+    blocks = []
+    sequences = set()
+    for offset in range(0, len(data) - BLOCK_SIZE + 1, BLOCK_SIZE):
+        header = HEADER.unpack_from(data, offset)
+        magic, sequence, session, used, dropped, version, _, _, g_per_count = header
+        if magic != MAGIC:
+            continue
+        if version != VERSION or used > BLOCK_SIZE - HEADER.size:
+            print(f"skipping block {offset // BLOCK_SIZE} (version {version}, {used} bytes)", file=sys.stderr)
+            continue
+        if sequence in sequences:
+            print(f"skipping block {offset // BLOCK_SIZE} (sequence {sequence} already read)", file=sys.stderr)
+            continue
+        sequences.add(sequence)
+        start = offset + HEADER.size
+        blocks.append(({"sequence": sequence, "session": session, "dropped": dropped, "g_per_count": g_per_count},
+                       data[start:start + used]))
+    blocks.sort(key=lambda block: block[0]["sequence"])
+    return blocks
+
+
+class SessionClock:
+    """unwraps 32 bit micros() per session - records aren't strictly in time order so small steps back are allowed"""
+
+    def __init__(self):
+        self.last = {}
+
+    def seconds(self, session, time_us):
+        if session not in self.last:
+            self.last[session] = (time_us, 0)
+        last_us, last_unwrapped = self.last[session]
+        delta = (time_us - last_us) & 0xFFFFFFFF
+        if delta >= 0x80000000:
+            delta -= 0x100000000
+        unwrapped = last_unwrapped + delta
+        self.last[session] = (time_us, unwrapped)
+        return unwrapped / 1e6
+
+
+def decode(blocks):
+    rotations = []
+    accel = []
+    dropped = 0
+    clock = SessionClock()
+
+    for header, records in blocks:
+        session = f"{header['session']:08x}"
+        dropped += header["dropped"]
+        offset = 0
+        while offset < len(records):
+            record_type = records[offset]
+            if record_type == RECORD_ROTATION and offset + ROTATION.size <= len(records):
+                (_, flags, rpm, time_us, interval_us, throttle, steering, forback, _, pulse_1, pulse_2,
+                 battery_mv) = ROTATION.unpack_from(records, offset)
+                rotations.append([session, round(clock.seconds(session, time_us), 6), time_us, rpm, interval_us,
+                                  throttle, steering, forback, pulse_1, pulse_2, battery_mv / 1000.0,
+                                  int(bool(flags & FLAG_CONFIG_MODE)), int(bool(flags & FLAG_SPIN_UP)),
+                                  int(bool(flags & FLAG_WHEEL_SLIP))])
+                offset += ROTATION.size
+            elif record_type == RECORD_ACCEL and offset + ACCEL.size <= len(records):
+                _, _, x, y, z, time_us = ACCEL.unpack_from(records, offset)
+                scale = header["g_per_count"]
+                accel.append([session, round(clock.seconds(session, time_us), 6), time_us,
+                              round(x * scale, 3), round(y * scale, 3), round(z * scale, 3)])
+                offset += ACCEL.size
+            else:
+                print(f"unknown record type {record_type} in block {header['sequence']} - rest of block skipped",
+                      file=sys.stderr)
+                break
+
+    return rotations, accel, dropped
+
+
+def rebase_times(rotations, accel):
+    """shifts time_s so each session starts at 0"""
+    start = {}
+    for row in rotations + accel:
+        start[row[0]] = min(start.get(row[0], row[1]), row[1])
+    for row in rotations + accel:
+        row[1] = round(row[1] - start[row[0]], 6)
+
+
+def write_csv(path, columns, rows):
+    with open(path, "w", newline="") as file:
+        writer = csv.writer(file)
+        writer.writerow(columns)
+        writer.writerows(rows)
+
+
+def write_parquet(path, columns, rows):
+    import pandas
+    pandas.DataFrame(rows, columns=columns).to_parquet(path, index=False)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("log", help="flight log downloaded from /flightlog")
+    parser.add_argument("--out", help="output file prefix (default: log file name without extension)")
+    parser.add_argument("--session", default="all", help="'all', 'last' or a session id (hex)")
+    parser.add_argument("--parquet", action="store_true", help="also write .parquet files (needs pandas + pyarrow)")
+    args = parser.parse_args()
+
+    with open(args.log, "rb") as file:
+        blocks = read_blocks(file.read())
+    if not blocks:
+        sys.exit("no flight log blocks found")
+
+    if args.session != "all":
+        session = blocks[-1][0]["session"] if args.session == "last" else int(args.session, 16)
+        blocks = [block for block in blocks if block[0]["session"] == session]
+
+    rotations, accel, dropped = decode(blocks)
+    rebase_times(rotations, accel)
+
+    prefix = args.out or os.path.splitext(args.log)[0]
+    outputs = [(prefix + "_rotations", ROTATION_COLUMNS, rotations), (prefix + "_accel", ACCEL_COLUMNS, accel)]
+    for name, columns, rows in outputs:
+        write_csv(name + ".csv", columns, rows)
+        if args.parquet:
+            write_parquet(name + ".parquet", columns, rows)
+
+    sessions = len({row[0] for row in rotations + accel})
+    print(f"{len(blocks)} blocks, {sessions} sessions: {len(rotations)} rotations, {len(accel)} accel samples"
+          f" ({dropped} records dropped on robot)")
+
+
+if __name__ == "__main__":
+    main()
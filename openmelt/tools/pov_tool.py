@@ -0,0 +1,213 @@
+#!/usr/bin/env python3
+"""POV display bitmap tool for openmelt.
+
+encode   - converts an image to a .pov bitmap (upload from the POV tab of the web UI)
+simulate - renders what a .pov bitmap looks like on a spinning robot
+
+Bitmap format (see pov_display.h):
+  "POV1" | angle bins | LED count | color R, G, B | columns
+  each column is (LED count + 7) / 8 bytes, LSB of first byte = LED 0 - columns run clockwise from heading
+
+The simulator mirrors the firmware: the bin is picked from the time in the rotation the same way pov_render()
+does, and each column change costs one LED frame (30us per LED + 300us reset) during which the LEDs keep
+showing the previous column. Requests made while a frame is being sent are coalesced (only the latest is sent).
+
+Examples:
+  pov_tool.py encode logo.png logo.pov --bins 64 --leds 4 --color ff0000
+  pov_tool.py simulate logo.pov --rpm 2000 --out logo_sim.png
+"""
+
+import argparse
+import math
+import sys
+
+MAGIC = b"POV1"
+HEADER_SIZE = 9
+
+LED_BIT_US = 30          # WS2812 frame time per LED (24 bits x 1.25us)
+LED_RESET_US = 300       # reset time after each frame (led_driver.cpp)
+LOOP_PASS_US = 20        # control loop pass time (pov_render is called once per pass)
+
+
+def bytes_per_column(leds):
+    return (leds + 7) // 8
+
+
+def encode_bitmap(columns, leds, color):
+    data = bytearray(MAGIC)
+    data += bytes([len(columns), leds, (color >> 16) & 0xFF, (color >> 8) & 0xFF, color & 0xFF])
+    for mask in columns:
+        data += mask.to_bytes(bytes_per_column(leds), "little")
+    return bytes(data)
+
+
+def decode_bitmap(data):
+    if len(data) < HEADER_SIZE or data[:4] != MAGIC:
+        raise ValueError("not a POV1 bitmap")
+    bins, leds = data[4], data[5]
+    color = (data[6] << 16) | (data[7] << 8) | data[8]
+    width = bytes_per_column(leds)
+    if bins == 0 or leds == 0 or len(data) < HEADER_SIZE + bins * width:
+        raise ValueError("bitmap truncated")
+    columns = [int.from_bytes(data[HEADER_SIZE + b * width:HEADER_SIZE + (b + 1) * width], "little") for b in range(bins)]
+    return columns, leds, color
+
+
+def led_radius(led, leds, led0_outer):
+    """radius (0-1) of LED ring - inner ring at 0.3 so the image isn't squashed into the center"""
+    ring = (leds - 1 - led) if led0_outer else led
+    return 0.3 + 0.7 * (ring + 0.5) / leds
+
+
+def cmd_encode(args):
+    try:
+        from PIL import Image
+    except ImportError:
+        sys.exit("encode needs Pillow (pip install pillow)")
+
+    image = Image.open(args.image).convert("L")
+    size = min(image.size)
+    image = image.crop(((image.width - size) // 2, (image.height - size) // 2,
+                        (image.width + size) // 2, (image.height + size) // 2))
+
+    # sample image at the center of each LED ring / angle bin (heading is up, bins run clockwise)
+    columns = []
+    for b in range(args.bins):
+        angle = ((b + 0.5) / args.bins) * 2 * math.pi
+        mask = 0
+        for led in range(args.leds):
+            r = led_radius(led, args.leds, not args.led0_inner) * (size / 2 - 1)
+            x = size / 2 + r * math.sin(angle)
+            y = size / 2 - r * math.cos(angle)
+            lit = image.getpixel((int(x), int(y))) >= args.threshold
+            if lit != args.invert:
+                mask |= 1 << led
+        columns.append(mask)
+
+    with open(args.output, "wb") as f:
+        f.write(encode_bitmap(columns, args.leds, int(args.color, 16)))
+    print(f"wrote {args.output}: {args.bins} bins x {args.leds} LEDs")
+
+
+def simulate_columns(columns, leds, rpm, rotations):
+    """returns list of (start angle, end angle, mask) for what the LEDs actually showed"""
+    bins = len(columns)
+    rotation_us = int(60000000 / rpm)
+    frame_us = LED_BIT_US * leds + LED_RESET_US
+
+    shown = []
+    shown_mask, shown_since = 0, 0
+    requested = None            # last mask requested while a frame is being sent
+    last_requested = 0
+    busy_until = 0
+    for t in range(0, rotation_us * rotations, LOOP_PASS_US):
+        # same integer math as pov_render() (heading offset 0)
+        mask = columns[((t % rotation_us) * bins) // rotation_us]
+        if mask != last_requested:
+            last_requested = mask
+            requested = mask
+        if requested is not None and t >= busy_until:
+            # LEDs latch the new column once the frame has been sent
+            busy_until = t + frame_us
+            shown.append((shown_since, busy_until, shown_mask))
+            shown_mask, shown_since = requested, busy_until
+            requested = None
+    shown.append((shown_since, rotation_us * rotations, shown_mask))
+
+    # convert to angles of the last full rotation (first one starts from dark LEDs)
+    start_us = rotation_us * (rotations - 1)
+    segments = []
+    for t0, t1, mask in shown:
+        t0, t1 = max(t0, start_us), min(t1, rotation_us * rotations)
+        if t1 > t0 and mask:
+            segments.append(((t0 - start_us) / rotation_us * 360, (t1 - start_us) / rotation_us * 360, mask))
+    return segments, frame_us
+
+
+def cmd_simulate(args):
+    with open(args.bitmap, "rb") as f:
+        columns, leds, color = decode_bitmap(f.read())
+
+    segments, frame_us = simulate_columns(columns, leds, args.rpm, 2)
+    rotation_us = 60000000 / args.rpm
+    print(f"{len(columns)} bins x {leds} LEDs at {args.rpm} rpm: bin {rotation_us / len(columns):.0f}us, "
+          f"LED frame {frame_us}us ({len(segments)} lit segments)")
+    if frame_us > rotation_us / len(columns):
+        print("warning: LED frame is longer than a bin - columns will be dropped / smeared (lower POV_ANGLE_BINS or rpm)")
+
+    led0_outer = not args.led0_inner
+    try:
+        from PIL import Image, ImageDraw
+    except ImportError:
+        Image = None
+        if args.out:
+            print("Pillow not installed - showing ASCII preview instead")
+
+    if Image is None or not args.out:
+        # ASCII fallback - sample the rendered segments on a character grid
+        size = 41
+        for row in range(size):
+            line = ""
+            for col in range(size):
+                x, y = (col - size // 2) / (size // 2), (size // 2 - row) / (size // 2)
+                r = math.hypot(x, y)
+                angle = math.degrees(math.atan2(x, y)) % 360
+                ch = " "
+                for led in range(leds):
+                    if abs(r - led_radius(led, leds, led0_outer)) <= 0.35 / leds:
+                        if any(a0 <= angle < a1 and mask & (1 << led) for a0, a1, mask in segments):
+                            ch = "#"
+                line += ch * 2
+            print(line.rstrip())
+        return
+
+    size = args.size
+    image = Image.new("RGB", (size, size), "black")
+    draw = ImageDraw.Draw(image)
+    rgb = ((color >> 16) & 0xFF, (color >> 8) & 0xFF, color & 0xFF)
+    ring_width = max(1, int(size / 2 * 0.7 / leds * 0.8))
+    for a0, a1, mask in segments:
+        for led in range(leds):
+            if not mask & (1 << led):
+                continue
+            r = led_radius(led, leds, led0_outer) * (size / 2 - 2)
+            box = (size / 2 - r, size / 2 - r, size / 2 + r, size / 2 + r)
+            # PIL angles start at 3 o'clock - heading is drawn at the top
+            draw.arc(box, a0 - 90, a1 - 90, fill=rgb, width=ring_width)
+    image.save(args.out)
+    print(f"wrote {args.out}")
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    sub = parser.add_subparsers(dest="command", required=True)
+
+    enc = sub.add_parser("encode", help="convert image to .pov bitmap")
+    enc.add_argument("image")
+    enc.add_argument("output")
+    enc.add_argument("--bins", type=int, default=64, help="angle bins (POV_ANGLE_BINS)")
+    enc.add_argument("--leds", type=int, default=4, help="LED count (NUM_RGB_LEDS)")
+    enc.add_argument("--color", default="ffffff", help="LED color as hex RGB")
+    enc.add_argument("--threshold", type=int, default=128, help="pixels at least this bright are lit")
+    enc.add_argument("--invert", action="store_true", help="light dark pixels instead")
+    enc.add_argument("--led0-inner", action="store_true", help="first LED in chain is closest to center (POV_LED0_IS_OUTER false)")
+    enc.set_defaults(func=cmd_encode)
+
+    sim = sub.add_parser("simulate", help="render .pov bitmap as seen on a spinning robot")
+    sim.add_argument("bitmap")
+    sim.add_argument("--rpm", type=float, default=2000)
+    sim.add_argument("--out", help="output PNG (needs Pillow) - ASCII art if omitted")
+    sim.add_argument("--size", type=int, default=400, help="output image size in pixels")
+    sim.add_argument("--led0-inner", action="store_true", help="first LED in chain is closest to center (POV_LED0_IS_OUTER false)")
+    sim.set_defaults(func=cmd_simulate)
+
+    args = parser.parse_args()
+    if args.command == "encode" and not 0 < args.bins <= 255:
+        parser.error("--bins must be 1-255")
+    if args.command == "encode" and not 0 < args.leds <= 32:
+        parser.error("--leds must be 1-32")
+    args.func(args)
+
+
+if __name__ == "__main__":
+    main()
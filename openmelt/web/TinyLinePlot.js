@@ -0,0 +1,427 @@
+/**
+ * TinyLinePlot.js - A minimal line plotting library for IoT devices
+ * Total size: ~2.5KB minified
+ */
+
+class TinyLinePlot {
+  constructor(elementId, options = {}) {
+    // Get canvas element
+    this.canvas = document.getElementById(elementId);
+    this.ctx = this.canvas.getContext('2d');
+
+    // Default options
+    this.options = {
+      width: options.width || this.canvas.width || 300,
+      height: options.height || this.canvas.height || 200,
+      padding: options.padding || 30,
+      lineColors: options.lineColors || ['#3366CC', '#DC3912', '#FF9900', '#109618', '#990099'],
+      backgroundColor: options.backgroundColor || 'white',
+      axisColor: options.axisColor || '#333333',
+      labelColor: options.labelColor || '#666666',
+      xLabel: options.xLabel || '',
+      yLabel: options.yLabel || '',
+      title: options.title || '',
+      showGrid: options.showGrid !== undefined ? options.showGrid : false,
+      gridColor: options.gridColor || '#EEEEEE',
+      lineWidth: options.lineWidth || 2,
+      dotSize: options.dotSize || 0,
+      maxPoints: options.maxPoints || 100,
+      streaming: options.streaming !== undefined ? options.streaming : false,
+      retainData: options.retainData !== undefined ? options.retainData : false,
+      viewWindowSize: options.viewWindowSize || 50,
+      autoScrollWithNewData: options.autoScrollWithNewData !== undefined ? options.autoScrollWithNewData : true
+    };
+
+    // Set canvas dimensions
+    this.canvas.width = this.options.width;
+    this.canvas.height = this.options.height;
+
+    // Calculate plotting area
+    this.plotArea = {
+      x: this.options.padding * 1.5,
+      y: this.options.padding,
+      width: this.options.width - this.options.padding * 2.5,
+      height: this.options.height - this.options.padding * 2
+    };
+
+    // Initialize data
+    this.datasets = [];
+
+    // Initialize view window (for scrolling through data)
+    this.viewWindow = {
+      start: 0,
+      size: this.options.viewWindowSize
+    };
+
+    // Track if we should auto-scroll with new data
+    this.autoScroll = this.options.autoScrollWithNewData;
+  }
+
+  addDataset(data, label = '') {
+    const colorIndex = this.datasets.length % this.options.lineColors.length;
+    this.datasets.push({
+      data: data,
+      label: label,
+      color: this.options.lineColors[colorIndex]
+    });
+    return this;
+  }
+
+  addPoint(datasetIndex, point) {
+    if (datasetIndex < 0 || datasetIndex >= this.datasets.length) {
+      console.error('Dataset index out of bounds');
+      return this;
+    }
+
+    const dataset = this.datasets[datasetIndex];
+    dataset.data.push(point);
+
+    // If streaming is enabled and we're not retaining data, remove oldest points
+    if (this.options.streaming && !this.options.retainData && dataset.data.length > this.options.maxPoints) {
+      dataset.data = dataset.data.slice(-this.options.maxPoints);
+    }
+
+    // If retaining data and streaming, adjust view window to show most recent data
+    // but only if autoScroll is enabled
+    if (this.options.streaming && this.options.retainData && this.autoScroll) {
+      const maxIdx = dataset.data.length - 1;
+      if (maxIdx >= this.options.viewWindowSize) {
+        this.viewWindow.start = maxIdx - this.options.viewWindowSize + 1;
+      }
+    }
+
+    return this;
+  }
+
+  clear() {
+    this.datasets = [];
+    this.ctx.clearRect(0, 0, this.options.width, this.options.height);
+    this.viewWindow.start = 0;
+    this.autoScroll = this.options.autoScrollWithNewData;
+    return this;
+  }
+
+  // Clear a specific dataset
+  clearDataset(datasetIndex) {
+    if (datasetIndex >= 0 && datasetIndex < this.datasets.length) {
+      this.datasets[datasetIndex].data = [];
+    }
+    this.viewWindow.start = 0;
+    this.autoScroll = this.options.autoScrollWithNewData;
+    return this;
+  }
+
+  // Enable auto-scrolling with new data
+  enableAutoScroll() {
+    this.autoScroll = true;
+    return this;
+  }
+
+  // Disable auto-scrolling with new data
+  disableAutoScroll() {
+    this.autoScroll = false;
+    return this;
+  }
+
+  // Toggle auto-scrolling with new data
+  toggleAutoScroll() {
+    this.autoScroll = !this.autoScroll;
+    return this;
+  }
+
+  // Scroll view window
+  scroll(steps) {
+    // Find maximum dataset length
+    let maxDataLength = 0;
+    this.datasets.forEach(dataset => {
+      maxDataLength = Math.max(maxDataLength, dataset.data.length);
+    });
+
+    // Calculate new start position
+    const newStart = this.viewWindow.start + steps;
+
+    // Ensure we don't scroll past the data
+    if (newStart >= 0 && newStart <= Math.max(0, maxDataLength - this.viewWindow.size)) {
+      this.viewWindow.start = newStart;
+      // Disable auto-scroll when manually scrolling backward
+      if (steps < 0) {
+        this.autoScroll = false;
+      }
+    }
+
+    return this;
+  }
+
+  // Jump to specific position
+  scrollTo(position) {
+    // Find maximum dataset length
+    let maxDataLength = 0;
+    this.datasets.forEach(dataset => {
+      maxDataLength = Math.max(maxDataLength, dataset.data.length);
+    });
+
+    // Check if position is at the latest data
+    const isAtEnd = position >= maxDataLength - this.viewWindow.size;
+
+    // Validate position
+    if (position >= 0 && position <= Math.max(0, maxDataLength - this.viewWindow.size)) {
+      this.viewWindow.start = position;
+
+      // If not scrolling to the end, disable auto-scroll
+      if (!isAtEnd) {
+        this.autoScroll = false;
+      }
+    }
+
+    return this;
+  }
+
+  // Scroll to the beginning of the data
+  scrollToStart() {
+    this.viewWindow.start = 0;
+    this.autoScroll = false;
+    return this;
+  }
+
+  // Scroll to the end of the data (most recent)
+  scrollToEnd() {
+    let maxDataLength = 0;
+    this.datasets.forEach(dataset => {
+      maxDataLength = Math.max(maxDataLength, dataset.data.length);
+    });
+
+    this.viewWindow.start = Math.max(0, maxDataLength - this.viewWindow.size);
+    this.autoScroll = true;
+    return this;
+  }
+
+  findMinMax() {
+    if (this.datasets.length === 0) return { minX: 0, maxX: 10, minY: 0, maxY: 10 };
+
+    let minX = Infinity, maxX = -Infinity, minY = Infinity, maxY = -Infinity;
+
+    this.datasets.forEach(dataset => {
+      // Only consider points within the current view window
+      const start = this.options.retainData ? this.viewWindow.start : 0;
+      const end = this.options.retainData ?
+        Math.min(start + this.viewWindow.size, dataset.data.length) :
+        dataset.data.length;
+
+      for (let i = start; i < end; i++) {
+        const point = dataset.data[i];
+        if (point) {
+          minX = Math.min(minX, point.x);
+          maxX = Math.max(maxX, point.x);
+          minY = Math.min(minY, point.y);
+          maxY = Math.max(maxY, point.y);
+        }
+      }
+    });
+
+    // If no points in view, return default
+    if (minX === Infinity) {
+      return { minX: 0, maxX: 10, minY: 0, maxY: 10 };
+    }
+
+    // Add a small padding to the max/min values
+    const rangeX = maxX - minX;
+    const rangeY = maxY - minY;
+
+    return {
+      minX: minX - rangeX * 0.05,
+      maxX: maxX + rangeX * 0.05,
+      minY: minY - rangeY * 0.05,
+      maxY: maxY + rangeY * 0.05
+    };
+  }
+
+  scalePoint(point, minMax) {
+    return {
+      x: this.plotArea.x + (point.x - minMax.minX) / (minMax.maxX - minMax.minX) * this.plotArea.width,
+      y: this.plotArea.y + this.plotArea.height - (point.y - minMax.minY) / (minMax.maxY - minMax.minY) * this.plotArea.height
+    };
+  }
+
+  drawAxes(minMax) {
+    const ctx = this.ctx;
+
+    // Draw axes
+    ctx.beginPath();
+    ctx.strokeStyle = this.options.axisColor;
+    ctx.lineWidth = 1;
+
+    // X-axis
+    ctx.moveTo(this.plotArea.x, this.plotArea.y + this.plotArea.height);
+    ctx.lineTo(this.plotArea.x + this.plotArea.width, this.plotArea.y + this.plotArea.height);
+
+    // Y-axis
+    ctx.moveTo(this.plotArea.x, this.plotArea.y);
+    ctx.lineTo(this.plotArea.x, this.plotArea.y + this.plotArea.height);
+
+    ctx.stroke();
+
+    // Draw grid if enabled
+    if (this.options.showGrid) {
+      ctx.beginPath();
+      ctx.strokeStyle = this.options.gridColor;
+      ctx.lineWidth = 1;
+
+      // Number of grid lines
+      const gridLinesX = 5;
+      const gridLinesY = 5;
+
+      // X-axis grid lines
+      for (let i = 1; i < gridLinesX; i++) {
+        const x = this.plotArea.x + (i / gridLinesX) * this.plotArea.width;
+        ctx.moveTo(x, this.plotArea.y);
+        ctx.lineTo(x, this.plotArea.y + this.plotArea.height);
+      }
+
+      // Y-axis grid lines
+      for (let i = 1; i < gridLinesY; i++) {
+        const y = this.plotArea.y + (i / gridLinesY) * this.plotArea.height;
+        ctx.moveTo(this.plotArea.x, y);
+        ctx.lineTo(this.plotArea.x + this.plotArea.width, y);
+      }
+
+      ctx.stroke();
+    }
+
+    // Draw labels and ticks
+    ctx.fillStyle = this.options.labelColor;
+    ctx.font = '10px Arial';
+    ctx.textAlign = 'center';
+
+    // X-axis ticks and labels
+    const ticksX = 5;
+    for (let i = 0; i <= ticksX; i++) {
+      const x = this.plotArea.x + (i / ticksX) * this.plotArea.width;
+      const value = minMax.minX + (i / ticksX) * (minMax.maxX - minMax.minX);
+
+      // Draw tick
+      ctx.beginPath();
+      ctx.moveTo(x, this.plotArea.y + this.plotArea.height);
+      ctx.lineTo(x, this.plotArea.y + this.plotArea.height + 5);
+      ctx.stroke();
+
+      // Draw label
+      ctx.fillText(value.toFixed(1), x, this.plotArea.y + this.plotArea.height + 15);
+    }
+
+    // Y-axis ticks and labels
+    const ticksY = 5;
+    ctx.textAlign = 'right';
+    for (let i = 0; i <= ticksY; i++) {
+      const y = this.plotArea.y + (1 - i / ticksY) * this.plotArea.height;
+      const value = minMax.minY + (i / ticksY) * (minMax.maxY - minMax.minY);
+
+      // Draw tick
+      ctx.beginPath();
+      ctx.moveTo(this.plotArea.x, y);
+      ctx.lineTo(this.plotArea.x - 5, y);
+      ctx.stroke();
+
+      // Draw label
+      ctx.fillText(value.toFixed(1), this.plotArea.x - 8, y + 3);
+    }
+
+    // Draw axis labels
+    if (this.options.xLabel) {
+      ctx.textAlign = 'center';
+      ctx.fillText(this.options.xLabel, this.plotArea.x + this.plotArea.width / 2, this.options.height - 5);
+    }
+
+    if (this.options.yLabel) {
+      ctx.save();
+      ctx.translate(10, this.plotArea.y + this.plotArea.height / 2);
+      ctx.rotate(-Math.PI / 2);
+      ctx.textAlign = 'center';
+      ctx.fillText(this.options.yLabel, 0, 0);
+      ctx.restore();
+    }
+
+    // Draw title
+    if (this.options.title) {
+      ctx.textAlign = 'center';
+      ctx.font = 'bold 12px Arial';
+      ctx.fillText(this.options.title, this.plotArea.x + this.plotArea.width / 2, 15);
+    }
+  }
+
+  draw() {
+    // Clear canvas
+    this.ctx.fillStyle = this.options.backgroundColor;
+    this.ctx.fillRect(0, 0, this.options.width, this.options.height);
+
+    // If no data, just draw empty axes
+    if (this.datasets.length === 0) {
+      this.drawAxes({ minX: 0, maxX: 10, minY: 0, maxY: 10 });
+      return this;
+    }
+
+    // Find min and max values
+    const minMax = this.findMinMax();
+
+    // Draw axes and grid
+    this.drawAxes(minMax);
+
+    // Draw each dataset
+    this.datasets.forEach((dataset, datasetIndex) => {
+      // Only consider points within the current view window
+      const start = this.options.retainData ? this.viewWindow.start : 0;
+      const end = this.options.retainData ?
+        Math.min(start + this.viewWindow.size, dataset.data.length) :
+        dataset.data.length;
+
+      if (end - start < 1) return; // Skip if no data points in view
+
+      this.ctx.strokeStyle = dataset.color;
+      this.ctx.lineWidth = this.options.lineWidth;
+      this.ctx.beginPath();
+
+      // Draw data line
+      let firstPoint = true;
+      for (let i = start; i < end; i++) {
+        const point = dataset.data[i];
+        if (!point) continue;
+
+        const scaledPoint = this.scalePoint(point, minMax);
+
+        if (firstPoint) {
+          this.ctx.moveTo(scaledPoint.x, scaledPoint.y);
+          firstPoint = false;
+        } else {
+          this.ctx.lineTo(scaledPoint.x, scaledPoint.y);
+        }
+      }
+
+      this.ctx.stroke();
+
+      // Draw points if dotSize is set
+      if (this.options.dotSize > 0) {
+        this.ctx.fillStyle = dataset.color;
+
+        for (let i = start; i < end; i++) {
+          const point = dataset.data[i];
+          if (!point) continue;
+
+          const scaledPoint = this.scalePoint(point, minMax);
+
+          this.ctx.beginPath();
+          this.ctx.arc(scaledPoint.x, scaledPoint.y, this.options.dotSize, 0, Math.PI * 2);
+          this.ctx.fill();
+        }
+      }
+    });
+
+    return this;
+  }
+
+  getDataLength() {
+    let maxLength = 0;
+    this.datasets.forEach(dataset => {
+      maxLength = Math.max(maxLength, dataset.data.length);
+    });
+    return maxLength;
+  }
+}
@@ -0,0 +1,618 @@
+//generated by tools/build_web_assets.py - do not edit (edit the sources and rerun the script)
+#ifndef WEB_ASSETS_H
+#define WEB_ASSETS_H
+
+#include <Arduino.h>
+
+typedef struct web_asset_t {
+  const char *content_type;
+  const uint8_t *data;              //gzip compressed
+  size_t length;
+  const char *etag;                 //quoted (as sent in ETag / If-None-Match)
+} web_asset_t;
+
+#define WEB_ASSETS_TELEMETRY_STREAM_PORT 81
+
+//web/index.html (38646 bytes uncompressed)
+static const uint8_t web_asset_index_html_gz[] PROGMEM = {
+  0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xcd, 0x3d, 0xed, 0x72, 0xdb, 0x38, 0x92, 0xff, 0xfd, 0x14,
+  0x18, 0x4d, 0x36, 0xa2, 0x26, 0x96, 0x2c, 0xc9, 0x89, 0x27, 0x91, 0x6d, 0x4d, 0x65, 0x9c, 0x64, 0x36, 0x57, 0xf1, 0xc4,
+  0x15, 0x67, 0x3e, 0x53, 0xae, 0x35, 0x25, 0x42, 0x16, 0x27, 0x14, 0xa9, 0x23, 0x29, 0x7f, 0x4c, 0xd6, 0xcf, 0xb0, 0x75,
+  0x7f, 0xae, 0xea, 0xf6, 0x7e, 0xdc, 0x3d, 0xc5, 0xd5, 0x3e, 0xcf, 0xbe, 0xc0, 0xde, 0x23, 0x5c, 0x37, 0xbe, 0x08, 0x80,
+  0x20, 0x45, 0x65, 0x9c, 0x9b, 0xdd, 0xd9, 0x19, 0x93, 0x04, 0xba, 0xd1, 0x68, 0x34, 0xba, 0x1b, 0x8d, 0x06, 0x74, 0xf0,
+  0xd9, 0xb3, 0xd7, 0x47, 0x6f, 0x7f, 0x3a, 0x79, 0x4e, 0xe6, 0xf9, 0x22, 0x1a, 0x6f, 0x1d, 0xc8, 0x3f, 0xd4, 0x0f, 0xc6,
+  0x5b, 0x84, 0x1c, 0xe4, 0x61, 0x1e, 0xd1, 0xf1, 0xeb, 0x25, 0x8d, 0x8f, 0x69, 0x94, 0x93, 0xb7, 0x34, 0xa2, 0x0b, 0x9a,
+  0xa7, 0x37, 0x07, 0x3b, 0xbc, 0x04, 0xeb, 0xc0, 0x07, 0x9f, 0xc4, 0xfe, 0x82, 0x1e, 0xb6, 0x2e, 0x43, 0x7a, 0xb5, 0x4c,
+  0xd2, 0xbc, 0x45, 0xa6, 0x49, 0x9c, 0xd3, 0x38, 0x3f, 0x6c, 0x5d, 0x85, 0x41, 0x3e, 0x3f, 0x0c, 0xe8, 0x65, 0x38, 0xa5,
+  0x5d, 0xf6, 0xb2, 0x4d, 0xc2, 0x38, 0xcc, 0x43, 0x3f, 0xea, 0x66, 0x53, 0x3f, 0xa2, 0x87, 0x83, 0x16, 0x43, 0x93, 0xe5,
+  0x37, 0x1c, 0x21, 0x21, 0x93, 0x24, 0xb8, 0x21, 0x1f, 0xd8, 0x23, 0x21, 0x33, 0xc0, 0xd4, 0x9d, 0xf9, 0x8b, 0x30, 0xba,
+  0x19, 0x91, 0xa7, 0x29, 0xc0, 0x6d, 0x93, 0xcc, 0x8f, 0xb3, 0x6e, 0x46, 0xd3, 0x70, 0xb6, 0x2f, 0x6a, 0x2d, 0xfc, 0xf4,
+  0x22, 0x8c, 0x47, 0xa4, 0x2f, 0x3f, 0x2c, 0xfd, 0x20, 0x08, 0xe3, 0x8b, 0x11, 0x19, 0xf6, 0x97, 0xd7, 0xf2, 0xe3, 0xc4,
+  0x9f, 0xbe, 0xbf, 0x48, 0x93, 0x55, 0x1c, 0x74, 0xa7, 0x49, 0x94, 0xa4, 0x23, 0xf2, 0xf9, 0xac, 0x8f, 0xff, 0xc8, 0x0a,
+  0xf2, 0xeb, 0xee, 0xee, 0x2e, 0xff, 0x74, 0xcb, 0xfe, 0x3b, 0x1f, 0x28, 0x72, 0x64, 0x8d, 0xe1, 0x70, 0x68, 0xb6, 0xdd,
+  0x9d, 0x24, 0x79, 0x9e, 0x2c, 0xf4, 0x06, 0x39, 0xf0, 0xe7, 0xf3, 0x55, 0xa0, 0xc0, 0x83, 0x30, 0x5b, 0x46, 0x3e, 0xf4,
+  0xe4, 0x22, 0x0d, 0x03, 0x89, 0x00, 0x9f, 0xbb, 0x39, 0x5d, 0x40, 0x49, 0x4e, 0x91, 0xb2, 0xd5, 0x22, 0xce, 0x46, 0x24,
+  0xa5, 0x4b, 0xea, 0xe7, 0x9e, 0xbf, 0xca, 0x93, 0xee, 0x2c, 0xcc, 0xb7, 0xc9, 0x22, 0x8c, 0x17, 0xfe, 0xb5, 0x37, 0xec,
+  0x43, 0x0b, 0xdb, 0x64, 0x30, 0x4b, 0x3b, 0x1d, 0x85, 0xc2, 0x5f, 0x8e, 0xc8, 0x40, 0xeb, 0xea, 0x1a, 0xa2, 0x7a, 0x38,
+  0x8c, 0xe1, 0x54, 0xd1, 0xe5, 0xe2, 0xcc, 0x4c, 0x71, 0x77, 0x92, 0xa4, 0x01, 0x4d, 0xbb, 0xa9, 0x1f, 0x84, 0x2b, 0x20,
+  0xec, 0x71, 0xd1, 0x8c, 0x62, 0xf3, 0xe0, 0x91, 0xc6, 0xe6, 0xe4, 0xba, 0x9b, 0xcd, 0xfd, 0x20, 0xb9, 0x82, 0x01, 0x21,
+  0xc3, 0xe5, 0x35, 0x79, 0x08, 0xff, 0xa6, 0x17, 0x13, 0xdf, 0xeb, 0x6f, 0xb3, 0x7f, 0x7a, 0x03, 0x45, 0x79, 0x4e, 0xaf,
+  0xf3, 0xae, 0x1f, 0x85, 0x17, 0x30, 0x7a, 0x53, 0x10, 0x19, 0x9a, 0x3a, 0xe8, 0xec, 0x32, 0x71, 0x33, 0x65, 0x22, 0x0b,
+  0x7f, 0xa5, 0xd0, 0xee, 0xc3, 0xa2, 0x5d, 0x49, 0xf9, 0xde, 0xde, 0x5e, 0x05, 0x1b, 0x1e, 0x39, 0xb9, 0xd0, 0xbd, 0xf4,
+  0xa3, 0x95, 0x13, 0xfb, 0x50, 0xc3, 0xce, 0x3e, 0x5f, 0xd1, 0xf0, 0x62, 0x9e, 0x8f, 0xa0, 0x8b, 0x51, 0x60, 0x37, 0xdb,
+  0xef, 0xef, 0xed, 0x4d, 0xa7, 0x2e, 0xfc, 0x2b, 0x10, 0xf8, 0x8d, 0x89, 0x17, 0xd2, 0x13, 0x25, 0x17, 0xd9, 0x3f, 0xc1,
+  0x30, 0xcd, 0x45, 0xc7, 0x77, 0xfb, 0x9a, 0x90, 0x25, 0x97, 0x34, 0x9d, 0x45, 0xc9, 0x55, 0x17, 0x04, 0x1a, 0xc5, 0x74,
+  0xdf, 0x35, 0x67, 0x17, 0x49, 0x9c, 0x64, 0x4b, 0x7f, 0x4a, 0x65, 0xe9, 0xd5, 0x3c, 0x04, 0x31, 0x67, 0x9f, 0x46, 0x64,
+  0x99, 0x82, 0x5a, 0x48, 0xfd, 0xe5, 0x7e, 0x3d, 0x77, 0xa2, 0x30, 0xa6, 0x5d, 0x49, 0xc3, 0xa0, 0xf7, 0xd0, 0x66, 0xd1,
+  0x71, 0x12, 0xac, 0x22, 0x9a, 0x95, 0xe7, 0xd9, 0x2c, 0xa2, 0xc5, 0x08, 0xc2, 0x33, 0x6b, 0x6c, 0x44, 0xf4, 0x26, 0xf9,
+  0xdc, 0x19, 0x96, 0xe6, 0x4e, 0x9e, 0x58, 0x73, 0xca, 0x49, 0x9b, 0x18, 0xe9, 0x2b, 0x3f, 0x8d, 0x81, 0xc3, 0x25, 0x3d,
+  0x31, 0x9b, 0x3d, 0x79, 0xd2, 0xef, 0x1b, 0x55, 0x69, 0x9a, 0x26, 0x69, 0xa9, 0xe2, 0x74, 0xda, 0xef, 0x9b, 0x15, 0x51,
+  0x0b, 0xd3, 0xb4, 0xbe, 0x4b, 0xbf, 0xac, 0xb2, 0x3c, 0x9c, 0xdd, 0x74, 0x85, 0xbe, 0x1d, 0x11, 0xc6, 0xd6, 0xee, 0x84,
+  0xe6, 0x57, 0x94, 0xc6, 0xb2, 0x16, 0x9b, 0x5e, 0x5d, 0xe0, 0xfa, 0x22, 0x33, 0x27, 0xd9, 0x7a, 0x3d, 0x31, 0x59, 0x41,
+  0x41, 0x5c, 0x27, 0x80, 0xba, 0xd8, 0xab, 0xee, 0xb0, 0x31, 0x36, 0xe5, 0x72, 0x44, 0xe2, 0x24, 0xa6, 0x25, 0x89, 0x04,
+  0x29, 0x25, 0x83, 0x3d, 0x5d, 0x2a, 0x0d, 0x21, 0xd6, 0x67, 0xc8, 0x2a, 0xcd, 0x10, 0xf7, 0x32, 0x09, 0xf5, 0x1e, 0xd4,
+  0x8d, 0x0a, 0xa7, 0x7e, 0x34, 0x47, 0x41, 0xad, 0xef, 0xc3, 0xa3, 0x47, 0xbe, 0xef, 0x9a, 0xba, 0xc8, 0x58, 0x1f, 0x84,
+  0xef, 0xe3, 0xc6, 0xc1, 0x67, 0xcd, 0xd4, 0xcb, 0x95, 0xd5, 0xde, 0x3c, 0x8c, 0x0a, 0x73, 0x51, 0xa5, 0x1c, 0xb9, 0x2c,
+  0x03, 0x96, 0x12, 0x3b, 0xfb, 0x55, 0x3a, 0x8e, 0x21, 0x7e, 0x17, 0x06, 0x87, 0x2d, 0xf6, 0xd4, 0x05, 0x4b, 0xf2, 0x66,
+  0xb9, 0x68, 0x9d, 0x99, 0x4a, 0x70, 0x7b, 0x1d, 0xcc, 0x37, 0x2f, 0x92, 0x74, 0x4a, 0x6d, 0xb0, 0x92, 0x34, 0xd3, 0x2f,
+  0x1f, 0x4e, 0x77, 0xa7, 0xfb, 0x64, 0xe7, 0x0b, 0xf2, 0x86, 0x06, 0xfc, 0x33, 0x8c, 0x54, 0x0a, 0x3c, 0xb8, 0x26, 0x0c,
+  0x24, 0x23, 0x5f, 0xec, 0x18, 0x64, 0xfa, 0xd7, 0x77, 0x87, 0x4b, 0x23, 0xed, 0xa3, 0x47, 0xd0, 0xe4, 0x77, 0xcd, 0x14,
+  0xda, 0xcc, 0x5e, 0x98, 0x24, 0x66, 0x74, 0xe9, 0xa7, 0x7e, 0xae, 0xe9, 0x03, 0xe5, 0xc9, 0x90, 0xe1, 0x5a, 0xe3, 0xa0,
+  0xb0, 0xac, 0x26, 0xd5, 0x06, 0x72, 0xb8, 0x89, 0x81, 0x1c, 0x5a, 0xc2, 0x93, 0xd2, 0x8c, 0xe6, 0xdd, 0xf5, 0x4a, 0x60,
+  0x36, 0xdb, 0x9b, 0xec, 0x4d, 0x2c, 0xa4, 0x11, 0x9d, 0xe5, 0x65, 0x49, 0x87, 0x61, 0x7c, 0xeb, 0x4f, 0x08, 0xf3, 0xf7,
+  0xd4, 0xc0, 0xf5, 0x72, 0x7f, 0xb2, 0x46, 0x7b, 0x57, 0x6a, 0x2a, 0xa5, 0x33, 0x64, 0xd1, 0x00, 0x54, 0x4a, 0x96, 0x44,
+  0x61, 0x40, 0x3e, 0x0f, 0x02, 0x93, 0xed, 0xd0, 0x8c, 0x6a, 0xa5, 0x30, 0x8a, 0x80, 0xca, 0xc0, 0x57, 0xa1, 0x69, 0xd6,
+  0xba, 0x8f, 0x52, 0xd1, 0xb9, 0x08, 0x28, 0x51, 0xa9, 0x6b, 0xc3, 0xb2, 0xd2, 0x63, 0xff, 0xf6, 0x0b, 0x7f, 0x56, 0xf4,
+  0x3e, 0xe5, 0xe2, 0x64, 0xcf, 0x71, 0xe8, 0x56, 0xcf, 0x9f, 0xe6, 0xe1, 0x25, 0xdd, 0xcc, 0x55, 0x70, 0x70, 0x4c, 0xab,
+  0x64, 0x71, 0xbc, 0x3b, 0x68, 0x2a, 0xdc, 0x40, 0x8e, 0x9c, 0x47, 0xe5, 0x31, 0x2d, 0xfa, 0x5d, 0xae, 0x6d, 0x77, 0x42,
+  0x01, 0x4d, 0xa2, 0x64, 0xfa, 0xde, 0x92, 0xa2, 0xe7, 0xcf, 0x4f, 0xde, 0xbc, 0x3e, 0x26, 0x00, 0x0e, 0x92, 0x6f, 0x89,
+  0x13, 0xa5, 0xcb, 0x34, 0x59, 0x74, 0x79, 0x99, 0xc4, 0xc6, 0x96, 0x1f, 0x38, 0xdc, 0xfd, 0x3f, 0x58, 0x7c, 0x00, 0x0e,
+  0x45, 0xfe, 0x32, 0x83, 0xe9, 0x22, 0x9f, 0x9a, 0x48, 0xdd, 0x47, 0x3a, 0x63, 0xd2, 0x6b, 0x1a, 0x91, 0x79, 0x18, 0x04,
+  0x85, 0x95, 0xde, 0xc0, 0x1f, 0xbb, 0x75, 0xf4, 0x12, 0x57, 0x56, 0xd6, 0x97, 0xc2, 0x90, 0xd4, 0x4b, 0x66, 0x31, 0x13,
+  0xb0, 0x55, 0xdd, 0x47, 0xd4, 0x0d, 0x10, 0x4e, 0xe7, 0xba, 0xe6, 0x6b, 0x45, 0xef, 0xf1, 0xec, 0xc9, 0xcc, 0x5f, 0xb3,
+  0xcc, 0xb2, 0x10, 0xa6, 0xa3, 0x38, 0x9f, 0x73, 0x1b, 0xe4, 0xd1, 0x4b, 0x1a, 0x77, 0x6a, 0x1b, 0x18, 0xe2, 0x3f, 0x96,
+  0x84, 0x7c, 0x03, 0x5e, 0xde, 0xdc, 0x16, 0x8d, 0x0b, 0xfc, 0x98, 0xd5, 0x99, 0x85, 0xdf, 0xb0, 0x36, 0x7b, 0x58, 0xb9,
+  0x36, 0x7b, 0xd4, 0x7c, 0x6d, 0xc6, 0x28, 0xec, 0x4e, 0xfd, 0x34, 0xf8, 0xdd, 0x1d, 0x7f, 0x83, 0xa2, 0xdf, 0xc3, 0x21,
+  0x1d, 0xb8, 0x99, 0x53, 0x6d, 0xee, 0xf6, 0x1a, 0xac, 0xd8, 0xac, 0x68, 0x81, 0xc9, 0x76, 0x00, 0x4a, 0x93, 0x68, 0x8d,
+  0x31, 0xb2, 0xd6, 0xdb, 0x6e, 0x0c, 0x96, 0xd9, 0x54, 0x63, 0x81, 0xdc, 0x7e, 0xbc, 0x41, 0x54, 0xa2, 0x91, 0x59, 0xf9,
+  0x38, 0x87, 0x79, 0xd8, 0xa4, 0x07, 0xeb, 0xfd, 0x67, 0xda, 0xc7, 0x7f, 0xd6, 0x63, 0x6a, 0x60, 0xa4, 0x9a, 0x2e, 0x27,
+  0x2a, 0x7d, 0xf7, 0x83, 0x1d, 0x11, 0x4a, 0x3a, 0xd8, 0xe1, 0x71, 0xac, 0x03, 0x8c, 0x27, 0xb1, 0x18, 0x13, 0x17, 0x60,
+  0x1e, 0x64, 0x3a, 0x98, 0x0f, 0x9c, 0x81, 0x2d, 0xf8, 0xcc, 0xcb, 0x83, 0xf0, 0x72, 0x2c, 0x5a, 0x3c, 0x10, 0x23, 0x39,
+  0x8d, 0xfc, 0x2c, 0x3b, 0x6c, 0xf1, 0xb7, 0x16, 0x61, 0x8e, 0x71, 0x44, 0xfd, 0xf4, 0x15, 0xac, 0xd1, 0x5b, 0xe3, 0x23,
+  0x7c, 0x24, 0xf8, 0x7c, 0xb0, 0xc3, 0xab, 0xd4, 0xc2, 0x13, 0xdd, 0xb7, 0xe2, 0xc8, 0xd8, 0x97, 0x63, 0xff, 0xba, 0x35,
+  0x7e, 0x83, 0x4f, 0x04, 0x1e, 0xc9, 0xf7, 0xcc, 0xc1, 0x6d, 0x84, 0x51, 0x43, 0xc2, 0x34, 0x5f, 0x26, 0xf1, 0xf0, 0xb7,
+  0x12, 0x0e, 0xdf, 0x06, 0x9f, 0xa7, 0x74, 0x76, 0xd8, 0xda, 0x99, 0x45, 0x38, 0x65, 0x60, 0x55, 0xdd, 0x22, 0xa0, 0x23,
+  0xe2, 0x28, 0xf1, 0x01, 0xad, 0xfa, 0xd8, 0x9b, 0x84, 0x50, 0x95, 0xf1, 0xf8, 0xb0, 0xc5, 0xec, 0x43, 0x40, 0xa7, 0x09,
+  0x38, 0xb1, 0x21, 0x48, 0x0a, 0xb7, 0xee, 0xad, 0xf1, 0x33, 0x01, 0x47, 0x5e, 0x30, 0x30, 0xe4, 0xca, 0xc1, 0x8e, 0xdf,
+  0x80, 0xfa, 0x3c, 0xb9, 0xb8, 0x88, 0xe8, 0x51, 0x12, 0xcf, 0x42, 0x5c, 0xd4, 0x53, 0xd5, 0x92, 0x43, 0x54, 0x9e, 0x4c,
+  0x1e, 0x3d, 0x99, 0xec, 0x41, 0x6b, 0x6f, 0x19, 0x10, 0xe1, 0x50, 0x04, 0xc1, 0x4a, 0x7d, 0x05, 0x35, 0x14, 0xf3, 0x01,
+  0x53, 0xa8, 0x4f, 0x73, 0x3f, 0x5f, 0x65, 0xaa, 0x81, 0xb2, 0xd3, 0xea, 0x50, 0x20, 0xad, 0x31, 0x88, 0x17, 0xa0, 0x12,
+  0x32, 0xb2, 0x23, 0x84, 0x84, 0x8b, 0x1a, 0x8a, 0xd6, 0x16, 0x97, 0x1c, 0xd9, 0x35, 0x74, 0x6b, 0x5b, 0x85, 0x40, 0x69,
+  0x9f, 0x09, 0x9f, 0x0a, 0xc0, 0x62, 0x3f, 0xf7, 0xd1, 0xe4, 0x21, 0x33, 0x85, 0x14, 0x42, 0x8f, 0x0a, 0x81, 0x54, 0x72,
+  0x68, 0x21, 0xd0, 0x21, 0x2f, 0xc4, 0x70, 0xcb, 0x81, 0x6e, 0x02, 0xc3, 0x8d, 0x6d, 0x6b, 0x2c, 0xdc, 0xa8, 0x53, 0x9a,
+  0xe7, 0xa0, 0x9d, 0x1a, 0x02, 0x83, 0x6a, 0xb9, 0xa4, 0x28, 0xf3, 0xec, 0x6f, 0x33, 0x98, 0x65, 0x72, 0xd9, 0x1a, 0x9f,
+  0xbc, 0xfe, 0x5e, 0xe3, 0x1a, 0x7b, 0x90, 0x2c, 0x63, 0xc3, 0x2f, 0xfb, 0xdd, 0x65, 0xc0, 0x05, 0x22, 0xe5, 0x4f, 0x0a,
+  0xb6, 0x69, 0xad, 0x21, 0xdc, 0x7c, 0x15, 0xe0, 0xd0, 0x14, 0x64, 0xcc, 0x87, 0xe3, 0xd3, 0x9b, 0x0c, 0x0c, 0x8c, 0x98,
+  0x90, 0xf0, 0x6e, 0x42, 0x44, 0x6c, 0xce, 0xda, 0x94, 0x8b, 0x12, 0x11, 0x4e, 0xd2, 0xca, 0x1d, 0xb4, 0x0a, 0x47, 0xa2,
+  0x82, 0xd0, 0x56, 0x41, 0xc8, 0x1b, 0xea, 0x47, 0x60, 0xb1, 0x16, 0xb4, 0xd0, 0x33, 0x6a, 0x4a, 0x1a, 0x74, 0x09, 0x2c,
+  0xb6, 0x87, 0xd2, 0x52, 0x52, 0x6c, 0x57, 0x62, 0x4e, 0x82, 0x2a, 0x76, 0x55, 0xe0, 0x72, 0xa9, 0x55, 0x41, 0x92, 0x76,
+  0xcd, 0x3a, 0xcc, 0x98, 0x82, 0xae, 0x38, 0x39, 0x06, 0x7a, 0x76, 0x8d, 0xaa, 0xe5, 0x06, 0x85, 0x42, 0x37, 0x30, 0x16,
+  0x33, 0x9a, 0x29, 0xa0, 0xe5, 0xe2, 0x24, 0x4a, 0xc0, 0x6d, 0x04, 0xe7, 0xe8, 0x74, 0x0a, 0x95, 0x23, 0xc5, 0x1f, 0x39,
+  0x78, 0x4f, 0xd1, 0x6f, 0xca, 0x58, 0x99, 0x3d, 0x53, 0xab, 0xf1, 0x31, 0x55, 0x2b, 0xd4, 0xac, 0x0b, 0x4a, 0x1b, 0x4b,
+  0xd7, 0xeb, 0xd4, 0x8f, 0x2f, 0xfd, 0x4c, 0xc7, 0x88, 0xc3, 0xcb, 0xbf, 0x2a, 0x06, 0xeb, 0x30, 0x9f, 0x96, 0xdb, 0xdf,
+  0x74, 0x59, 0x24, 0xe5, 0x4e, 0x38, 0x7e, 0xc1, 0x50, 0xdd, 0x29, 0xd3, 0x35, 0x94, 0x77, 0xc7, 0xf7, 0x02, 0xe9, 0xef,
+  0xca, 0xfa, 0xe3, 0x04, 0x03, 0x2e, 0x6f, 0xe7, 0x29, 0xf8, 0x98, 0x60, 0x36, 0x3c, 0xfe, 0x3e, 0x20, 0xf7, 0xc9, 0xb0,
+  0x73, 0x27, 0xe3, 0x91, 0x0b, 0xd4, 0x77, 0x3a, 0x22, 0x06, 0xd2, 0xbb, 0x1b, 0x13, 0x1d, 0xed, 0xef, 0x3a, 0x2a, 0x6f,
+  0xfc, 0x2b, 0xf2, 0x74, 0x3a, 0x05, 0x0d, 0xc9, 0x7d, 0x89, 0x3b, 0x19, 0x09, 0x1f, 0x11, 0xde, 0xe9, 0x30, 0x14, 0x18,
+  0xef, 0x6e, 0x0c, 0x14, 0xce, 0xdf, 0x77, 0x00, 0x8e, 0xc8, 0x29, 0x2c, 0xcb, 0xfc, 0x88, 0x78, 0x6a, 0x6e, 0xdc, 0x27,
+  0xa7, 0x39, 0xa5, 0x29, 0x38, 0x06, 0x77, 0x33, 0x33, 0xd2, 0x29, 0x6f, 0xe2, 0x6e, 0x0d, 0x84, 0x8e, 0xf4, 0x0e, 0xad,
+  0x84, 0x86, 0xf6, 0x77, 0x1d, 0x98, 0xaf, 0xfd, 0x1c, 0x96, 0x6f, 0x37, 0xe4, 0xfb, 0x24, 0xca, 0xfd, 0x8b, 0xbb, 0x31,
+  0x19, 0x13, 0x8e, 0xf3, 0x4e, 0xc7, 0x41, 0xc7, 0x79, 0x77, 0xc3, 0xa0, 0x61, 0xad, 0x1d, 0x85, 0x3a, 0x57, 0xad, 0x08,
+  0x2c, 0xad, 0x71, 0xd5, 0x4a, 0xce, 0xb0, 0xf2, 0xcf, 0x78, 0x50, 0x4a, 0x00, 0xeb, 0x81, 0xaa, 0xc2, 0x3b, 0xcb, 0x65,
+  0xde, 0x84, 0x7c, 0x4f, 0x8d, 0x1e, 0xe7, 0xf3, 0xb1, 0xc0, 0x7b, 0xb0, 0x03, 0xcf, 0x56, 0x11, 0x78, 0xd2, 0x29, 0xfa,
+  0xb7, 0x6c, 0xbd, 0xe7, 0xaa, 0xf0, 0x8c, 0xce, 0xfc, 0x55, 0x54, 0x5b, 0x01, 0x06, 0x2a, 0x5c, 0x72, 0xdd, 0xa9, 0x17,
+  0xc3, 0x5b, 0x5a, 0x30, 0xcc, 0xa0, 0xf2, 0x20, 0x67, 0xc9, 0x16, 0x1a, 0x8f, 0x32, 0xd1, 0xf5, 0x56, 0x4d, 0x47, 0xd8,
+  0x26, 0x0c, 0x2e, 0x83, 0x0e, 0x5b, 0x0f, 0x5b, 0xe3, 0x57, 0xb0, 0xce, 0xc3, 0xad, 0x4f, 0xc1, 0x3b, 0x89, 0xa0, 0xd7,
+  0xeb, 0x41, 0x63, 0x41, 0x25, 0x19, 0x72, 0x55, 0xce, 0x5e, 0x90, 0x91, 0xe2, 0xa5, 0x6e, 0x65, 0x3b, 0x83, 0xc5, 0xed,
+  0x9c, 0xb7, 0x83, 0x6b, 0x5b, 0xf6, 0x2a, 0xda, 0xd5, 0x85, 0xcc, 0x21, 0x01, 0x7c, 0xc1, 0xd2, 0xc4, 0x59, 0x3f, 0x22,
+  0x2f, 0xe3, 0xe5, 0x2a, 0x27, 0x72, 0x69, 0x73, 0x17, 0x1e, 0x7a, 0x41, 0x02, 0x7b, 0xef, 0x4a, 0xa3, 0xab, 0x33, 0xb9,
+  0x62, 0xf2, 0x4b, 0x55, 0x6c, 0xce, 0x7a, 0x97, 0x05, 0x67, 0x04, 0x7f, 0xbc, 0xb2, 0xb2, 0x69, 0xcc, 0x84, 0xe2, 0x6f,
+  0x40, 0xa3, 0xb4, 0x11, 0xd5, 0x34, 0x4a, 0x64, 0xcd, 0x68, 0xd4, 0x1f, 0x97, 0xe3, 0x93, 0x55, 0x94, 0x51, 0x12, 0xd1,
+  0xf8, 0x22, 0x9f, 0x03, 0xb6, 0x98, 0xdc, 0x5f, 0x84, 0xa0, 0x91, 0xf6, 0xb3, 0x1e, 0x79, 0x7e, 0xbd, 0x4c, 0x48, 0xbf,
+  0x8b, 0x11, 0xfd, 0x1e, 0x0c, 0x58, 0x96, 0x27, 0x0b, 0xc2, 0xba, 0x40, 0xc2, 0x8c, 0xf8, 0x20, 0xa5, 0x8b, 0x85, 0x4f,
+  0xc4, 0x1e, 0x1b, 0x0d, 0x48, 0x14, 0x66, 0x39, 0x49, 0x66, 0x24, 0x59, 0xe5, 0x30, 0xc2, 0x19, 0xf1, 0x96, 0x34, 0x5d,
+  0x84, 0x51, 0x44, 0xb7, 0x09, 0x06, 0x98, 0xa3, 0x1b, 0x1e, 0xad, 0x0c, 0x58, 0x88, 0x9e, 0x64, 0x79, 0x38, 0x7d, 0x4f,
+  0xf2, 0xd4, 0xbf, 0xa4, 0x51, 0x87, 0x74, 0x81, 0x02, 0x78, 0x22, 0x74, 0xb1, 0xcc, 0x6f, 0x48, 0x9e, 0x90, 0x15, 0x10,
+  0x45, 0xa1, 0x7d, 0x90, 0xf2, 0x65, 0x85, 0xd0, 0xc1, 0x8a, 0xb7, 0x81, 0xc4, 0xc1, 0x92, 0x98, 0x3c, 0xe3, 0x41, 0xc6,
+  0x3b, 0x5f, 0x0f, 0x56, 0x0c, 0xd8, 0x8b, 0xd4, 0x5f, 0xd0, 0xc9, 0x6a, 0x36, 0x83, 0x6e, 0x7a, 0xa8, 0x0f, 0x70, 0xfe,
+  0xfa, 0x39, 0x74, 0x6b, 0xd9, 0xa9, 0x1e, 0x44, 0xe8, 0xce, 0x49, 0x4a, 0x31, 0xc9, 0xab, 0xc5, 0xf7, 0x52, 0x0e, 0x5b,
+  0xbb, 0xfd, 0x7e, 0x4b, 0xe4, 0x86, 0xf0, 0x97, 0xdf, 0x6a, 0x27, 0x2b, 0x08, 0x3e, 0xe2, 0x5c, 0xb3, 0x68, 0xcb, 0xc0,
+  0x59, 0x9c, 0xe6, 0x92, 0xb6, 0x23, 0xc9, 0xd9, 0x83, 0x1d, 0x5e, 0xa0, 0xd5, 0xac, 0x56, 0x2a, 0x00, 0xf8, 0x74, 0xb9,
+  0x8c, 0x6e, 0xc0, 0xd6, 0xe1, 0x9f, 0xb2, 0xad, 0x02, 0x09, 0x7c, 0xb9, 0x00, 0xb3, 0x4b, 0xbc, 0x1e, 0xd4, 0x25, 0xb3,
+  0x10, 0xcc, 0xc0, 0x0c, 0x34, 0x25, 0x30, 0x0b, 0x94, 0xe0, 0x0e, 0x7c, 0xfb, 0x13, 0x3e, 0xf5, 0x96, 0x37, 0x9d, 0x91,
+  0x10, 0x05, 0x01, 0x18, 0x32, 0x3d, 0x92, 0xdf, 0x2c, 0xe9, 0x61, 0x0b, 0xc1, 0x54, 0x83, 0x2f, 0xd8, 0x0b, 0x7a, 0x7d,
+  0x4b, 0x60, 0x5b, 0x8f, 0x05, 0x46, 0x1a, 0xd2, 0xfa, 0xdd, 0x12, 0xc3, 0x6a, 0xad, 0x31, 0xff, 0xeb, 0xa2, 0x56, 0xd6,
+  0x7c, 0x19, 0xcf, 0x12, 0xe4, 0xc5, 0xb2, 0xa1, 0xad, 0xe4, 0xc6, 0x83, 0x64, 0xe9, 0xf4, 0xb0, 0xb5, 0xf3, 0x36, 0x8c,
+  0x6f, 0x5e, 0x81, 0xac, 0xe1, 0x54, 0xed, 0xfd, 0xc2, 0x02, 0x21, 0xbc, 0x7c, 0x5c, 0x54, 0xe5, 0xa8, 0x76, 0x76, 0xc8,
+  0x51, 0x4a, 0x61, 0x7a, 0x91, 0x3f, 0x7e, 0xf7, 0x8c, 0xb0, 0xf8, 0x46, 0x0c, 0x53, 0x0b, 0xf7, 0xe7, 0xc1, 0xd2, 0x90,
+  0xf7, 0xf4, 0x86, 0xf0, 0x5d, 0xea, 0x6c, 0x8b, 0x07, 0x74, 0x63, 0x98, 0x83, 0xf3, 0x55, 0x70, 0xcc, 0x3f, 0x92, 0x43,
+  0xf2, 0x4e, 0xd0, 0xf7, 0x01, 0x28, 0x1f, 0x91, 0x36, 0x2c, 0xce, 0x8f, 0xa4, 0xa4, 0xb7, 0xb7, 0x09, 0x13, 0x00, 0xf8,
+  0xfc, 0xe6, 0xe4, 0x18, 0xde, 0xc2, 0x4c, 0x95, 0x8d, 0x60, 0x6a, 0xae, 0x60, 0xe6, 0xb2, 0x0d, 0x22, 0x30, 0x9d, 0x23,
+  0x85, 0x48, 0x47, 0xa5, 0x61, 0x10, 0x16, 0x16, 0xbe, 0x60, 0x3e, 0x96, 0x28, 0x26, 0xb7, 0xdb, 0x36, 0x14, 0xcf, 0x8c,
+  0xd0, 0x00, 0x8f, 0xfd, 0x6b, 0x1b, 0x48, 0xc0, 0x9c, 0x29, 0x68, 0x01, 0xcb, 0x57, 0xb8, 0x2e, 0xfa, 0xc5, 0x7a, 0x7f,
+  0xe3, 0x3e, 0x5c, 0x48, 0xb0, 0xca, 0x6e, 0x5c, 0x54, 0x74, 0xe2, 0x1b, 0x1b, 0xd2, 0xe8, 0x87, 0x13, 0x8a, 0x2d, 0x44,
+  0xbe, 0xcb, 0x68, 0xa0, 0x41, 0x89, 0x57, 0x0d, 0xac, 0xaa, 0xf3, 0xca, 0x10, 0x39, 0xba, 0x6f, 0xae, 0xb9, 0x37, 0xe6,
+  0xc2, 0x02, 0xc1, 0x07, 0x1a, 0xb8, 0x89, 0x77, 0x50, 0x10, 0xf8, 0x07, 0x78, 0x9c, 0xfb, 0x19, 0xf4, 0x55, 0xa2, 0x05,
+  0x56, 0xbc, 0x14, 0x2c, 0x39, 0x36, 0xd1, 0xb8, 0xf8, 0x86, 0x35, 0x86, 0x95, 0x0d, 0x0d, 0x37, 0x69, 0x68, 0xa8, 0x35,
+  0x54, 0xc5, 0x33, 0xdc, 0x56, 0x8c, 0xa7, 0x37, 0x4e, 0x89, 0x3f, 0x42, 0x33, 0xc3, 0xdb, 0x7d, 0xc5, 0xab, 0x6d, 0xcc,
+  0x37, 0x81, 0x9e, 0x21, 0x39, 0x79, 0xd4, 0xd7, 0xb0, 0x2f, 0xd9, 0x9b, 0xe8, 0xcb, 0x22, 0x73, 0xf1, 0xc2, 0x00, 0x7e,
+  0xf2, 0x44, 0x07, 0x66, 0x6f, 0x8d, 0x81, 0xb9, 0xe0, 0x39, 0xc5, 0x90, 0x01, 0x2b, 0xe6, 0xb0, 0x87, 0xb3, 0xfd, 0x2d,
+  0x53, 0x55, 0x3c, 0xe7, 0x4a, 0x05, 0x54, 0x45, 0x90, 0x4c, 0x57, 0xf8, 0xd8, 0xbb, 0xa0, 0xb9, 0xf8, 0xfa, 0xf5, 0xcd,
+  0xcb, 0xc0, 0x6b, 0x43, 0xad, 0x76, 0x47, 0xc0, 0x15, 0x1a, 0x49, 0x24, 0xb9, 0x4a, 0xa5, 0xc4, 0xb3, 0xea, 0x94, 0xea,
+  0xe9, 0x81, 0x8e, 0x7a, 0xee, 0x4f, 0xe7, 0x9e, 0xa8, 0x76, 0x38, 0xd6, 0x52, 0x8f, 0xb0, 0x69, 0xfe, 0xdd, 0xd1, 0xfa,
+  0x94, 0xa1, 0x17, 0x05, 0x5e, 0x1b, 0x54, 0x68, 0x5b, 0xed, 0xf6, 0x1a, 0x40, 0x3d, 0xa6, 0xc4, 0xbf, 0x05, 0x63, 0x0b,
+  0xe0, 0x6d, 0x5e, 0xd4, 0x16, 0x64, 0x12, 0x12, 0xce, 0x88, 0x68, 0xbb, 0xa7, 0x8d, 0x6a, 0xb1, 0xcd, 0xad, 0x77, 0xa5,
+  0xd8, 0xae, 0xbe, 0x0a, 0xf3, 0x39, 0xe7, 0xa5, 0xaa, 0x66, 0xb6, 0x19, 0xc6, 0x50, 0xed, 0x8f, 0x6f, 0x8f, 0x5f, 0x41,
+  0x9b, 0xe7, 0xba, 0xc5, 0xd5, 0x73, 0x69, 0x5b, 0xe3, 0x7b, 0x1f, 0x44, 0xdb, 0xec, 0xfd, 0x96, 0x5b, 0x82, 0x73, 0x45,
+  0x9c, 0xbb, 0x71, 0x54, 0xeb, 0x3c, 0x45, 0x4d, 0x57, 0xea, 0x05, 0xcb, 0x58, 0x99, 0xea, 0x4a, 0x53, 0x9e, 0x11, 0x0b,
+  0xce, 0xc5, 0xb6, 0xc2, 0xfd, 0x69, 0x9b, 0x34, 0x3e, 0x0d, 0x82, 0x0a, 0x92, 0x44, 0xff, 0xe4, 0xf4, 0x50, 0xe3, 0xcd,
+  0x6b, 0x6b, 0xc3, 0x6d, 0xd1, 0xbf, 0xe1, 0x88, 0x2b, 0xfa, 0x6b, 0x06, 0x9d, 0xa7, 0x31, 0xb4, 0x2b, 0x41, 0xc2, 0x00,
+  0x07, 0x8b, 0x67, 0xd9, 0xdd, 0xfb, 0xc0, 0xfe, 0xc2, 0xb7, 0x5b, 0x7d, 0x38, 0xb8, 0xbc, 0xf0, 0x22, 0xae, 0x77, 0x3a,
+  0x46, 0x07, 0x6c, 0x8c, 0xba, 0x14, 0x18, 0xd5, 0x4c, 0x37, 0xcc, 0x4a, 0x21, 0x43, 0xb9, 0xe0, 0x6d, 0xe8, 0x62, 0xb1,
+  0x1e, 0xde, 0xca, 0xb5, 0x6b, 0xd9, 0x20, 0xfa, 0x16, 0x9c, 0xd6, 0xc1, 0x96, 0x0b, 0x4d, 0x6b, 0xdc, 0xd7, 0x77, 0xd9,
+  0xca, 0x48, 0x2c, 0xd2, 0x65, 0x0e, 0x5d, 0x6b, 0xbc, 0x53, 0x0f, 0xa7, 0x37, 0xce, 0x94, 0xb5, 0xbb, 0x7d, 0xa2, 0x72,
+  0x11, 0x2b, 0x29, 0x69, 0xca, 0x16, 0xd4, 0x72, 0x05, 0x4b, 0xf1, 0xcd, 0xc5, 0xd1, 0x73, 0x5d, 0x2e, 0x6e, 0x41, 0x5f,
+  0x65, 0xf4, 0x9f, 0x6d, 0x68, 0x5b, 0xa5, 0x91, 0x43, 0xd6, 0x7c, 0x3a, 0x26, 0x6c, 0xd9, 0x33, 0xa5, 0x50, 0x0e, 0xfe,
+  0x72, 0x49, 0xe3, 0xe0, 0x88, 0xe5, 0x05, 0xe9, 0x7c, 0xd1, 0x26, 0xe4, 0x6d, 0x47, 0x9b, 0x38, 0xa6, 0x76, 0x2c, 0x41,
+  0x17, 0x8a, 0x57, 0xc2, 0x97, 0x46, 0x00, 0xb4, 0xcc, 0x69, 0xee, 0xc7, 0x01, 0x66, 0xe4, 0x70, 0x6c, 0x4d, 0x54, 0xef,
+  0x56, 0x2d, 0x53, 0xea, 0xb4, 0xf0, 0x56, 0xf3, 0xf1, 0x90, 0xf6, 0xc3, 0x3d, 0x20, 0x35, 0x83, 0x21, 0x00, 0x5d, 0xa3,
+  0xa1, 0x46, 0x42, 0x8d, 0x42, 0x61, 0x84, 0x0d, 0xfe, 0x19, 0x9d, 0x97, 0x19, 0x43, 0x9a, 0x19, 0x7e, 0x9b, 0xfa, 0xb0,
+  0x82, 0x2e, 0xd2, 0x74, 0xd9, 0xf7, 0x88, 0xe6, 0x44, 0x79, 0xa7, 0xc0, 0x27, 0x91, 0x36, 0x22, 0x3e, 0x83, 0xe7, 0x5d,
+  0xfa, 0x66, 0x7a, 0x6d, 0xee, 0xe2, 0xa1, 0x59, 0x2c, 0x29, 0xc0, 0xcd, 0xdf, 0xc2, 0x7c, 0x69, 0x6e, 0x05, 0x6e, 0xff,
+  0x36, 0xf0, 0x2b, 0xb0, 0x9a, 0xee, 0x58, 0xbc, 0xe4, 0x47, 0x97, 0xc2, 0x5f, 0x29, 0x61, 0xeb, 0x53, 0x02, 0xcb, 0xb0,
+  0xbc, 0xe8, 0x97, 0xd8, 0x58, 0xdc, 0x26, 0xc5, 0x4e, 0x17, 0xf8, 0x3d, 0xda, 0x0e, 0xcb, 0x36, 0x51, 0xb1, 0xfe, 0x6d,
+  0xa2, 0x07, 0x98, 0xb7, 0x89, 0x16, 0xe7, 0x2c, 0xba, 0x87, 0xbb, 0xc6, 0x47, 0xc9, 0x0a, 0xd3, 0x77, 0xb4, 0x8e, 0xcd,
+  0x56, 0xf1, 0x14, 0xc3, 0x7c, 0xec, 0x24, 0x15, 0xdf, 0x49, 0xf6, 0x0a, 0x63, 0x80, 0x76, 0x3b, 0x59, 0x2c, 0xa0, 0x98,
+  0x93, 0x98, 0xb0, 0x90, 0x60, 0x66, 0xb8, 0x36, 0xac, 0xe4, 0x35, 0x2f, 0x00, 0xc4, 0x85, 0xa8, 0x8b, 0x1c, 0xc9, 0xdd,
+  0xc7, 0xfd, 0xc2, 0xa3, 0x93, 0xe7, 0x2e, 0x86, 0x7d, 0xed, 0xa3, 0xca, 0x66, 0xda, 0xd5, 0x3e, 0x66, 0xf3, 0xe4, 0xea,
+  0x9b, 0x14, 0xfd, 0x3f, 0xe6, 0x99, 0xaa, 0xef, 0x78, 0x7c, 0xe3, 0x07, 0x8e, 0x79, 0x58, 0x7c, 0x4d, 0x29, 0x0e, 0xcb,
+  0x33, 0x3f, 0xf7, 0xed, 0xfa, 0x59, 0x0e, 0xf6, 0x76, 0xc1, 0xd0, 0x9b, 0x05, 0x18, 0x7c, 0xf8, 0x21, 0x8c, 0x83, 0xe4,
+  0xea, 0x94, 0x25, 0x30, 0xed, 0xea, 0x24, 0x15, 0x71, 0xec, 0x1f, 0xc0, 0x47, 0xfa, 0x96, 0x5e, 0x15, 0xa8, 0xa5, 0x40,
+  0x2b, 0xb5, 0x00, 0x4c, 0x82, 0x15, 0x25, 0x41, 0x6e, 0x8b, 0x2f, 0x62, 0xec, 0x80, 0x1b, 0x31, 0xbd, 0x22, 0xfa, 0x02,
+  0xd8, 0x6b, 0x8b, 0x32, 0x70, 0x5b, 0x0b, 0x4e, 0xf5, 0x7a, 0x3d, 0x9d, 0x8b, 0x05, 0x19, 0xd7, 0xaf, 0xfc, 0x09, 0x8d,
+  0xc0, 0xb7, 0x7d, 0x8b, 0x5b, 0xfe, 0x5e, 0xd6, 0x69, 0x17, 0x65, 0x37, 0xb2, 0x8c, 0x2d, 0x67, 0xd5, 0x67, 0xe5, 0xf2,
+  0x27, 0x39, 0xdb, 0xfb, 0x22, 0xa7, 0x4b, 0x0a, 0xab, 0xae, 0xad, 0x42, 0x9b, 0x19, 0x34, 0xf6, 0x80, 0xf7, 0xd8, 0xb7,
+  0x8c, 0xe6, 0xde, 0xbb, 0xb3, 0x6d, 0x8e, 0xad, 0xd3, 0x0b, 0x52, 0xff, 0xca, 0xeb, 0xe8, 0x5d, 0x14, 0x8b, 0x4e, 0xbd,
+  0x9b, 0x85, 0x64, 0x3a, 0x7b, 0x5a, 0x14, 0xdf, 0x61, 0x67, 0x2f, 0x1c, 0x5d, 0x95, 0xeb, 0xe1, 0x52, 0x1f, 0x0b, 0x0a,
+  0xca, 0xdd, 0xf4, 0xaf, 0xc8, 0x37, 0xd0, 0x51, 0xfb, 0x3b, 0x2e, 0x51, 0x59, 0x41, 0x99, 0x03, 0xd6, 0x5e, 0xaf, 0xc6,
+  0x08, 0x7d, 0x5a, 0x3a, 0x59, 0xa1, 0x57, 0xb8, 0x43, 0x66, 0xfc, 0xc1, 0xc1, 0x8c, 0xba, 0x1d, 0xe9, 0x32, 0x87, 0x74,
+  0xc2, 0x4a, 0xbc, 0x90, 0x0b, 0xe2, 0x4e, 0x45, 0xc9, 0xd0, 0xc9, 0x26, 0x7b, 0xf3, 0x55, 0x67, 0x94, 0xd2, 0x58, 0x4e,
+  0x2e, 0xa9, 0xd2, 0x4f, 0x2c, 0x2f, 0x06, 0x75, 0x3f, 0xfe, 0xf4, 0x73, 0x99, 0x2d, 0x8a, 0x92, 0x52, 0xcf, 0x7f, 0x74,
+  0x70, 0xe3, 0x27, 0xc7, 0xb7, 0x9f, 0xdd, 0xbc, 0x51, 0xfb, 0xa2, 0xba, 0xb6, 0xd0, 0x74, 0xb7, 0x5b, 0x65, 0x68, 0x15,
+  0xee, 0x90, 0x35, 0x6c, 0xf7, 0xc7, 0xa5, 0x39, 0xea, 0x37, 0x6f, 0x1d, 0xaa, 0x44, 0xa3, 0xaf, 0xc4, 0x08, 0x15, 0xb8,
+  0x28, 0xf3, 0x48, 0xa2, 0x74, 0xb2, 0xca, 0xda, 0xa9, 0xd4, 0x19, 0xa6, 0x99, 0x37, 0x27, 0xbf, 0xb4, 0xf2, 0xbb, 0x64,
+  0x17, 0x10, 0x92, 0x39, 0xd8, 0x65, 0x11, 0x5a, 0x66, 0x8f, 0x46, 0x4e, 0x89, 0x05, 0x12, 0xc8, 0xc5, 0x81, 0x53, 0x9a,
+  0xaf, 0x96, 0xc2, 0xf0, 0x8a, 0x6d, 0x58, 0x91, 0xfb, 0x2a, 0x0d, 0x70, 0x86, 0x35, 0x98, 0xd1, 0x3e, 0x12, 0xdb, 0xb4,
+  0xba, 0x7d, 0x11, 0x4f, 0x8a, 0x0e, 0x57, 0x6d, 0x43, 0x47, 0x17, 0x2f, 0xb5, 0x30, 0x96, 0x32, 0xd3, 0x5f, 0x6b, 0xe1,
+  0xf4, 0xe9, 0xad, 0x9e, 0x6b, 0x21, 0x2c, 0xc1, 0xd7, 0x5f, 0x6b, 0xe1, 0x4c, 0x01, 0xd0, 0xde, 0x54, 0x2a, 0xba, 0xe9,
+  0xfb, 0x38, 0x70, 0xa0, 0x33, 0xf6, 0x32, 0xd8, 0x66, 0x4e, 0x59, 0xe1, 0x0f, 0x55, 0x39, 0x77, 0xe7, 0xf7, 0x3e, 0x70,
+  0x80, 0x5b, 0x6d, 0x07, 0xfc, 0x9c, 0x49, 0xfc, 0xf3, 0x4b, 0xa8, 0xf4, 0x2a, 0xcc, 0x72, 0x0a, 0x5e, 0xa3, 0xd7, 0x9e,
+  0x46, 0xe1, 0xf4, 0x3d, 0x10, 0x25, 0xdb, 0xf6, 0xf4, 0x95, 0x37, 0xe2, 0xe8, 0xf1, 0xb4, 0xd5, 0xa7, 0x0a, 0x8d, 0xa7,
+  0x2d, 0x46, 0xf2, 0x79, 0x98, 0xf1, 0x98, 0x00, 0x62, 0x14, 0x55, 0x91, 0xb3, 0xb8, 0xc5, 0xae, 0x87, 0x11, 0x18, 0x26,
+  0x29, 0x52, 0xa5, 0x85, 0x4c, 0x83, 0x6e, 0xb0, 0x4d, 0xf7, 0x8f, 0xec, 0x01, 0x83, 0xf5, 0x3a, 0x66, 0x6c, 0xe5, 0x0d,
+  0xed, 0x02, 0x2e, 0xb1, 0xe7, 0x15, 0xf0, 0x39, 0x90, 0xc1, 0xd8, 0xa0, 0xbd, 0x85, 0x21, 0xc0, 0x00, 0x3f, 0x02, 0xb3,
+  0x3d, 0x8e, 0x2d, 0x3d, 0x4c, 0xc1, 0x29, 0x22, 0x87, 0x87, 0x87, 0x44, 0x09, 0xb7, 0x19, 0xae, 0x58, 0x56, 0xfa, 0x31,
+  0xda, 0x32, 0x8e, 0x2f, 0xc4, 0x6c, 0x84, 0x9a, 0xfc, 0x37, 0xc1, 0xb9, 0xc6, 0x69, 0x58, 0xdb, 0x9c, 0x31, 0x75, 0x1a,
+  0x34, 0xd8, 0xc0, 0x02, 0xaf, 0x6d, 0xb3, 0x98, 0x76, 0x0d, 0x1a, 0xdc, 0xc0, 0xbc, 0xad, 0x6d, 0xd8, 0x98, 0xbd, 0x0d,
+  0xda, 0x6e, 0x64, 0x29, 0xd6, 0xb6, 0xaa, 0xcf, 0xfd, 0x06, 0x8d, 0x2a, 0x05, 0xac, 0x21, 0xde, 0x5a, 0x37, 0x8d, 0xb4,
+  0x5a, 0x20, 0xd9, 0x2f, 0xa4, 0x1a, 0xc1, 0x9d, 0xdc, 0x65, 0x80, 0x51, 0x4e, 0x94, 0x66, 0xdc, 0xc3, 0xe2, 0x01, 0x56,
+  0x95, 0xa9, 0x8b, 0x62, 0x6f, 0x6a, 0x1e, 0x5e, 0x1f, 0xaa, 0x7a, 0x58, 0x66, 0x2c, 0xbc, 0xbe, 0xe3, 0xa8, 0x78, 0x92,
+  0x39, 0x59, 0x24, 0x01, 0x9e, 0x4c, 0xc3, 0x34, 0x73, 0xec, 0xf2, 0x12, 0x53, 0xf3, 0xe3, 0x5c, 0x8b, 0xfe, 0x22, 0x7c,
+  0xaf, 0xc8, 0x48, 0x27, 0x9f, 0x01, 0x33, 0x56, 0x71, 0x40, 0x67, 0x60, 0x16, 0x03, 0x9d, 0x11, 0xbc, 0xc9, 0x23, 0x2b,
+  0x77, 0xdd, 0x86, 0xef, 0x94, 0x16, 0xee, 0x05, 0x49, 0x29, 0xbd, 0x58, 0x45, 0x7e, 0x6a, 0x05, 0x49, 0x5f, 0x4f, 0x7e,
+  0xa1, 0xd3, 0xbc, 0xf7, 0x9e, 0xde, 0x70, 0x64, 0x1d, 0x15, 0x24, 0xc5, 0x8d, 0x3b, 0x23, 0x44, 0xca, 0x17, 0x8e, 0x74,
+  0xed, 0x9a, 0x19, 0x00, 0xb5, 0x71, 0xc1, 0x5e, 0x4a, 0x98, 0xfb, 0xf7, 0x19, 0x33, 0xdf, 0x41, 0x8d, 0xb3, 0xea, 0xae,
+  0x12, 0xd9, 0x46, 0x0f, 0x0f, 0x17, 0x88, 0x4d, 0x5d, 0x6c, 0x4f, 0x82, 0x1a, 0x31, 0xd1, 0xaa, 0x28, 0x43, 0xd1, 0x3a,
+  0xeb, 0x48, 0xa1, 0x36, 0xda, 0x48, 0xc6, 0xd2, 0x4f, 0x33, 0xfa, 0x22, 0x4a, 0xfc, 0xdc, 0x53, 0x68, 0x3b, 0x64, 0x5c,
+  0xc4, 0x25, 0xec, 0xd0, 0xaa, 0x1e, 0xb0, 0x70, 0x02, 0xef, 0x1b, 0xd5, 0x2b, 0xe3, 0x09, 0xc5, 0xb6, 0x5c, 0xc7, 0xea,
+  0x9e, 0x2a, 0x01, 0x03, 0xf1, 0x22, 0xbc, 0xa6, 0x81, 0x37, 0xec, 0x54, 0x46, 0xc4, 0x8c, 0x7e, 0xb1, 0x1d, 0x49, 0xd9,
+  0xa9, 0x97, 0x71, 0xb9, 0x4b, 0x6f, 0x96, 0x0b, 0x47, 0x7f, 0x78, 0xa4, 0xc5, 0x01, 0xd4, 0xbc, 0x2b, 0xb8, 0x4d, 0xea,
+  0xe8, 0x07, 0x7c, 0x6e, 0x46, 0xb9, 0xb5, 0xab, 0x57, 0xdb, 0x09, 0x33, 0x08, 0xe4, 0xe8, 0x4f, 0x29, 0x4a, 0xf4, 0x9b,
+  0xba, 0x66, 0xed, 0x14, 0x3a, 0x7a, 0x69, 0xd6, 0xd8, 0xa0, 0xc3, 0xc3, 0x0d, 0x3a, 0x3c, 0x5c, 0xd7, 0xe1, 0xe1, 0x9d,
+  0x76, 0x78, 0xb8, 0xb6, 0xc3, 0x43, 0x77, 0x87, 0xed, 0xa7, 0x7a, 0x85, 0x8b, 0x3e, 0x05, 0xae, 0x00, 0x4c, 0x25, 0x8b,
+  0x25, 0xa8, 0x83, 0x79, 0xba, 0x0b, 0xf1, 0xd8, 0x89, 0x89, 0x10, 0x1d, 0x3d, 0x50, 0x3d, 0x41, 0x46, 0xba, 0x64, 0x09,
+  0x9e, 0x15, 0xcb, 0x54, 0x09, 0x2e, 0xfd, 0x78, 0x4a, 0x33, 0xd2, 0xef, 0x3d, 0xca, 0xc8, 0x92, 0xa6, 0x64, 0xea, 0x47,
+  0x51, 0x47, 0x36, 0x85, 0x66, 0x24, 0x23, 0x7e, 0x8a, 0x4a, 0x0f, 0xed, 0x40, 0x4c, 0x26, 0xd0, 0x02, 0x3c, 0xf0, 0x50,
+  0x99, 0x4b, 0x99, 0x8b, 0x20, 0x1a, 0x92, 0xb1, 0xcd, 0x82, 0x6e, 0xc2, 0xdb, 0x3d, 0x65, 0x81, 0x28, 0x5d, 0x41, 0xe1,
+  0x78, 0x32, 0xca, 0x0e, 0xab, 0x14, 0x98, 0x1e, 0xb3, 0x7b, 0x70, 0x88, 0x34, 0xee, 0x1b, 0x65, 0xc0, 0x4d, 0xad, 0x4a,
+  0x8d, 0xca, 0xb6, 0x02, 0x54, 0xd8, 0xb2, 0x0c, 0x52, 0x09, 0x55, 0xda, 0x83, 0xf7, 0x6a, 0x4d, 0xaa, 0x45, 0x8b, 0x4e,
+  0xf0, 0x08, 0xa0, 0xd7, 0x87, 0x85, 0x15, 0xc1, 0xed, 0x6a, 0xd6, 0xc1, 0x9b, 0x91, 0x29, 0x31, 0x88, 0xac, 0xa3, 0x2d,
+  0x81, 0x1c, 0x14, 0x39, 0xe2, 0x49, 0x48, 0x95, 0xb6, 0x06, 0xd1, 0x9a, 0x57, 0x06, 0x8e, 0x17, 0xd7, 0x69, 0x7c, 0x33,
+  0xe6, 0x53, 0x47, 0x6c, 0xa1, 0x77, 0x05, 0x5a, 0x9d, 0x62, 0x5d, 0x12, 0x55, 0xeb, 0x2a, 0xa7, 0x61, 0x53, 0x02, 0x06,
+  0xeb, 0x08, 0x50, 0x98, 0xdd, 0x34, 0x38, 0xf8, 0x57, 0x1d, 0x8d, 0x62, 0x62, 0xa5, 0x2f, 0xca, 0x5c, 0x8c, 0x34, 0xf5,
+  0x65, 0x5d, 0x7f, 0xec, 0x10, 0x51, 0xa3, 0xf1, 0x5f, 0x58, 0x2a, 0x76, 0x0d, 0x63, 0x4d, 0x65, 0xb6, 0x39, 0x35, 0x83,
+  0x06, 0xd4, 0x0c, 0xeb, 0xa9, 0x71, 0x4d, 0x1a, 0x57, 0x24, 0x8b, 0x78, 0x98, 0xad, 0xf7, 0x2f, 0xa7, 0xaf, 0xbf, 0xe5,
+  0x9a, 0xa6, 0x0b, 0x94, 0x46, 0x34, 0xcb, 0x30, 0xed, 0x0f, 0xb4, 0x4f, 0xe6, 0x2f, 0x96, 0xd0, 0x03, 0x3f, 0x4d, 0x61,
+  0x45, 0xc6, 0x52, 0x0c, 0xd9, 0xd0, 0x92, 0x19, 0xa6, 0xc9, 0x65, 0x1d, 0x6d, 0x88, 0x8a, 0x58, 0x18, 0xcc, 0xc0, 0xcf,
+  0x2a, 0x54, 0x84, 0x2d, 0x7c, 0x3f, 0xd6, 0xf1, 0xc6, 0x88, 0x5a, 0x35, 0x94, 0x7c, 0x8e, 0xb5, 0x99, 0xe4, 0xff, 0xb4,
+  0x61, 0xe3, 0xcd, 0xa4, 0xfe, 0xa7, 0x66, 0x8d, 0xff, 0xbc, 0x61, 0xe3, 0xc3, 0x46, 0x8d, 0xff, 0xdc, 0x5c, 0x18, 0x5c,
+  0xa1, 0x3b, 0xa6, 0x47, 0xf5, 0xa8, 0x84, 0xb9, 0xd3, 0x07, 0x13, 0x9a, 0x0b, 0x09, 0x4b, 0xf2, 0x63, 0x32, 0x13, 0x82,
+  0xe7, 0x4b, 0xfd, 0x00, 0x53, 0x47, 0x91, 0x20, 0x34, 0x41, 0x60, 0x4d, 0xd8, 0x1e, 0x52, 0xb9, 0xe3, 0xe9, 0xb4, 0xc9,
+  0x94, 0xb0, 0xc3, 0x6f, 0xcd, 0x14, 0xf4, 0xb4, 0x6a, 0x3a, 0xb8, 0xc8, 0x90, 0xeb, 0xaf, 0xcd, 0xc9, 0x18, 0xac, 0x23,
+  0x43, 0xc5, 0x15, 0x9b, 0x0e, 0x44, 0x4d, 0x60, 0x10, 0x29, 0xd6, 0x83, 0x83, 0xd2, 0xb4, 0x89, 0x6f, 0xd5, 0xd4, 0x5b,
+  0x21, 0xba, 0x86, 0x73, 0x47, 0x40, 0x99, 0x86, 0xce, 0x15, 0x5f, 0x2a, 0x1c, 0x06, 0x2d, 0x58, 0xf2, 0xee, 0x8e, 0x76,
+  0xf8, 0xce, 0xd4, 0x3a, 0x8b, 0xc5, 0x4f, 0x8c, 0x85, 0x96, 0x5c, 0x1c, 0x77, 0x7e, 0xd3, 0x4a, 0x56, 0x09, 0xa7, 0xe5,
+  0xe9, 0xe0, 0x8e, 0xa8, 0x87, 0x85, 0x45, 0xa7, 0xb4, 0xbd, 0x50, 0x63, 0x07, 0xdb, 0x90, 0xef, 0x5e, 0x4a, 0x97, 0x91,
+  0x3f, 0xa5, 0xde, 0xce, 0xdf, 0xff, 0xfa, 0xdf, 0xff, 0xf8, 0xdb, 0x5f, 0x76, 0x2e, 0x60, 0x21, 0x6e, 0xa4, 0x63, 0x88,
+  0x2b, 0xd0, 0x5a, 0x63, 0x5e, 0x41, 0x24, 0x4e, 0xb4, 0x3b, 0x0e, 0x14, 0xff, 0xfb, 0x5f, 0xff, 0xf9, 0x6f, 0x65, 0x04,
+  0xec, 0x62, 0xb4, 0xd6, 0x18, 0x0b, 0x15, 0xb0, 0x1e, 0x5b, 0xd5, 0x0e, 0xa3, 0x60, 0x67, 0xf9, 0x15, 0x11, 0x8e, 0x3e,
+  0xf0, 0x2a, 0x6f, 0x93, 0xa5, 0xe8, 0x83, 0xf9, 0xfd, 0x8f, 0x6c, 0x37, 0xb3, 0x01, 0x17, 0xad, 0xf3, 0x0c, 0xfc, 0xa2,
+  0x19, 0x17, 0x4b, 0x79, 0x45, 0x79, 0x66, 0xc4, 0x0a, 0x0a, 0xf0, 0x65, 0x33, 0x83, 0xfd, 0x1a, 0x8f, 0x5a, 0xd4, 0x6c,
+  0x36, 0x5b, 0x27, 0x30, 0x8a, 0xf0, 0x86, 0x82, 0x36, 0x86, 0xa7, 0xdd, 0x36, 0x98, 0x83, 0x71, 0x3a, 0x10, 0x28, 0x49,
+  0xaf, 0xf4, 0xa6, 0x0b, 0xaa, 0x3f, 0x62, 0xb5, 0x9f, 0x26, 0x57, 0x35, 0x59, 0x50, 0x79, 0x6a, 0xa4, 0x70, 0x31, 0x08,
+  0xd9, 0xba, 0x7b, 0xbd, 0x0e, 0xf8, 0xaa, 0x73, 0x24, 0xf2, 0x60, 0x7c, 0xef, 0x83, 0x80, 0xef, 0xe1, 0x85, 0xa2, 0xb7,
+  0xe6, 0xf9, 0x11, 0xbb, 0x0a, 0x5b, 0xed, 0xdf, 0x16, 0xef, 0xec, 0x96, 0xc5, 0x3f, 0xff, 0x19, 0xf8, 0xb2, 0x06, 0x30,
+  0xe0, 0x27, 0x69, 0x3e, 0x0e, 0x54, 0x9d, 0xb1, 0xb1, 0x6a, 0xea, 0xa9, 0x5a, 0xc5, 0x78, 0xe9, 0xd9, 0x12, 0xd0, 0xf9,
+  0x86, 0xd3, 0x78, 0x46, 0x73, 0x18, 0xc8, 0xc2, 0x08, 0xe1, 0x38, 0x66, 0x34, 0xbd, 0x14, 0x19, 0x0c, 0x4a, 0xfc, 0x58,
+  0x3d, 0x8c, 0x8c, 0x99, 0xbb, 0xff, 0x2f, 0x18, 0xb8, 0x23, 0x82, 0x45, 0x38, 0x84, 0xd7, 0xde, 0x51, 0x85, 0xfa, 0xf4,
+  0x84, 0x66, 0x62, 0x2f, 0xa5, 0xd9, 0x12, 0x46, 0x92, 0xa2, 0x38, 0xc8, 0xe7, 0xde, 0x2f, 0x19, 0x86, 0x8c, 0xed, 0xaa,
+  0x8c, 0x40, 0x2b, 0x8d, 0xce, 0x8a, 0x8d, 0xed, 0x97, 0x8a, 0xb4, 0x95, 0x96, 0x51, 0xaa, 0xab, 0x5b, 0x3d, 0x91, 0xa7,
+  0x68, 0x73, 0xea, 0x23, 0xed, 0xfc, 0xf6, 0x44, 0x47, 0xf2, 0x5e, 0x12, 0x51, 0x7e, 0xb5, 0xa2, 0xd7, 0x7e, 0xce, 0xea,
+  0xb0, 0xbe, 0xb2, 0x99, 0x20, 0x3b, 0x3b, 0x6a, 0x6f, 0x13, 0x56, 0xc5, 0x9d, 0x2a, 0xa4, 0x58, 0xc7, 0xee, 0xdc, 0x94,
+  0xc7, 0x46, 0xa2, 0x1b, 0x76, 0xa9, 0x0d, 0x4b, 0x7d, 0x14, 0x77, 0xc1, 0x58, 0xcc, 0xe4, 0x49, 0x22, 0x4d, 0xf8, 0x88,
+  0x6b, 0xea, 0x32, 0x1f, 0x59, 0x73, 0x4e, 0x3e, 0x16, 0xca, 0xfa, 0x8e, 0x59, 0x82, 0x38, 0xab, 0xb8, 0xb1, 0x4e, 0x2e,
+  0x2d, 0xbd, 0xe8, 0x10, 0x49, 0x4b, 0x21, 0x16, 0xc2, 0x29, 0x39, 0xc6, 0x35, 0xdd, 0xa7, 0x91, 0x3d, 0x97, 0x36, 0xbe,
+  0x63, 0xee, 0x59, 0x1c, 0x68, 0xc6, 0x48, 0xf0, 0x45, 0xf9, 0xd1, 0x24, 0x1a, 0x84, 0xb0, 0xb2, 0xd1, 0x72, 0x91, 0xd8,
+  0xe7, 0x17, 0x21, 0x8d, 0x02, 0xf3, 0x38, 0x04, 0x28, 0x4f, 0xcc, 0x90, 0x0e, 0x63, 0x3d, 0x79, 0x1a, 0xde, 0x88, 0x96,
+  0x44, 0xce, 0xeb, 0xf0, 0x2b, 0x94, 0xf4, 0x43, 0x02, 0xfc, 0x43, 0xb9, 0xe6, 0xa2, 0x94, 0x8a, 0x5d, 0xae, 0x13, 0x80,
+  0xaf, 0x3b, 0xf1, 0x63, 0xfd, 0x10, 0xc0, 0x33, 0xf9, 0xa9, 0x5c, 0x1b, 0xcf, 0x40, 0x69, 0x35, 0xf1, 0x48, 0x96, 0x8b,
+  0x42, 0xec, 0xa3, 0x71, 0x8a, 0x81, 0x1d, 0xd6, 0x62, 0xe7, 0xc1, 0x64, 0x06, 0xf8, 0xd9, 0xbe, 0xcd, 0x14, 0x1e, 0xc9,
+  0x39, 0x24, 0x1f, 0x6e, 0xed, 0xcc, 0xa7, 0xc9, 0x0a, 0x53, 0xf7, 0xb0, 0xce, 0x73, 0xc6, 0x4e, 0x6f, 0x3a, 0xf7, 0xc1,
+  0xb0, 0x44, 0xb6, 0xe1, 0x65, 0xb7, 0x68, 0x55, 0xdb, 0xdc, 0x73, 0xed, 0xc0, 0x1b, 0x26, 0x28, 0x32, 0x1c, 0xb7, 0xe7,
+  0x9d, 0xfd, 0xb2, 0xf5, 0xae, 0x33, 0x84, 0x58, 0x6e, 0x99, 0x6b, 0x33, 0x0b, 0x58, 0x3f, 0x30, 0xda, 0xd6, 0xee, 0x67,
+  0x92, 0xe3, 0xae, 0x0c, 0xf1, 0x0c, 0x5f, 0x7f, 0xab, 0x29, 0x2e, 0x99, 0x59, 0x6e, 0xc4, 0x18, 0x6e, 0x95, 0x68, 0x08,
+  0x9f, 0xf0, 0xb3, 0x38, 0xa5, 0x54, 0x1c, 0xfe, 0x2b, 0xd8, 0xd0, 0x95, 0x20, 0x30, 0x84, 0xb7, 0x2d, 0x82, 0x57, 0x46,
+  0xe1, 0x21, 0x2f, 0x3c, 0x0c, 0x04, 0x80, 0x5a, 0xbe, 0x26, 0xef, 0xf0, 0x3a, 0x5b, 0x47, 0xd8, 0x60, 0x18, 0xd5, 0x18,
+  0x60, 0xa1, 0x80, 0xdf, 0xb5, 0x7d, 0x3c, 0x83, 0x05, 0x62, 0xd2, 0xce, 0x7c, 0x26, 0x2e, 0x6d, 0x76, 0x9b, 0x51, 0xbb,
+  0x70, 0x97, 0x7d, 0x3e, 0xfc, 0x0e, 0x06, 0x89, 0x63, 0x53, 0xd5, 0x3c, 0xe2, 0x15, 0x74, 0x3e, 0x89, 0x4b, 0xa9, 0x8c,
+  0x91, 0x12, 0xb5, 0x4a, 0x95, 0xd8, 0x2d, 0x41, 0x3d, 0x7e, 0x49, 0xd0, 0x1b, 0x76, 0xa7, 0x11, 0x54, 0x7e, 0xb4, 0xbc,
+  0x2e, 0xd7, 0x34, 0x03, 0xa7, 0x9c, 0xe0, 0x1e, 0xf0, 0x34, 0x7d, 0x0a, 0xcb, 0x93, 0x4e, 0x2f, 0x4f, 0xbe, 0x03, 0x0e,
+  0xa4, 0x47, 0x7e, 0x46, 0x41, 0x33, 0x3e, 0x90, 0x15, 0xb2, 0x28, 0x04, 0xcf, 0x78, 0x50, 0xa6, 0xae, 0x7a, 0x33, 0x17,
+  0xc0, 0x81, 0x0f, 0xcb, 0x24, 0xcb, 0xd9, 0x44, 0x90, 0x53, 0x60, 0x5b, 0xa0, 0xec, 0xe8, 0xce, 0x99, 0xcd, 0x79, 0x8e,
+  0xdc, 0xb5, 0xcf, 0x5c, 0x4c, 0xbc, 0x77, 0x02, 0xe1, 0x99, 0x2b, 0x61, 0xe3, 0xbc, 0x90, 0x13, 0x75, 0xa8, 0xf3, 0x7c,
+  0xfb, 0x77, 0xca, 0x24, 0x54, 0xb9, 0x20, 0xfc, 0xac, 0xa8, 0xb7, 0x72, 0x66, 0x83, 0x08, 0x7a, 0xcd, 0x5d, 0xdd, 0x36,
+  0xf9, 0x0a, 0x73, 0xb2, 0x08, 0x9e, 0x6a, 0x11, 0xa7, 0x41, 0xdb, 0x6e, 0x27, 0xcd, 0xf2, 0xfa, 0xf9, 0xf9, 0x60, 0xcb,
+  0xdb, 0xaf, 0xf6, 0xb0, 0x55, 0xe3, 0x65, 0xc9, 0xe5, 0x66, 0x41, 0x78, 0xcc, 0x92, 0xe7, 0xda, 0xd8, 0x35, 0x53, 0x13,
+  0x12, 0x1b, 0x9f, 0xcf, 0x6b, 0x55, 0x5e, 0xc5, 0x34, 0x3f, 0x37, 0x9c, 0x32, 0x5c, 0x8a, 0x32, 0x7c, 0x1d, 0x8e, 0x96,
+  0xfb, 0xdc, 0x80, 0xfc, 0x69, 0x9a, 0xfa, 0xb0, 0x1a, 0xc9, 0xd8, 0x5f, 0x8f, 0x61, 0x7c, 0xa7, 0x90, 0x9c, 0x75, 0x80,
+  0xa7, 0xf6, 0xb7, 0xde, 0x2f, 0xb0, 0x3e, 0xf7, 0xda, 0xdb, 0xed, 0x0e, 0xb0, 0xda, 0x2e, 0x2c, 0xdb, 0x4d, 0x75, 0xde,
+  0xa1, 0x2c, 0x8d, 0x1d, 0x47, 0xa7, 0xd9, 0x15, 0x77, 0x68, 0x29, 0x58, 0xfd, 0xde, 0x92, 0x1f, 0x53, 0x85, 0xe9, 0xba,
+  0xf4, 0x96, 0xc8, 0x26, 0x8f, 0x05, 0x05, 0x96, 0xef, 0xfa, 0x67, 0x3c, 0x28, 0xf0, 0x6e, 0x70, 0x06, 0x4d, 0x99, 0x47,
+  0x38, 0xca, 0x2d, 0xc9, 0xa4, 0x08, 0x7d, 0x03, 0x9a, 0xb7, 0xb4, 0x2d, 0x85, 0xa9, 0x63, 0xad, 0xcf, 0x2b, 0xb7, 0x40,
+  0x4c, 0x0f, 0x49, 0x08, 0x4f, 0xd9, 0x33, 0xe2, 0xe7, 0xd4, 0x3f, 0x8d, 0x67, 0xa4, 0x4b, 0xec, 0x1d, 0x7b, 0x44, 0x9c,
+  0xec, 0x06, 0x8e, 0x90, 0x62, 0x43, 0xb5, 0xda, 0xb2, 0x2c, 0x38, 0x7a, 0xe1, 0x8b, 0x4c, 0xa8, 0xa0, 0xef, 0xde, 0xbc,
+  0x3a, 0x85, 0x21, 0x99, 0xce, 0x4f, 0xd8, 0x57, 0x18, 0x56, 0x01, 0xad, 0x66, 0xb7, 0x44, 0x33, 0x12, 0x7f, 0x75, 0xf3,
+  0xd3, 0x6c, 0x22, 0xf1, 0x06, 0x85, 0xb6, 0xf4, 0x94, 0x90, 0x6e, 0x7f, 0xf4, 0x8c, 0xe2, 0xb3, 0xc6, 0x61, 0x0f, 0xad,
+  0x41, 0xc7, 0xd0, 0x15, 0xac, 0x53, 0xe6, 0x09, 0x9e, 0x9f, 0x3b, 0x79, 0x7d, 0xfa, 0x16, 0xf3, 0xa0, 0x60, 0x15, 0x39,
+  0x92, 0x3c, 0xb8, 0xad, 0x13, 0x8b, 0x0f, 0xd6, 0xbc, 0xfd, 0x4c, 0xc9, 0x49, 0xf2, 0xbe, 0x43, 0xfc, 0x88, 0xa6, 0x60,
+  0x03, 0x19, 0xc7, 0x41, 0x82, 0x50, 0x4b, 0xd1, 0x80, 0x74, 0x81, 0x6b, 0x74, 0xfa, 0x5e, 0x6c, 0x9c, 0x9b, 0x47, 0x9a,
+  0x0c, 0x39, 0xbd, 0x1b, 0x71, 0x61, 0x62, 0xa8, 0xc4, 0xa5, 0x81, 0xb4, 0x94, 0xbc, 0xbc, 0x42, 0x6d, 0x8b, 0x8a, 0xe5,
+  0x1a, 0x99, 0x96, 0x76, 0xa2, 0x76, 0x04, 0x5f, 0x7f, 0x2f, 0xd7, 0x6e, 0xd0, 0xe7, 0x49, 0x98, 0x83, 0x62, 0xc0, 0x2b,
+  0x02, 0xe6, 0xf4, 0x9a, 0xd0, 0x78, 0x9a, 0x04, 0xc0, 0x0b, 0x2f, 0xa3, 0x94, 0xe0, 0x69, 0x6e, 0x51, 0xb1, 0x37, 0x67,
+  0x4b, 0x3e, 0xf8, 0x77, 0xe1, 0xe7, 0x9d, 0x72, 0x6c, 0xf0, 0x44, 0x9d, 0x86, 0x77, 0x46, 0x7c, 0xc4, 0xb9, 0xf9, 0x9a,
+  0x70, 0x4f, 0x71, 0x9c, 0xbe, 0x6d, 0xf9, 0x9b, 0xd3, 0xfc, 0x1a, 0x55, 0x19, 0xc3, 0x80, 0x60, 0xcc, 0x9b, 0x80, 0x95,
+  0x63, 0x7b, 0x18, 0x68, 0x55, 0xf3, 0xeb, 0xde, 0x0c, 0xcc, 0xd5, 0x29, 0x3a, 0x26, 0xe8, 0x8c, 0x7c, 0xde, 0xef, 0xf7,
+  0xdb, 0x76, 0xe9, 0x1b, 0x18, 0x68, 0x0c, 0x8a, 0xc2, 0xff, 0x05, 0x3e, 0xf1, 0x23, 0x2c, 0xe2, 0x8d, 0x5b, 0x64, 0xcd,
+  0xfa, 0x73, 0x5f, 0xea, 0x26, 0xa7, 0x99, 0xb0, 0x48, 0x3d, 0xce, 0x2e, 0xd0, 0xa5, 0x38, 0xd8, 0x3b, 0xbd, 0xde, 0xce,
+  0x45, 0x87, 0x29, 0xd6, 0x39, 0xf3, 0x3e, 0x64, 0x64, 0x18, 0x50, 0x0e, 0xf6, 0x3a, 0x56, 0x47, 0x26, 0x21, 0x3b, 0x5e,
+  0xc0, 0xd0, 0xbd, 0x7b, 0x78, 0x66, 0x16, 0x46, 0x34, 0x28, 0x0a, 0x1f, 0x59, 0x85, 0xec, 0xeb, 0x09, 0xb8, 0x49, 0xec,
+  0xc6, 0x5d, 0xa8, 0x76, 0xec, 0xe7, 0xf3, 0xde, 0x94, 0x86, 0x91, 0xc7, 0xe0, 0x76, 0xc8, 0x63, 0x9b, 0x69, 0x54, 0x9c,
+  0x92, 0xd0, 0xfb, 0x09, 0xf5, 0x86, 0x66, 0x35, 0x14, 0x0d, 0xe6, 0x40, 0x40, 0x4d, 0x4f, 0xc0, 0x74, 0xc1, 0x21, 0xe9,
+  0x40, 0x55, 0xc4, 0xac, 0x33, 0x30, 0xcb, 0xd3, 0xe4, 0x3d, 0x95, 0x0c, 0x3e, 0x4f, 0x2f, 0x26, 0xde, 0xbd, 0x0f, 0x9c,
+  0xde, 0xbd, 0xb3, 0xdb, 0x6d, 0xf9, 0xfc, 0xa5, 0xf6, 0xfc, 0xf8, 0xec, 0xb6, 0x73, 0xae, 0xe3, 0x50, 0x0e, 0x0b, 0x60,
+  0x28, 0xda, 0xfe, 0x82, 0xf4, 0x7b, 0x8f, 0x15, 0xd3, 0x51, 0xce, 0x3c, 0x3c, 0xee, 0x01, 0xfc, 0x62, 0xc7, 0x3c, 0xd8,
+  0xc3, 0x01, 0x63, 0x1f, 0x7b, 0x7e, 0xf0, 0xc0, 0xda, 0xa4, 0xf8, 0x1a, 0x19, 0x9b, 0xae, 0x30, 0x74, 0x9a, 0x4c, 0xdf,
+  0x5f, 0x85, 0x99, 0xb8, 0x93, 0x40, 0xde, 0xe5, 0xe0, 0xe1, 0x4d, 0x0e, 0x76, 0x68, 0x2e, 0xf7, 0x53, 0x74, 0x0c, 0xba,
+  0x8c, 0x95, 0x27, 0x2f, 0x91, 0x37, 0xe0, 0x7f, 0x7a, 0xd8, 0xd6, 0x0e, 0x6b, 0xab, 0x03, 0x74, 0x0d, 0xe1, 0x5f, 0x51,
+  0xc1, 0x8e, 0xed, 0x81, 0x3a, 0x04, 0x70, 0x8e, 0x06, 0xe0, 0xb4, 0x9a, 0x12, 0xbe, 0x80, 0x50, 0x5d, 0x02, 0x9e, 0xf2,
+  0x2e, 0xe1, 0xc3, 0x01, 0x67, 0x31, 0xfe, 0xd7, 0xec, 0x92, 0x50, 0x59, 0x1e, 0x67, 0xe2, 0x13, 0x40, 0x8f, 0x54, 0x7d,
+  0x61, 0x8b, 0xc1, 0x03, 0xc4, 0x19, 0x90, 0xf1, 0x98, 0xec, 0x76, 0xce, 0xc8, 0x7d, 0xe2, 0x0d, 0xc8, 0xc1, 0x01, 0xff,
+  0x76, 0x9f, 0x7c, 0xd9, 0x81, 0xff, 0xb1, 0xa4, 0xdb, 0x30, 0x5e, 0x19, 0xf9, 0x09, 0xc5, 0xc8, 0x4b, 0x99, 0x06, 0x88,
+  0xfe, 0xeb, 0x15, 0x8e, 0xfd, 0x57, 0x5c, 0x0e, 0xbb, 0x64, 0xc0, 0xae, 0xf8, 0x08, 0x08, 0x5e, 0x74, 0x1d, 0x18, 0xd0,
+  0x30, 0x8a, 0x13, 0x0a, 0x6e, 0xff, 0x09, 0x74, 0xd6, 0xeb, 0xd8, 0x45, 0x60, 0x8d, 0x84, 0x1c, 0x6d, 0x13, 0xf9, 0x77,
+  0xd8, 0x47, 0x52, 0x59, 0x83, 0x0f, 0x30, 0x01, 0x00, 0x19, 0xab, 0x06, 0x7f, 0x9b, 0xb3, 0x70, 0x1b, 0xf9, 0x59, 0xc2,
+  0xc6, 0x45, 0xce, 0xe9, 0x4f, 0xac, 0xc9, 0x03, 0x6d, 0x8b, 0x3b, 0x1f, 0x4a, 0xa9, 0x1b, 0xe0, 0xa9, 0xe3, 0xe0, 0xdc,
+  0xf2, 0xd9, 0x78, 0x4d, 0xee, 0x7d, 0xc0, 0x1e, 0xdf, 0x92, 0x57, 0xcf, 0x9f, 0x65, 0xe7, 0x35, 0x3e, 0x0a, 0x28, 0x38,
+  0x87, 0x83, 0x02, 0xad, 0xdc, 0xb5, 0x77, 0x22, 0x23, 0xc7, 0xec, 0x32, 0x8f, 0x7a, 0x85, 0x29, 0x7a, 0xd5, 0x2e, 0x79,
+  0xa9, 0x1c, 0xba, 0x27, 0xce, 0x3a, 0xf5, 0xf8, 0x6d, 0x31, 0xcc, 0xd3, 0xef, 0xdb, 0xa9, 0x33, 0x32, 0x69, 0x0e, 0x11,
+  0x15, 0x8e, 0x40, 0xcc, 0xd6, 0x7f, 0x63, 0x41, 0x06, 0x7a, 0x7c, 0x1e, 0x3a, 0x1c, 0x3c, 0xed, 0x9c, 0x95, 0x6e, 0xb3,
+  0x5f, 0xb9, 0xea, 0x74, 0x3a, 0xee, 0xd4, 0x17, 0x22, 0x41, 0xa5, 0x8f, 0xac, 0xb7, 0x63, 0x47, 0x3a, 0x6d, 0xe3, 0x71,
+  0xc7, 0xee, 0x98, 0x66, 0xef, 0x36, 0xf5, 0xc9, 0x70, 0xd4, 0xb9, 0xbb, 0xe1, 0x1e, 0xfb, 0xff, 0x07, 0x27, 0x05, 0xa9,
+  0x5f, 0xc9, 0xac, 0x45, 0xcb, 0x53, 0xc1, 0x7b, 0x54, 0xcc, 0xd1, 0xc7, 0x18, 0xa5, 0x76, 0x9d, 0x0d, 0x58, 0x75, 0x2d,
+  0xeb, 0x07, 0x23, 0xe7, 0x32, 0x0d, 0x3f, 0x4a, 0x92, 0xa5, 0x31, 0x5a, 0x39, 0x9e, 0x1c, 0x48, 0x56, 0xb9, 0x27, 0xc5,
+  0x7d, 0x1b, 0xcf, 0x93, 0xdd, 0xb5, 0xaf, 0xb3, 0xd9, 0x58, 0xd4, 0x09, 0x3f, 0xbb, 0xa0, 0xa6, 0xdd, 0x59, 0x1b, 0x11,
+  0x50, 0x17, 0x8e, 0x8b, 0xe1, 0xac, 0x70, 0x9c, 0xe5, 0x0d, 0xed, 0x8d, 0xe6, 0x9b, 0x90, 0x6a, 0xb5, 0x66, 0x52, 0x01,
+  0x83, 0x3a, 0x68, 0x7e, 0x49, 0xcd, 0x06, 0x14, 0x73, 0x4d, 0xc0, 0xae, 0xd8, 0xa9, 0xd7, 0x03, 0x2f, 0x98, 0x18, 0xa0,
+  0x87, 0x03, 0xe6, 0xa2, 0xaf, 0x7c, 0x07, 0x26, 0x52, 0xf8, 0xb1, 0x83, 0x87, 0x0b, 0x57, 0x69, 0x6c, 0xd9, 0x7e, 0x7e,
+  0x81, 0x3d, 0x5f, 0x4a, 0x20, 0x8a, 0x37, 0xec, 0x43, 0xa1, 0x6d, 0x79, 0x85, 0x5e, 0xc2, 0xef, 0xae, 0x3e, 0xb4, 0xa8,
+  0x53, 0x57, 0x52, 0xd0, 0x6b, 0xb5, 0x04, 0x46, 0xab, 0xcb, 0x19, 0x0c, 0xcb, 0xc2, 0xc7, 0x7c, 0x39, 0x2c, 0xb0, 0x80,
+  0x68, 0xaf, 0xa2, 0xbc, 0xc3, 0x9d, 0xa5, 0x09, 0x22, 0x9a, 0xf4, 0xf2, 0xe4, 0x34, 0x47, 0x43, 0xe0, 0x81, 0xaf, 0xd4,
+  0x5b, 0xfa, 0xc1, 0x29, 0x5a, 0x02, 0x4c, 0x7b, 0x68, 0xf7, 0xdb, 0x50, 0x93, 0xaf, 0x91, 0x8d, 0x33, 0x01, 0xcd, 0xc6,
+  0xb0, 0x1d, 0xe2, 0x15, 0x45, 0x38, 0x15, 0x99, 0xb3, 0x36, 0x62, 0x34, 0x6a, 0x0b, 0xdc, 0x5b, 0xab, 0x87, 0xf8, 0xe7,
+  0x29, 0x5f, 0xbd, 0x7f, 0xcd, 0xe6, 0x8d, 0xc7, 0xb8, 0x56, 0x3e, 0xc2, 0xfb, 0x2a, 0x61, 0x69, 0xcc, 0x2b, 0xbc, 0xf4,
+  0x28, 0x8c, 0xb8, 0xb3, 0xb4, 0x8a, 0xf1, 0x66, 0x2c, 0x98, 0x94, 0x0b, 0xf1, 0xab, 0x5b, 0x19, 0x78, 0x1b, 0xb8, 0xa5,
+  0x70, 0x81, 0xf2, 0x2e, 0xce, 0x05, 0xa4, 0xc9, 0x04, 0xf3, 0x6e, 0x22, 0x7a, 0x49, 0x23, 0x16, 0xcd, 0x89, 0x71, 0x6a,
+  0xf2, 0xf9, 0xb8, 0x58, 0x42, 0x63, 0xfc, 0x46, 0xe4, 0x45, 0x18, 0x87, 0x8b, 0xd5, 0xa2, 0xe3, 0xb0, 0x3f, 0xaf, 0xd4,
+  0x3d, 0xcc, 0x0e, 0x33, 0x04, 0xad, 0x75, 0x45, 0xf3, 0x9f, 0xc6, 0x1c, 0x4d, 0x5d, 0x97, 0x58, 0x38, 0x8e, 0x07, 0x1f,
+  0x4b, 0x22, 0x2c, 0x87, 0x43, 0x1c, 0x56, 0xb7, 0x37, 0x6c, 0x2d, 0x33, 0x24, 0xba, 0x50, 0x5c, 0x45, 0xc2, 0x59, 0x6d,
+  0x51, 0xa4, 0x3c, 0x66, 0x8c, 0x63, 0xd5, 0x44, 0x38, 0x59, 0x79, 0xdb, 0x4a, 0xfa, 0x94, 0x17, 0x5b, 0x80, 0xf6, 0x9c,
+  0x24, 0xd7, 0x35, 0xd0, 0x2c, 0xc2, 0x53, 0x82, 0x16, 0x70, 0x3d, 0x3c, 0xe2, 0x81, 0x7d, 0x90, 0x1f, 0xda, 0x15, 0xf5,
+  0xd8, 0x03, 0xf3, 0xf9, 0x78, 0x5f, 0x7a, 0x34, 0xc6, 0x20, 0x6f, 0x50, 0x51, 0xdd, 0xa1, 0x19, 0x60, 0x11, 0xcd, 0x44,
+  0xd9, 0x9e, 0x7c, 0x1b, 0x04, 0x05, 0x78, 0xd3, 0x23, 0x49, 0x02, 0xb7, 0xde, 0x82, 0x90, 0x51, 0x99, 0xd6, 0xaf, 0x48,
+  0x7b, 0xc0, 0x22, 0x80, 0xfd, 0xb6, 0x11, 0x80, 0xaa, 0x16, 0xb9, 0x4d, 0xac, 0x60, 0x13, 0x13, 0x52, 0x6b, 0x4a, 0xe4,
+  0x9e, 0x7a, 0xa4, 0xe6, 0xa2, 0xcb, 0x90, 0xb8, 0x22, 0x68, 0xae, 0x77, 0x26, 0x24, 0xd6, 0x35, 0x08, 0x9c, 0x1f, 0x35,
+  0x15, 0xbd, 0x73, 0x70, 0x1b, 0x35, 0x6e, 0xde, 0x12, 0x4f, 0xbd, 0xb3, 0x29, 0x0e, 0xab, 0x9e, 0xb2, 0xdc, 0x39, 0x2e,
+  0x6c, 0x60, 0x48, 0x4d, 0x0f, 0xea, 0x13, 0xec, 0x6d, 0x4a, 0xcd, 0xd4, 0xc4, 0xf9, 0xb1, 0x55, 0x8d, 0x76, 0x7d, 0x81,
+  0x3f, 0x51, 0x2a, 0xc9, 0x8f, 0xc2, 0xfc, 0x66, 0xcb, 0xd8, 0x12, 0x32, 0x16, 0xf7, 0xff, 0xba, 0xa2, 0xe9, 0xcd, 0x29,
+  0x73, 0x00, 0x93, 0xf4, 0x69, 0x14, 0x79, 0x6d, 0xfc, 0x5d, 0x23, 0x39, 0x9b, 0xb0, 0xb6, 0x9a, 0xe3, 0x78, 0xf9, 0xbf,
+  0xd6, 0x21, 0xf6, 0xdb, 0x4d, 0x0d, 0xed, 0xa3, 0x38, 0x94, 0xb5, 0x48, 0x2e, 0xa9, 0xb8, 0x08, 0x9f, 0xe7, 0xce, 0xf0,
+  0xc5, 0x9f, 0x8f, 0x79, 0x31, 0x48, 0x97, 0x1f, 0x07, 0xd2, 0x34, 0x6c, 0x95, 0x72, 0xbf, 0xab, 0x28, 0x2d, 0xe8, 0xc3,
+  0x16, 0x73, 0xed, 0xc4, 0x5a, 0xca, 0x1a, 0x2c, 0x4e, 0xac, 0x69, 0xcc, 0x5c, 0x83, 0x55, 0xde, 0x76, 0xa8, 0x61, 0x67,
+  0xf7, 0x2c, 0x4d, 0xeb, 0xb1, 0xdb, 0xd7, 0xfb, 0x18, 0x5d, 0xcd, 0x13, 0xc2, 0x98, 0x03, 0xf3, 0x16, 0x5a, 0xd0, 0xf7,
+  0xa0, 0x34, 0xa4, 0xe8, 0xbe, 0x6b, 0x27, 0xec, 0x8c, 0x9b, 0x3c, 0xc0, 0x16, 0x01, 0x77, 0x52, 0x6e, 0x19, 0xd8, 0x6a,
+  0xd9, 0xe6, 0x95, 0x1a, 0x62, 0xb1, 0x29, 0x84, 0xb8, 0x41, 0xf5, 0x3f, 0xcd, 0xc1, 0x76, 0x4f, 0x60, 0xd5, 0xe8, 0xb5,
+  0xe5, 0xaf, 0x1a, 0xb4, 0x5d, 0xbc, 0x28, 0x1f, 0xd0, 0x13, 0xa8, 0x6e, 0x11, 0xe4, 0xbc, 0xd3, 0x8c, 0x4e, 0xbc, 0x56,
+  0x55, 0xee, 0x34, 0x33, 0x33, 0x75, 0x05, 0x06, 0x8b, 0x64, 0x57, 0xa1, 0xcc, 0x6a, 0x48, 0xb4, 0x5f, 0xc0, 0x32, 0x62,
+  0xe6, 0x8a, 0xf0, 0x43, 0xb5, 0xf3, 0x68, 0x9d, 0xaa, 0x72, 0xee, 0xd2, 0x3b, 0xf3, 0x09, 0x25, 0x21, 0x72, 0xf7, 0x3a,
+  0x73, 0x90, 0x21, 0x0a, 0x6a, 0xc9, 0x90, 0x71, 0xed, 0x32, 0x19, 0x8e, 0x10, 0x63, 0xb9, 0x79, 0x74, 0xa2, 0x67, 0x9a,
+  0x97, 0x5f, 0x26, 0x02, 0x6b, 0xd4, 0x52, 0xc0, 0x16, 0xae, 0xe5, 0xe6, 0xd9, 0x2a, 0xb7, 0x26, 0x7a, 0xaf, 0xdf, 0x2a,
+  0xc6, 0x7e, 0xe0, 0x85, 0x65, 0x6b, 0xf0, 0xed, 0xb3, 0x7a, 0x07, 0x58, 0xfd, 0x34, 0xcc, 0x06, 0x0e, 0xb0, 0x8a, 0x08,
+  0x23, 0xac, 0xc3, 0xca, 0x94, 0x57, 0x57, 0x65, 0x2b, 0x59, 0x95, 0xce, 0xa7, 0xbb, 0x1f, 0xbf, 0x45, 0xd1, 0x32, 0xda,
+  0x1a, 0x25, 0x91, 0x68, 0xbc, 0xe3, 0x3f, 0x44, 0xa3, 0xfd, 0x62, 0x63, 0x13, 0x0e, 0xca, 0xdf, 0xc3, 0xd9, 0x80, 0x81,
+  0x8e, 0x9b, 0x65, 0x48, 0xe9, 0x5e, 0x19, 0x52, 0x77, 0xab, 0x0c, 0xa9, 0xba, 0x53, 0xe6, 0xa3, 0x8f, 0x76, 0xb5, 0x8b,
+  0xb0, 0xec, 0xa6, 0xa7, 0xa9, 0x1a, 0x82, 0xae, 0x39, 0xad, 0xb4, 0x09, 0x96, 0x61, 0x13, 0x2c, 0xca, 0x25, 0xe2, 0x97,
+  0xfc, 0x75, 0xf9, 0x2e, 0xfd, 0x1a, 0x71, 0xdd, 0x54, 0xce, 0x18, 0x52, 0xee, 0xf8, 0xf0, 0x66, 0x36, 0x93, 0x35, 0x71,
+  0x8c, 0xa8, 0xb1, 0x9c, 0xf1, 0xe4, 0xb3, 0x0d, 0x44, 0xad, 0x74, 0x37, 0x4f, 0xe9, 0x98, 0x4e, 0x47, 0x1d, 0xc1, 0x71,
+  0x6c, 0x24, 0x3a, 0x2e, 0x6e, 0x71, 0x9f, 0xa8, 0xd1, 0xce, 0xa6, 0x54, 0xa2, 0x69, 0x7a, 0x31, 0x4a, 0xd5, 0x61, 0x13,
+  0xe3, 0x84, 0x46, 0x55, 0x2b, 0x9b, 0x5c, 0x2d, 0xe2, 0x38, 0x32, 0xd1, 0xd1, 0x32, 0xfe, 0xab, 0x9a, 0xf8, 0x98, 0x9b,
+  0x3a, 0xaa, 0xb2, 0xfa, 0x8d, 0xdc, 0xf6, 0xaa, 0x06, 0x37, 0xbb, 0xe9, 0xc2, 0x99, 0xb1, 0xde, 0x31, 0x32, 0xd1, 0xab,
+  0x1a, 0x2a, 0x5f, 0x1a, 0x51, 0x16, 0x5b, 0xfd, 0x3e, 0xf3, 0x86, 0x82, 0xab, 0xdd, 0x88, 0x5e, 0x2b, 0xba, 0x0e, 0x8b,
+  0xaf, 0x7b, 0xba, 0xa5, 0x1f, 0xd0, 0x6a, 0xd4, 0xbc, 0xfd, 0x63, 0x5d, 0x1f, 0x61, 0xe8, 0x38, 0x8a, 0x2e, 0x3f, 0xc3,
+  0xdc, 0xc8, 0xe0, 0xdd, 0xcd, 0x56, 0x78, 0xd3, 0x93, 0xd4, 0xbf, 0xcd, 0x54, 0xb2, 0xde, 0x09, 0x0f, 0x53, 0x1e, 0x08,
+  0x6f, 0xaa, 0xc5, 0x1c, 0x19, 0xe9, 0x8e, 0x63, 0xe5, 0x7a, 0x46, 0xaa, 0x9d, 0xa0, 0x62, 0xf7, 0x91, 0x5d, 0x32, 0x2a,
+  0x3b, 0x68, 0xc5, 0xdc, 0x38, 0xba, 0x06, 0x37, 0xa2, 0xd9, 0xbf, 0x9f, 0xd6, 0x36, 0xa6, 0x85, 0xbb, 0x09, 0x62, 0xa2,
+  0xb7, 0xed, 0xca, 0xdf, 0xff, 0xfa, 0x1f, 0xff, 0xf8, 0xdb, 0x5f, 0xc8, 0xd1, 0xeb, 0x6f, 0x5f, 0xbc, 0xfc, 0x86, 0x1c,
+  0xbf, 0x7e, 0xf6, 0x9c, 0x3c, 0x3d, 0x7a, 0xfb, 0xf2, 0xfb, 0xe7, 0x9a, 0xc3, 0x62, 0x22, 0xe0, 0xc9, 0x58, 0xfc, 0x97,
+  0xa0, 0x71, 0xe7, 0x93, 0xff, 0x12, 0x5c, 0xbb, 0xf2, 0x02, 0xbf, 0xfa, 0xe6, 0xff, 0xfd, 0x7f, 0xb0, 0xf9, 0x6f, 0x71,
+  0xa3, 0x37, 0x62, 0xc2, 0xdf, 0xb8, 0xdd, 0xe1, 0x97, 0x3e, 0xdd, 0x2b, 0xcc, 0xe2, 0xad, 0x95, 0xf2, 0x69, 0xdf, 0x16,
+  0xc7, 0x73, 0x65, 0xf5, 0x4b, 0xdb, 0xb4, 0x29, 0xa8, 0xd2, 0xb5, 0xf9, 0xe5, 0x67, 0x6c, 0x9f, 0x3a, 0xf6, 0xe1, 0x9d,
+  0x9f, 0x42, 0x23, 0xcb, 0x55, 0x36, 0x97, 0x57, 0xd3, 0xfb, 0xe4, 0x07, 0x3a, 0x39, 0x4d, 0x60, 0x11, 0x84, 0x21, 0x36,
+  0xff, 0x26, 0xc1, 0x0c, 0xbe, 0xb8, 0x48, 0x74, 0xfe, 0x13, 0xc7, 0xd1, 0x9b, 0x77, 0xf4, 0x38, 0x1e, 0xf6, 0x5b, 0x1d,
+  0x72, 0xf3, 0x33, 0xfe, 0xce, 0xb1, 0xf7, 0xc8, 0x0b, 0x58, 0x3d, 0x66, 0xec, 0x07, 0x19, 0x51, 0xe0, 0xe4, 0x49, 0x5b,
+  0x18, 0x53, 0x96, 0x7c, 0xce, 0x49, 0x9a, 0xfa, 0x71, 0x9b, 0x45, 0xc6, 0x62, 0xdc, 0xe7, 0xd8, 0xd2, 0xa5, 0x07, 0xcb,
+  0x4f, 0x12, 0xb6, 0xbf, 0xf8, 0x78, 0x50, 0xdc, 0x5f, 0xc7, 0x0b, 0x58, 0x94, 0xf3, 0x98, 0x85, 0x6b, 0x56, 0x51, 0x54,
+  0x94, 0x1a, 0xe7, 0xe7, 0xa0, 0x74, 0xe6, 0x47, 0xf2, 0x97, 0x77, 0xb1, 0x98, 0x6d, 0x94, 0x50, 0xbe, 0x44, 0x2b, 0x15,
+  0x22, 0x85, 0x18, 0xbf, 0x4f, 0x15, 0x56, 0x6b, 0x8b, 0x9e, 0xe2, 0xb6, 0xbe, 0xe2, 0x2a, 0xdb, 0x22, 0xf0, 0xf8, 0xea,
+  0xc1, 0x96, 0x7d, 0xdc, 0x86, 0x11, 0xa1, 0x24, 0x54, 0xd9, 0xdf, 0xe3, 0xae, 0x8c, 0xa8, 0xa9, 0xcb, 0x36, 0xcb, 0x28,
+  0xc2, 0x0d, 0xc9, 0x57, 0x7c, 0x73, 0xe9, 0x80, 0x3c, 0x1a, 0xe0, 0xa1, 0x01, 0xf6, 0x1d, 0xa6, 0x09, 0x8b, 0x00, 0x7b,
+  0xfd, 0x0e, 0x3b, 0xb1, 0x34, 0x90, 0x11, 0x68, 0x9d, 0x38, 0x15, 0xe0, 0x8e, 0x7c, 0xcc, 0xf8, 0xb6, 0x20, 0x07, 0xd6,
+  0x86, 0xf6, 0x12, 0x73, 0xd9, 0xde, 0x26, 0x27, 0x34, 0x9d, 0x72, 0x49, 0x65, 0x1f, 0x58, 0x36, 0x13, 0x7f, 0x1a, 0x93,
+  0xc1, 0xa3, 0x7e, 0x9f, 0x7c, 0xc5, 0x77, 0x61, 0xd9, 0x6f, 0x23, 0x7a, 0xa2, 0xa8, 0xcb, 0x8a, 0x70, 0x4f, 0xfb, 0x11,
+  0xe6, 0x5b, 0xf5, 0x2d, 0xd4, 0x5c, 0x31, 0xea, 0x13, 0x84, 0xc2, 0x02, 0x3e, 0x9e, 0xd2, 0x91, 0x41, 0xd3, 0x60, 0x0f,
+  0x43, 0xd3, 0x98, 0x80, 0xd7, 0xd9, 0x36, 0x8e, 0x30, 0x1f, 0x67, 0x66, 0xc5, 0xdd, 0xa1, 0xf7, 0xb0, 0x54, 0x11, 0x7c,
+  0x9f, 0x12, 0xba, 0xc7, 0xa5, 0x5a, 0xdc, 0xbb, 0x19, 0x91, 0x6f, 0x57, 0x8b, 0x09, 0x98, 0x0b, 0x59, 0x9f, 0x9d, 0xd8,
+  0x02, 0xb4, 0x03, 0x49, 0x80, 0x76, 0x2d, 0x82, 0x06, 0xad, 0x8e, 0xe0, 0x56, 0x23, 0xd8, 0x5b, 0x8f, 0xe0, 0xc7, 0x4a,
+  0xe8, 0x61, 0xdf, 0x86, 0xde, 0x2d, 0x41, 0xff, 0x54, 0x0d, 0xfd, 0x70, 0x3d, 0xf4, 0xcf, 0xd5, 0xd0, 0x8f, 0x6b, 0xa1,
+  0xcd, 0xd3, 0xba, 0x23, 0x4b, 0x5c, 0x3c, 0x8b, 0xf1, 0xbb, 0x92, 0x8f, 0x36, 0x86, 0x61, 0x63, 0x0c, 0x0f, 0xcb, 0x18,
+  0x8a, 0x03, 0x89, 0x23, 0x4b, 0x98, 0x77, 0xf7, 0x8c, 0x6a, 0xd2, 0x97, 0x2a, 0xaa, 0xbd, 0xe4, 0x48, 0xbf, 0x2c, 0x09,
+  0x84, 0x75, 0x65, 0xf9, 0x88, 0x78, 0x96, 0xa4, 0xed, 0x3e, 0x11, 0x30, 0x20, 0xdd, 0x83, 0x7e, 0xbf, 0x5f, 0xf0, 0x67,
+  0x50, 0x85, 0xe6, 0xc9, 0x93, 0x32, 0x9a, 0x87, 0xbb, 0x9b, 0xa2, 0x61, 0x57, 0xbd, 0x97, 0xd0, 0x7c, 0xd9, 0x04, 0x4d,
+  0x61, 0x35, 0x01, 0x03, 0x9f, 0xfe, 0xf7, 0x49, 0xff, 0xba, 0x3f, 0xe0, 0xda, 0xa2, 0x6f, 0x6f, 0xd3, 0x88, 0x24, 0x18,
+  0xee, 0x57, 0x1e, 0x5f, 0x5a, 0xba, 0x02, 0x18, 0x37, 0x90, 0x82, 0xe9, 0x70, 0x4a, 0xa1, 0xfe, 0x18, 0xb7, 0xbd, 0x8d,
+  0x63, 0x94, 0x87, 0x7a, 0xb1, 0x4d, 0xea, 0x50, 0xdb, 0x01, 0x63, 0x4a, 0x0b, 0x41, 0xed, 0x03, 0x0c, 0xe2, 0x54, 0x75,
+  0x02, 0xfa, 0x14, 0x7f, 0x1d, 0x85, 0x9d, 0x99, 0xce, 0xd8, 0x86, 0x12, 0xc9, 0x42, 0xd0, 0x1d, 0xfc, 0x3a, 0x28, 0xdc,
+  0xd5, 0x4e, 0x56, 0x99, 0x76, 0xfc, 0x88, 0x59, 0x98, 0x26, 0x66, 0xca, 0xd2, 0xdd, 0xac, 0xbd, 0x4f, 0xa2, 0xb7, 0x07,
+  0x0f, 0x2b, 0xf5, 0x76, 0xff, 0xfa, 0x69, 0xad, 0xea, 0x9e, 0xe2, 0x82, 0xaf, 0x46, 0x75, 0x57, 0x36, 0xf8, 0x40, 0x80,
+  0x7e, 0x01, 0xac, 0xb7, 0x1a, 0x30, 0x4c, 0x03, 0xf6, 0xf7, 0xd8, 0x36, 0x0e, 0xa8, 0x0d, 0xac, 0xf1, 0xd6, 0xaa, 0x7f,
+  0xe7, 0xa8, 0xbe, 0xe7, 0xac, 0x7e, 0xc1, 0x52, 0x69, 0xcc, 0x1e, 0x28, 0x45, 0xd9, 0x77, 0x82, 0xc8, 0x71, 0x3e, 0x24,
+  0xef, 0xce, 0xf6, 0xed, 0x7c, 0xa5, 0x90, 0xa7, 0xf6, 0x84, 0xd0, 0x45, 0xd6, 0x3b, 0x78, 0x34, 0xf3, 0x7a, 0x38, 0x8e,
+  0x64, 0x36, 0xc3, 0x15, 0xf9, 0x21, 0xe7, 0x43, 0xc8, 0x78, 0xb0, 0x6f, 0x9c, 0xb9, 0x8e, 0x33, 0x58, 0xaa, 0x81, 0x0f,
+  0x10, 0x84, 0x38, 0x7c, 0x68, 0x89, 0x48, 0x96, 0x10, 0xf6, 0x3b, 0x3f, 0xb8, 0xfb, 0x77, 0x05, 0xee, 0xd2, 0x12, 0xdd,
+  0x80, 0x20, 0xa1, 0x19, 0xfa, 0x20, 0x0b, 0x26, 0xca, 0x56, 0x33, 0xb0, 0xbc, 0x62, 0xac, 0xf0, 0x24, 0x57, 0xba, 0x36,
+  0x57, 0x38, 0x21, 0x52, 0x8f, 0x91, 0xf1, 0x78, 0x4c, 0x34, 0x42, 0x44, 0x57, 0x7b, 0xe8, 0x69, 0x79, 0xc6, 0xfd, 0x05,
+  0xc2, 0xe4, 0xc9, 0xc1, 0xe9, 0x8a, 0xa6, 0xf8, 0x34, 0xda, 0xd6, 0x6a, 0x5e, 0xdb, 0x0a, 0x4e, 0x74, 0xfd, 0x01, 0x91,
+  0xda, 0x13, 0x3a, 0xaf, 0x46, 0x41, 0x87, 0xbc, 0xa9, 0x84, 0xdc, 0x5b, 0x03, 0xf9, 0x6b, 0x25, 0xe4, 0x63, 0x07, 0xa4,
+  0x23, 0xd3, 0xfa, 0xd6, 0x9c, 0xfb, 0x82, 0x0d, 0xee, 0x14, 0x91, 0xb9, 0x1f, 0x07, 0x11, 0x9f, 0x9a, 0xa7, 0xbc, 0x9e,
+  0x27, 0xea, 0x1b, 0x47, 0x10, 0x4f, 0xd9, 0x4f, 0xf5, 0xce, 0x72, 0xe6, 0xab, 0xda, 0xaa, 0xa0, 0x8b, 0xbf, 0xe7, 0xcd,
+  0x4f, 0xaa, 0xf2, 0x1d, 0x61, 0xb6, 0x13, 0x9c, 0xa4, 0xe1, 0x45, 0x18, 0x6b, 0xd3, 0xc8, 0xf2, 0x1d, 0x0f, 0xb9, 0x9f,
+  0x87, 0x33, 0xf7, 0x33, 0x2d, 0xa6, 0x60, 0xee, 0xf3, 0xdb, 0x1e, 0x25, 0x76, 0x5f, 0x5d, 0x3a, 0x28, 0x86, 0x57, 0xee,
+  0x44, 0x88, 0x5b, 0x1f, 0x1c, 0x1b, 0xfc, 0xe2, 0x96, 0x16, 0x51, 0xa3, 0xc7, 0x87, 0x1f, 0xc8, 0x36, 0x28, 0x92, 0x0a,
+  0x7f, 0x7f, 0x6b, 0x93, 0xab, 0x1c, 0x84, 0xad, 0x17, 0x98, 0xaf, 0x75, 0xd3, 0x6e, 0xec, 0x84, 0x35, 0xb9, 0x99, 0xc1,
+  0xc4, 0x75, 0xb3, 0x09, 0xae, 0x61, 0x3d, 0xae, 0x5f, 0x2b, 0x70, 0x69, 0xd7, 0x87, 0xa2, 0xc3, 0x98, 0xe5, 0xcf, 0xf4,
+  0x58, 0x86, 0x16, 0xc9, 0x40, 0xd7, 0x1d, 0x7f, 0x50, 0x6a, 0x91, 0xe0, 0xf4, 0xc7, 0xe9, 0x8c, 0xb7, 0xf4, 0xf8, 0x71,
+  0xb8, 0xe0, 0x97, 0x72, 0x30, 0x41, 0x30, 0x25, 0xcb, 0xc0, 0x68, 0x5c, 0xb7, 0xf3, 0x99, 0xb6, 0x10, 0xd0, 0x95, 0x8b,
+  0xb9, 0x3e, 0xd0, 0x87, 0x5a, 0xd1, 0xf7, 0x54, 0xb6, 0xc8, 0xed, 0x48, 0x39, 0x58, 0x5e, 0xb9, 0xc6, 0xa8, 0x3f, 0x95,
+  0x5a, 0x7f, 0x75, 0x00, 0x9f, 0x24, 0xd6, 0xda, 0xc3, 0x4c, 0x12, 0xae, 0x16, 0xf0, 0x4e, 0x69, 0xd1, 0xc4, 0xec, 0x38,
+  0x17, 0x42, 0x65, 0x8d, 0x2a, 0xce, 0xd9, 0x3a, 0x6e, 0x33, 0xf2, 0x34, 0xf0, 0x2a, 0x19, 0xb6, 0x6f, 0x3b, 0x5a, 0x3f,
+  0xca, 0xc5, 0x35, 0x9c, 0x88, 0xe9, 0x84, 0x2f, 0x17, 0xad, 0x71, 0x2b, 0x96, 0x68, 0x9f, 0xa9, 0xbe, 0x99, 0xd3, 0x55,
+  0x3b, 0xc0, 0xbc, 0xaf, 0x92, 0x96, 0x8a, 0x75, 0x5d, 0xc6, 0x34, 0x1a, 0x4d, 0x2f, 0xfd, 0xc8, 0x53, 0x55, 0xb7, 0xc9,
+  0x23, 0x95, 0xa4, 0x65, 0x13, 0x23, 0x96, 0xa6, 0x8a, 0xf3, 0xbc, 0x43, 0x5e, 0x29, 0xd8, 0xc1, 0x57, 0xce, 0xdc, 0x75,
+  0x50, 0x2b, 0x69, 0xef, 0xfc, 0x2a, 0x1b, 0xed, 0xec, 0xdc, 0xfb, 0x10, 0x25, 0x53, 0x26, 0x33, 0xbd, 0x39, 0x48, 0x2f,
+  0xdb, 0xed, 0x1e, 0xdd, 0xfb, 0x50, 0x2c, 0x71, 0x6f, 0x77, 0xf8, 0x73, 0xb1, 0xe1, 0xcd, 0xf1, 0xf5, 0xf8, 0x7a, 0xfd,
+  0xad, 0x48, 0x94, 0xf0, 0x31, 0xb9, 0x86, 0xbb, 0x23, 0x2a, 0x40, 0x80, 0x36, 0x33, 0x59, 0xd2, 0x58, 0x5f, 0xed, 0x9a,
+  0x38, 0x92, 0x18, 0xcb, 0x1d, 0xa9, 0x47, 0x0a, 0xcc, 0x94, 0xf3, 0x2a, 0x3e, 0x1b, 0xa1, 0x29, 0x0c, 0x49, 0x2a, 0x46,
+  0xaa, 0xda, 0xc6, 0x2e, 0x7c, 0x79, 0x39, 0x5d, 0xda, 0x11, 0x2b, 0x93, 0xba, 0xa0, 0x59, 0x86, 0xb7, 0x79, 0x1c, 0xb2,
+  0x9f, 0xcf, 0x73, 0x5c, 0x63, 0x81, 0x49, 0x23, 0xc9, 0x8c, 0x97, 0xf6, 0xf8, 0xa2, 0x13, 0xb7, 0xe2, 0xb2, 0x9c, 0xc7,
+  0x55, 0xab, 0x4e, 0x3c, 0x17, 0xf5, 0x0d, 0x1a, 0x4d, 0xd9, 0xd1, 0x73, 0x2f, 0x6d, 0x57, 0xa5, 0xe4, 0x40, 0x3a, 0x31,
+  0xb2, 0x39, 0x68, 0x1b, 0x2f, 0x76, 0x4c, 0xad, 0xda, 0xc8, 0x6d, 0x42, 0x8f, 0x58, 0x65, 0x3b, 0x23, 0x11, 0x95, 0x04,
+  0x71, 0x35, 0x51, 0xad, 0x41, 0xf6, 0xab, 0x87, 0x63, 0x1a, 0x25, 0x19, 0x75, 0x88, 0x0e, 0x1e, 0x80, 0xc0, 0x3b, 0x33,
+  0x30, 0x6f, 0x2b, 0x32, 0xe2, 0x39, 0x09, 0x06, 0x96, 0x58, 0xcc, 0x87, 0x89, 0x05, 0x0d, 0xc4, 0xc5, 0x47, 0x62, 0x8f,
+  0x0e, 0xaf, 0x50, 0xc3, 0x3b, 0x48, 0x30, 0x01, 0xd3, 0xbf, 0xf0, 0xc3, 0xb8, 0x63, 0xda, 0x14, 0x77, 0xe8, 0x46, 0x84,
+  0xcd, 0x34, 0xad, 0xa0, 0x7d, 0x2f, 0x92, 0x2e, 0xdd, 0x73, 0x75, 0x5b, 0x0a, 0xfa, 0x57, 0x4c, 0x31, 0x91, 0x11, 0xce,
+  0xf6, 0xbe, 0x9d, 0xc7, 0x76, 0xab, 0x7e, 0x21, 0xca, 0x39, 0xdd, 0xf7, 0xd9, 0x2f, 0xdb, 0xc9, 0x5f, 0xa9, 0x3b, 0xd8,
+  0xe1, 0x3f, 0x35, 0x7a, 0xb0, 0x33, 0xcf, 0x17, 0xd1, 0x78, 0xeb, 0xff, 0x00, 0x38, 0xbf, 0x06, 0xdc, 0xf6, 0x96, 0x00,
+  0x00,
+};
+
+static const web_asset_t web_asset_index_html = {
+  "text/html", web_asset_index_html_gz, sizeof(web_asset_index_html_gz), "\"4f0203160cdffed1\""
+};
+
+//web/TinyLinePlot.js (12729 bytes uncompressed)
+static const uint8_t web_asset_tiny_line_plot_js_gz[] PROGMEM = {
+  0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xed, 0x5a, 0x6d, 0x6f, 0x1b, 0x37, 0x12, 0xfe, 0xee, 0x5f,
+  0xc1, 0xa0, 0xb8, 0x6a, 0x65, 0x4b, 0xb2, 0xe4, 0xc0, 0x41, 0x6d, 0x45, 0x2e, 0x5c, 0xc7, 0x29, 0xdc, 0x4b, 0x7a, 0xc1,
+  0xc5, 0xb8, 0x44, 0x08, 0xf2, 0x61, 0xad, 0xa5, 0x24, 0x36, 0xab, 0x5d, 0x61, 0x97, 0x8a, 0xa5, 0x4b, 0x7d, 0xbf, 0xfd,
+  0x66, 0xf8, 0x4e, 0xee, 0xae, 0x24, 0x27, 0x2d, 0xee, 0x0e, 0x38, 0x7f, 0x48, 0x24, 0x72, 0x38, 0x33, 0x9c, 0x79, 0xe6,
+  0x85, 0xa4, 0x8e, 0x0f, 0x0f, 0x0f, 0xc8, 0x21, 0xb9, 0x65, 0xd9, 0xe6, 0x15, 0xcb, 0xe8, 0x9b, 0x34, 0xe7, 0xbd, 0xdf,
+  0x4a, 0xd2, 0x25, 0x97, 0x64, 0xc1, 0x32, 0xb6, 0x88, 0x53, 0x92, 0xc2, 0x38, 0x59, 0xc2, 0x04, 0x67, 0xd9, 0x0c, 0xbe,
+  0xdd, 0x15, 0x71, 0xb1, 0x21, 0xd3, 0xbc, 0x20, 0x37, 0xf9, 0x2d, 0x49, 0xe8, 0x67, 0x36, 0xa1, 0xa5, 0x60, 0x92, 0x73,
+  0x20, 0x2f, 0xd9, 0x3f, 0xe9, 0x39, 0xf9, 0xd7, 0x49, 0xef, 0xf4, 0xaf, 0x3f, 0x09, 0x1e, 0x53, 0x46, 0x13, 0x98, 0x3e,
+  0x3e, 0x38, 0x98, 0xa4, 0x71, 0x59, 0x7a, 0xb2, 0xc8, 0x97, 0x03, 0x42, 0x26, 0x79, 0x56, 0xf2, 0x62, 0x35, 0xe1, 0x79,
+  0x11, 0xd1, 0x94, 0x2e, 0x68, 0xc6, 0x6f, 0x92, 0x0e, 0xc9, 0x97, 0x9c, 0xc1, 0x0c, 0x19, 0x91, 0x2f, 0x0f, 0x6d, 0x41,
+  0x48, 0xc8, 0xf1, 0x31, 0xf9, 0x99, 0x72, 0x32, 0x89, 0xb3, 0xcf, 0x71, 0x49, 0x14, 0xb1, 0x98, 0xe1, 0x73, 0x56, 0xf6,
+  0xd4, 0xf8, 0x88, 0x24, 0xf9, 0x64, 0x85, 0x53, 0xbd, 0x19, 0xe5, 0xd7, 0x92, 0xea, 0xa7, 0xcd, 0x4d, 0x62, 0xd9, 0xb7,
+  0x87, 0xce, 0x2a, 0xbe, 0x86, 0x25, 0x0e, 0x03, 0x5c, 0x75, 0x95, 0x67, 0x9c, 0xae, 0x79, 0xd4, 0x3a, 0x49, 0x5a, 0x40,
+  0xac, 0xa5, 0xbf, 0xa0, 0xd3, 0x78, 0x95, 0x72, 0xad, 0x9c, 0x65, 0xe2, 0x68, 0x2b, 0x06, 0x09, 0xb9, 0x67, 0x09, 0x9f,
+  0x9f, 0x6b, 0xca, 0x9e, 0xf8, 0x4a, 0x7e, 0xff, 0xdd, 0x13, 0x64, 0x06, 0x9f, 0xf6, 0xfb, 0x1d, 0xb5, 0x6e, 0x4e, 0xd9,
+  0x6c, 0xce, 0xed, 0x42, 0xf9, 0x3d, 0x5c, 0x69, 0x47, 0x4f, 0xec, 0xd2, 0x65, 0x9c, 0x24, 0xe0, 0x24, 0xbb, 0x56, 0x0d,
+  0x48, 0x09, 0x9a, 0x0a, 0x1d, 0x7a, 0x95, 0xa7, 0x79, 0x51, 0x5a, 0x42, 0x3b, 0x86, 0xb4, 0x1f, 0x5a, 0xdf, 0x3d, 0x7d,
+  0xfa, 0xec, 0xd9, 0xd5, 0x55, 0xab, 0x43, 0x5a, 0xdf, 0xbd, 0xb8, 0x7a, 0x7a, 0x36, 0x38, 0x11, 0x1f, 0x5f, 0xbe, 0x3c,
+  0x3b, 0xeb, 0xf7, 0xc5, 0xc7, 0x41, 0xff, 0xec, 0xd9, 0xe0, 0x07, 0xf1, 0x11, 0xc7, 0xce, 0xce, 0x5a, 0x1f, 0xb5, 0x80,
+  0xbb, 0x78, 0xf2, 0x69, 0x56, 0xe4, 0xab, 0x2c, 0x11, 0x2c, 0xad, 0x94, 0x60, 0x02, 0x45, 0xb5, 0xee, 0xe7, 0x8c, 0xd3,
+  0x96, 0x5e, 0x1a, 0xaf, 0x59, 0x19, 0x2c, 0x32, 0x43, 0x82, 0x1c, 0x14, 0xc3, 0x3f, 0xb3, 0x20, 0x8d, 0xef, 0x68, 0x1a,
+  0xac, 0xb0, 0x63, 0x72, 0xc9, 0x33, 0xf1, 0x67, 0x96, 0xac, 0x5f, 0xe1, 0xbc, 0x25, 0x97, 0xdf, 0x05, 0xa9, 0xa1, 0xd9,
+  0x04, 0x34, 0x9b, 0x1a, 0x1a, 0xce, 0x78, 0x4a, 0x2d, 0x89, 0xf8, 0xea, 0x53, 0x94, 0xf3, 0xfc, 0xfe, 0xe7, 0x82, 0x25,
+  0x96, 0x48, 0x8f, 0x90, 0x27, 0xa3, 0x11, 0x01, 0x3b, 0xd0, 0x29, 0x18, 0x3e, 0x21, 0x3f, 0x56, 0x09, 0xce, 0xc9, 0x34,
+  0x4e, 0x4b, 0xaa, 0x59, 0xcd, 0x60, 0x2c, 0xd8, 0xa6, 0x19, 0x92, 0xbb, 0xbc, 0x16, 0x7f, 0x2d, 0xd7, 0xcb, 0xef, 0x7c,
+  0x08, 0x9a, 0x21, 0x01, 0x1b, 0x4d, 0x98, 0xe4, 0xfc, 0xad, 0x88, 0x59, 0x4d, 0xa6, 0x06, 0x90, 0xc8, 0x60, 0x66, 0x11,
+  0xaf, 0xdf, 0xe4, 0x2c, 0xe3, 0x0e, 0x64, 0xcc, 0x10, 0x12, 0x0e, 0x2c, 0x08, 0x21, 0x96, 0x69, 0xbc, 0xf0, 0x60, 0x68,
+  0x86, 0x9a, 0xb7, 0x6d, 0x28, 0x82, 0x7d, 0x17, 0x94, 0xc7, 0x2c, 0x7b, 0x11, 0xf3, 0xd8, 0xb2, 0xb3, 0x63, 0x8d, 0xfc,
+  0x1c, 0x92, 0x80, 0xe1, 0x67, 0x46, 0xef, 0xdf, 0xb1, 0x2c, 0xc9, 0xef, 0xfd, 0x5d, 0xfb, 0xe3, 0xb8, 0xa7, 0x53, 0xb3,
+  0xa5, 0x78, 0xc5, 0xf3, 0xb7, 0x93, 0x22, 0x4f, 0xd3, 0x77, 0x8c, 0xcf, 0x7f, 0xa5, 0xf7, 0xbe, 0x3e, 0xb5, 0xd3, 0x8d,
+  0xaa, 0xd5, 0x53, 0x9f, 0x13, 0x48, 0x81, 0x54, 0xc8, 0x7b, 0xb0, 0xe9, 0xe6, 0xad, 0x4d, 0x76, 0x09, 0x83, 0xcc, 0x55,
+  0xfa, 0x49, 0xc7, 0xcb, 0x22, 0x23, 0x2f, 0x11, 0xc9, 0xc1, 0x61, 0x85, 0x56, 0xe5, 0x8d, 0x80, 0x58, 0x8e, 0x5a, 0xb9,
+  0x57, 0x71, 0x3a, 0x59, 0xa5, 0x31, 0x77, 0x12, 0x7f, 0x0c, 0x0e, 0xb2, 0xdc, 0x70, 0xf8, 0x12, 0x46, 0x9c, 0x7c, 0xb7,
+  0x3e, 0xf7, 0x79, 0xea, 0xdc, 0x73, 0x48, 0x06, 0xbd, 0x53, 0x13, 0x57, 0xf5, 0x44, 0x1d, 0x3f, 0x67, 0x56, 0x37, 0x02,
+  0x15, 0xa9, 0x81, 0xf9, 0x89, 0x65, 0xae, 0x33, 0x67, 0xcd, 0xd6, 0xb6, 0xac, 0x0f, 0x6d, 0x7e, 0x93, 0x31, 0xce, 0xe2,
+  0x14, 0x41, 0x90, 0x80, 0x67, 0xec, 0x9e, 0xf1, 0x5b, 0x49, 0x39, 0xe6, 0xf8, 0x0f, 0x1f, 0x6b, 0xe9, 0x11, 0x43, 0xb0,
+  0x07, 0x04, 0x11, 0x89, 0xb0, 0x42, 0x96, 0xc2, 0xcf, 0x28, 0x88, 0xcf, 0x21, 0xef, 0xcd, 0xe6, 0x82, 0x65, 0xdb, 0xf2,
+  0xb4, 0xa8, 0x73, 0x2c, 0x59, 0xf2, 0xb8, 0x80, 0x6d, 0xd8, 0x88, 0x12, 0x40, 0xf5, 0xf4, 0xf7, 0xd1, 0x1a, 0x6e, 0xe1,
+  0xb6, 0x80, 0x44, 0x4b, 0xd8, 0x94, 0xdc, 0x53, 0xcc, 0x41, 0xab, 0x34, 0x11, 0x10, 0xee, 0x4a, 0x75, 0x40, 0x43, 0x30,
+  0x68, 0x06, 0xaa, 0xfa, 0xfb, 0xb3, 0xc0, 0x0c, 0xe1, 0x51, 0x0b, 0x59, 0xc4, 0xd6, 0x03, 0x8a, 0x04, 0x53, 0xbe, 0x90,
+  0xa6, 0x89, 0x90, 0x61, 0x47, 0xe6, 0x64, 0xe0, 0xd1, 0x6a, 0xe9, 0xba, 0x2d, 0x4a, 0x3c, 0xfc, 0x0b, 0xc9, 0xea, 0x06,
+  0x42, 0xc2, 0xd4, 0x5b, 0x6d, 0xd2, 0x5e, 0x4a, 0xb3, 0x19, 0x28, 0xf5, 0x17, 0x5f, 0xae, 0xad, 0x4a, 0x8a, 0x60, 0x58,
+  0xf5, 0x46, 0x6f, 0xb9, 0x2a, 0xe7, 0x91, 0x36, 0x5d, 0x22, 0x02, 0x53, 0xa8, 0xe1, 0x16, 0x88, 0x73, 0xf9, 0x9f, 0x1e,
+  0x9b, 0xc8, 0x44, 0xda, 0x20, 0xeb, 0x83, 0xd5, 0xf3, 0xa3, 0xb4, 0xac, 0xea, 0x16, 0x20, 0xa9, 0xac, 0x8a, 0x4c, 0x2c,
+  0x73, 0x37, 0x2f, 0xb2, 0x60, 0xa4, 0xf4, 0x11, 0xcb, 0x3a, 0x64, 0x89, 0x63, 0x7a, 0xf7, 0xe0, 0x08, 0x6f, 0x9a, 0x3c,
+  0x27, 0x7d, 0x4c, 0x30, 0xde, 0xd8, 0x45, 0xbd, 0x49, 0xda, 0x06, 0x15, 0x68, 0xc3, 0x3c, 0xa5, 0x3d, 0x5a, 0x14, 0xd0,
+  0x28, 0xb5, 0x94, 0xc9, 0x09, 0x13, 0xab, 0xf3, 0x15, 0xf4, 0x24, 0x53, 0x72, 0x87, 0xb5, 0xb5, 0x6c, 0x29, 0x7d, 0x2b,
+  0x1a, 0x2b, 0x9d, 0xb5, 0x3f, 0x94, 0xa8, 0xd0, 0x19, 0x1f, 0x5c, 0xbd, 0x3e, 0xca, 0x75, 0x6a, 0x48, 0xd0, 0x48, 0x8b,
+  0xcb, 0x1d, 0x3a, 0x61, 0x30, 0xb5, 0x99, 0x9f, 0x30, 0x68, 0xce, 0xb2, 0xf8, 0x2e, 0x85, 0xc4, 0x17, 0x67, 0x09, 0xc0,
+  0xb0, 0x55, 0x50, 0x92, 0x41, 0xbf, 0x27, 0xf3, 0x32, 0x92, 0x48, 0xa8, 0x14, 0x74, 0x91, 0x7f, 0xa6, 0x24, 0x4f, 0x13,
+  0x0a, 0x0a, 0x09, 0x9e, 0xa5, 0xb1, 0x99, 0xe7, 0x1f, 0xcb, 0xfc, 0xfb, 0xef, 0xc9, 0x13, 0x6f, 0xca, 0x49, 0xf6, 0x30,
+  0xe7, 0xa9, 0xaa, 0x70, 0x75, 0xe1, 0xfb, 0xda, 0x94, 0x2e, 0x6b, 0x5d, 0x77, 0x15, 0x36, 0x90, 0x2e, 0x93, 0x32, 0x85,
+  0x16, 0x37, 0xea, 0x36, 0xb0, 0xf0, 0x0c, 0x2b, 0x0d, 0xe1, 0xef, 0x52, 0x98, 0xc0, 0xa8, 0xdf, 0x01, 0xc8, 0xfc, 0xb6,
+  0x82, 0xcd, 0xba, 0xc9, 0x82, 0xe7, 0xa2, 0x57, 0x20, 0x8b, 0xbc, 0x44, 0x1b, 0x4d, 0xa0, 0x47, 0xb5, 0xc1, 0x09, 0x3c,
+  0xef, 0xd0, 0xbd, 0x59, 0xba, 0x41, 0xb3, 0x38, 0x61, 0x6a, 0xcd, 0xbc, 0x87, 0xcd, 0xb6, 0x98, 0x2c, 0x08, 0x7f, 0x1f,
+  0x73, 0x1c, 0x8b, 0xff, 0x4d, 0xb2, 0x0e, 0xad, 0xa2, 0x4c, 0xdb, 0x25, 0x03, 0x8d, 0x36, 0x94, 0xaf, 0x68, 0x2f, 0x46,
+  0xdb, 0xf2, 0x95, 0x15, 0x50, 0x49, 0x83, 0x3d, 0x91, 0xfc, 0x40, 0x96, 0x62, 0xd4, 0xdd, 0xc6, 0x87, 0x1c, 0x59, 0xe1,
+  0x0f, 0xae, 0x1b, 0xea, 0x22, 0x75, 0x92, 0xd2, 0xb8, 0x88, 0xb4, 0xe8, 0xba, 0x8c, 0xee, 0x9e, 0x08, 0x7a, 0x82, 0xfc,
+  0xef, 0x74, 0xc2, 0xa3, 0x7e, 0x07, 0x52, 0x71, 0x4d, 0x4d, 0xea, 0xd4, 0x15, 0x1a, 0xf7, 0x60, 0x51, 0xb3, 0xab, 0xfe,
+  0xf0, 0x9b, 0xf2, 0x6d, 0xfd, 0xce, 0xb0, 0x60, 0xa3, 0xb6, 0x24, 0x26, 0xe5, 0x92, 0x4e, 0xe0, 0xc4, 0x35, 0xd1, 0xae,
+  0xd2, 0xfb, 0x76, 0x13, 0xb4, 0x0e, 0xed, 0xc6, 0xf4, 0x04, 0xce, 0xeb, 0x3b, 0x91, 0xa4, 0x73, 0xd6, 0xf6, 0xf4, 0xb4,
+  0x25, 0x85, 0xe8, 0xa0, 0xd2, 0x36, 0x7e, 0xf8, 0x8f, 0x98, 0xe8, 0x5a, 0x44, 0x8a, 0x5b, 0x08, 0x31, 0x30, 0xc2, 0x5a,
+  0x28, 0xe3, 0xe9, 0xd2, 0x70, 0xf7, 0x01, 0xe3, 0xeb, 0x03, 0x0d, 0xdb, 0x56, 0x89, 0x2f, 0x58, 0xb9, 0x8f, 0xc8, 0x44,
+  0x92, 0xed, 0x25, 0x53, 0xb4, 0xb2, 0x5b, 0x85, 0xde, 0xe6, 0xb3, 0xd9, 0x6e, 0x99, 0x5c, 0x50, 0xed, 0x25, 0xf2, 0x49,
+  0x30, 0xb4, 0x55, 0xba, 0x5a, 0xe5, 0xe4, 0x36, 0x18, 0x97, 0x6a, 0x44, 0x25, 0xa7, 0xcb, 0xd2, 0x39, 0xc9, 0xbf, 0x84,
+  0x79, 0x0c, 0x73, 0xb6, 0x58, 0x2d, 0x4c, 0x2d, 0x92, 0xb0, 0x12, 0x24, 0x29, 0x15, 0xa9, 0x07, 0x1d, 0xfb, 0x4a, 0xe6,
+  0x1a, 0x1f, 0x1c, 0x06, 0x8a, 0xd0, 0x69, 0x5d, 0xc7, 0x93, 0x79, 0x64, 0xea, 0xd9, 0x85, 0x41, 0x65, 0xb8, 0xfe, 0x75,
+  0xcc, 0xe7, 0x98, 0xbb, 0x23, 0x6f, 0xa2, 0x53, 0x97, 0xd9, 0x74, 0x62, 0x6f, 0xd7, 0xb5, 0xc5, 0x68, 0x4a, 0x09, 0xd8,
+  0x65, 0x5e, 0x32, 0x84, 0xa4, 0x53, 0x57, 0x61, 0xf2, 0xad, 0x02, 0x73, 0x3d, 0xc8, 0x8f, 0x88, 0xb0, 0x85, 0x65, 0x7c,
+  0x9d, 0x95, 0x2b, 0xa8, 0x90, 0xd0, 0xae, 0x25, 0x79, 0xd6, 0xe2, 0xca, 0x62, 0x70, 0x9e, 0x07, 0x6e, 0x7c, 0xee, 0x34,
+  0xa2, 0x18, 0xab, 0x86, 0xbd, 0x8e, 0x53, 0x33, 0xf0, 0xdc, 0xd9, 0x20, 0xa4, 0x2c, 0x7f, 0xf3, 0xdd, 0xaa, 0x32, 0x98,
+  0x8a, 0x83, 0x08, 0xae, 0x09, 0x48, 0xcd, 0x5e, 0x67, 0xda, 0x7a, 0x64, 0x93, 0xfb, 0x39, 0xcd, 0x40, 0x64, 0xb6, 0x8a,
+  0x53, 0x28, 0x54, 0x16, 0x7a, 0x78, 0xe8, 0xbf, 0x8f, 0x8b, 0xc4, 0x29, 0x12, 0x62, 0xf7, 0xd8, 0x05, 0x55, 0x0a, 0x41,
+  0x13, 0xd8, 0xf7, 0xc8, 0xef, 0xa0, 0xd6, 0x2f, 0xab, 0xc5, 0x52, 0xd4, 0x52, 0x9d, 0x05, 0x1d, 0xe7, 0x48, 0x85, 0x6e,
+  0xf3, 0x48, 0x8f, 0xfd, 0x6f, 0x23, 0x71, 0x4e, 0x65, 0x87, 0xaf, 0x77, 0x83, 0xbd, 0x40, 0x2c, 0xc1, 0x82, 0x00, 0x2d,
+  0x9d, 0xfe, 0x41, 0x82, 0x92, 0x95, 0x97, 0xfc, 0x1a, 0xb6, 0x39, 0xb2, 0x4b, 0x2e, 0x46, 0x7b, 0x41, 0xc4, 0x4a, 0xfd,
+  0x07, 0x1c, 0x73, 0x12, 0x71, 0x2a, 0x74, 0x41, 0x8f, 0x1e, 0x75, 0x79, 0x0a, 0x4c, 0x9a, 0x81, 0x3f, 0x07, 0x93, 0x9a,
+  0xbd, 0xd2, 0x4d, 0x37, 0x5e, 0xd8, 0x62, 0x3a, 0x67, 0xae, 0x5c, 0xd8, 0x83, 0x66, 0x49, 0x47, 0x27, 0x59, 0x17, 0xb1,
+  0x0e, 0x20, 0x9f, 0x28, 0xeb, 0xfc, 0xc1, 0x78, 0x54, 0x2b, 0x95, 0x1e, 0x77, 0x74, 0xc6, 0x32, 0xd1, 0x15, 0x42, 0xa7,
+  0xee, 0x44, 0xb5, 0x46, 0xa6, 0x08, 0x32, 0x3f, 0x11, 0x3f, 0xa6, 0x3c, 0xee, 0x2e, 0x0d, 0xbe, 0x3a, 0x60, 0x16, 0x57,
+  0x11, 0x68, 0xdd, 0x6c, 0xf3, 0xd9, 0x76, 0xd4, 0x02, 0xb3, 0x18, 0xa5, 0xfe, 0xcb, 0x02, 0xa1, 0xc9, 0x46, 0x8f, 0x06,
+  0xdc, 0xf0, 0xab, 0x4a, 0xfc, 0x14, 0x38, 0xbc, 0x66, 0xd9, 0x6b, 0x10, 0xe4, 0xf6, 0x52, 0xb5, 0x27, 0xdb, 0xd1, 0x68,
+  0x84, 0xe9, 0x4e, 0xb1, 0xf9, 0x82, 0x37, 0xe3, 0xef, 0xf1, 0x88, 0x8f, 0xfa, 0xc1, 0x87, 0x01, 0x7e, 0x62, 0xd9, 0x58,
+  0x0f, 0x8d, 0x71, 0xc8, 0x1c, 0xe9, 0x85, 0xd9, 0x61, 0x01, 0x68, 0x74, 0x93, 0x81, 0x54, 0xc6, 0x37, 0x72, 0x21, 0x0c,
+  0x74, 0x9d, 0x11, 0x60, 0x10, 0x92, 0x8c, 0x5d, 0x12, 0xd7, 0x6c, 0xfb, 0xb8, 0x0a, 0x30, 0xf3, 0x37, 0x3c, 0x75, 0x60,
+  0x06, 0x61, 0x09, 0x2d, 0xd4, 0x01, 0x4d, 0x74, 0x13, 0x2c, 0x13, 0xd0, 0x99, 0xac, 0x8a, 0x02, 0x4f, 0x2b, 0x7e, 0xc5,
+  0xb7, 0x69, 0xa7, 0x74, 0x0b, 0x61, 0xcd, 0xe9, 0xe3, 0xc7, 0x06, 0x27, 0x9e, 0x6b, 0x5c, 0x69, 0x46, 0x54, 0xe4, 0xae,
+  0x46, 0x36, 0x26, 0x6c, 0xa5, 0xef, 0x59, 0x16, 0xe9, 0x52, 0x5b, 0xe7, 0xf0, 0x7a, 0x74, 0x91, 0x73, 0xc3, 0xa5, 0x66,
+  0xda, 0xa4, 0x1a, 0xbc, 0xd8, 0x89, 0xd0, 0x25, 0x0c, 0x14, 0x12, 0x52, 0x86, 0xf0, 0xf1, 0x39, 0x6a, 0x08, 0x1f, 0x8e,
+  0x8e, 0xdc, 0x24, 0x22, 0x75, 0x17, 0x66, 0x0b, 0xce, 0x4f, 0x1f, 0xd8, 0xc7, 0xa1, 0x21, 0x93, 0x29, 0xd4, 0xb9, 0x32,
+  0x50, 0xa1, 0x22, 0x7d, 0x6e, 0xb6, 0x84, 0xdf, 0xd5, 0xdd, 0x42, 0x6f, 0xdd, 0x1e, 0xba, 0x94, 0x12, 0x0c, 0x6e, 0x2c,
+  0x35, 0x51, 0x4a, 0x90, 0xb8, 0x3c, 0xc7, 0x9a, 0x72, 0x13, 0xf2, 0x1c, 0x07, 0x3c, 0x6b, 0x29, 0x1f, 0xfc, 0x8c, 0xe8,
+  0xdf, 0x09, 0x64, 0xb9, 0x06, 0x0d, 0x00, 0x06, 0xbd, 0xd0, 0xd1, 0x31, 0x90, 0xc8, 0xa7, 0x14, 0x13, 0x36, 0x72, 0xb3,
+  0x23, 0x8b, 0x5f, 0x6b, 0x8b, 0x47, 0x47, 0x8d, 0x7f, 0x22, 0xbf, 0x4c, 0x12, 0x3c, 0x1a, 0x2d, 0x62, 0xd1, 0x52, 0xc9,
+  0x8b, 0x3f, 0x95, 0x04, 0x61, 0xd1, 0xf1, 0x02, 0x35, 0x8b, 0xd3, 0x15, 0x2d, 0x9d, 0x72, 0x59, 0xc4, 0xd9, 0x8c, 0xbe,
+  0x97, 0xe7, 0xd0, 0xf7, 0x90, 0x36, 0x50, 0xf2, 0x30, 0x9c, 0x1f, 0xcb, 0xf9, 0xb1, 0x9c, 0x1f, 0x0f, 0xbd, 0x62, 0x60,
+  0xf2, 0x9d, 0xd0, 0x59, 0xec, 0xae, 0xab, 0xd9, 0x1e, 0x92, 0x7e, 0xaf, 0x7f, 0xea, 0x5c, 0xae, 0x23, 0x05, 0x0a, 0x3a,
+  0x6a, 0xa0, 0x10, 0x9b, 0x14, 0xae, 0xeb, 0x6a, 0xd1, 0x15, 0x1e, 0xe3, 0x73, 0xa9, 0xcc, 0x91, 0x4f, 0xa1, 0x2f, 0x07,
+  0x95, 0x45, 0xca, 0x49, 0x9c, 0x52, 0x79, 0x65, 0x25, 0x1c, 0x23, 0x2c, 0x08, 0x29, 0x4c, 0x5b, 0x3b, 0xd0, 0x5e, 0xdf,
+  0xea, 0xea, 0x0b, 0xdf, 0xde, 0x1a, 0xf8, 0x47, 0x0a, 0x58, 0x72, 0xdf, 0xb0, 0x18, 0x91, 0xf4, 0xbe, 0x4d, 0x8e, 0x85,
+  0x17, 0xc5, 0x77, 0x63, 0x35, 0x3b, 0x7b, 0x18, 0x70, 0x92, 0x87, 0xe8, 0xe0, 0x62, 0xd8, 0xcc, 0x6e, 0x74, 0xe8, 0x9a,
+  0x11, 0x73, 0x93, 0xab, 0xc4, 0x6f, 0x3c, 0x01, 0xe3, 0x40, 0xfc, 0x38, 0x9c, 0x3d, 0xac, 0x65, 0x17, 0x58, 0x27, 0x29,
+  0xe2, 0xfb, 0xcb, 0x35, 0x2d, 0x23, 0xdf, 0x28, 0xea, 0xfe, 0xd2, 0x79, 0x28, 0xe4, 0x6b, 0xe7, 0x51, 0x10, 0x16, 0x91,
+  0x78, 0xad, 0xf1, 0xc3, 0xd7, 0x3d, 0x51, 0xea, 0xdf, 0x40, 0xe0, 0x44, 0x2a, 0x4e, 0x70, 0xb0, 0xe4, 0x45, 0xfe, 0x89,
+  0xbe, 0xe5, 0x1b, 0x68, 0x43, 0xc2, 0xd3, 0xac, 0x7e, 0xe3, 0xb2, 0xd4, 0xf6, 0xb1, 0x66, 0x84, 0x97, 0x1c, 0x5a, 0xd6,
+  0xfb, 0x2e, 0xd2, 0x1a, 0x2a, 0xbc, 0x3d, 0x83, 0x9e, 0x36, 0x70, 0x51, 0x67, 0x4f, 0x5b, 0xb6, 0x7d, 0x71, 0x55, 0x46,
+  0x95, 0x75, 0xee, 0xc5, 0xc7, 0x3e, 0xec, 0xb5, 0xda, 0xe3, 0xaf, 0x52, 0x7b, 0xa7, 0x7e, 0x8f, 0xd5, 0xc4, 0xba, 0x21,
+  0x6a, 0x07, 0xfe, 0xc3, 0xd7, 0x34, 0xcc, 0x43, 0xdb, 0x2f, 0xd4, 0xd4, 0xeb, 0x9c, 0x73, 0x43, 0x56, 0xe7, 0xed, 0x9d,
+  0xfe, 0x36, 0x4f, 0x77, 0x2e, 0x7d, 0x9d, 0xc7, 0x85, 0x7e, 0xbf, 0xae, 0x16, 0x77, 0x50, 0x7c, 0xa1, 0x59, 0x13, 0x4a,
+  0x22, 0x5d, 0xe9, 0xd5, 0x46, 0x1c, 0xc6, 0x27, 0xf5, 0x12, 0x13, 0xd6, 0xe9, 0xb0, 0x7e, 0x6e, 0x2c, 0xe7, 0x2c, 0x5b,
+  0x09, 0xa5, 0x2a, 0x4f, 0xaf, 0xbe, 0x0d, 0x64, 0x6d, 0xb3, 0x12, 0x1a, 0x4a, 0x9c, 0x89, 0x0c, 0x3f, 0x51, 0x30, 0x08,
+  0x4a, 0xbb, 0xb6, 0x21, 0x07, 0xd8, 0x52, 0xe2, 0x60, 0xa3, 0x11, 0x0d, 0x01, 0x22, 0x1e, 0x0b, 0x76, 0x53, 0x18, 0x1c,
+  0x5c, 0x3e, 0xd2, 0x06, 0xe3, 0x06, 0x1b, 0x6c, 0x2a, 0x36, 0xd8, 0x54, 0x6c, 0xd0, 0x98, 0x88, 0x6a, 0x8d, 0x50, 0x81,
+  0x7b, 0x83, 0x11, 0xf6, 0x0c, 0xdb, 0x4d, 0xd5, 0x06, 0x7e, 0x44, 0xf8, 0x75, 0x53, 0xc4, 0x85, 0x78, 0x38, 0x29, 0xc5,
+  0x1d, 0x36, 0x67, 0x93, 0x4f, 0x36, 0x86, 0xa7, 0x2c, 0x4d, 0x6b, 0xc1, 0x6d, 0x9f, 0xdf, 0x6d, 0xf8, 0x4e, 0x73, 0xd1,
+  0x00, 0xb5, 0x06, 0xfd, 0xe5, 0x9a, 0x5c, 0x16, 0x2c, 0x4e, 0x5b, 0x76, 0x12, 0x7f, 0x68, 0x71, 0x99, 0xb2, 0x59, 0x86,
+  0x14, 0x78, 0xfc, 0xa0, 0x45, 0x2b, 0xcc, 0x78, 0x52, 0xb8, 0x50, 0x43, 0x6a, 0xe4, 0xe4, 0x65, 0x31, 0xe5, 0x40, 0xdf,
+  0x73, 0x5e, 0x5f, 0x38, 0x6f, 0xa4, 0x88, 0x02, 0xcf, 0xed, 0xc4, 0xae, 0x5c, 0xb5, 0x03, 0xb7, 0x92, 0x8b, 0x68, 0x21,
+  0xb0, 0x21, 0xb0, 0x35, 0xaf, 0xca, 0x65, 0x4b, 0x7d, 0x74, 0x43, 0x53, 0x58, 0x1e, 0x57, 0xed, 0xce, 0x32, 0x8d, 0xe1,
+  0xb2, 0x2b, 0x0c, 0xbe, 0x26, 0x86, 0x60, 0xf8, 0xb4, 0x26, 0xc7, 0x45, 0x55, 0xe5, 0x85, 0x93, 0x1c, 0x42, 0x44, 0xcb,
+  0x2d, 0xfe, 0xa0, 0x46, 0x98, 0xa9, 0xc7, 0xf3, 0x97, 0x6c, 0x4d, 0x93, 0x68, 0xd0, 0xee, 0x90, 0xc7, 0x48, 0x1f, 0x9c,
+  0x56, 0x50, 0x3a, 0xde, 0x0f, 0x1f, 0x63, 0x8b, 0x8f, 0x0a, 0xe6, 0x0a, 0xe4, 0xde, 0xda, 0x05, 0x9e, 0x71, 0x2d, 0x78,
+  0x1a, 0x82, 0x7e, 0x00, 0xde, 0x35, 0xae, 0xdf, 0x19, 0xf4, 0x4d, 0x08, 0x1a, 0x7b, 0x08, 0x1a, 0x07, 0x08, 0x0a, 0x5b,
+  0x9c, 0x6f, 0x43, 0xd0, 0x96, 0x5c, 0xb3, 0x25, 0xd3, 0x74, 0xc9, 0x69, 0x48, 0xf9, 0x47, 0x60, 0xa2, 0x2a, 0xe6, 0x07,
+  0x10, 0x03, 0xd6, 0x78, 0x5a, 0x9f, 0xa5, 0x04, 0x04, 0x1c, 0xc7, 0x57, 0x2a, 0xb7, 0xfc, 0x91, 0x8f, 0x5f, 0xb7, 0xeb,
+  0xf3, 0x4e, 0x8d, 0x7e, 0x35, 0x9c, 0x3a, 0x64, 0xaf, 0x9c, 0x0b, 0xae, 0x3b, 0xe9, 0x34, 0xfc, 0x20, 0x21, 0x80, 0x72,
+  0x45, 0xe5, 0x4d, 0x8d, 0xca, 0x65, 0xfc, 0x99, 0xfa, 0xde, 0xe3, 0xd0, 0xec, 0x97, 0x78, 0xe5, 0x17, 0x0d, 0xfa, 0x7b,
+  0x07, 0x12, 0x68, 0xe5, 0x31, 0x29, 0x72, 0x8e, 0x1c, 0xba, 0xe2, 0xac, 0xf7, 0xe6, 0xa6, 0x32, 0xff, 0x75, 0x96, 0xda,
+  0x28, 0x4b, 0xe1, 0x03, 0x9a, 0x2f, 0x8e, 0x96, 0x3c, 0x2f, 0x9a, 0x2a, 0x8e, 0xf8, 0x21, 0x55, 0xbd, 0x49, 0xc4, 0xd4,
+  0x23, 0x9d, 0xa8, 0x2a, 0xcf, 0x5d, 0x9e, 0x26, 0x64, 0x70, 0x12, 0x94, 0x9f, 0x6d, 0xea, 0x0b, 0x61, 0x8f, 0xf2, 0xb3,
+  0x93, 0x9d, 0x9c, 0xf3, 0x44, 0xe4, 0xdc, 0x34, 0xcb, 0x77, 0x3a, 0xf9, 0x5b, 0x1c, 0xff, 0xbd, 0xb1, 0xb1, 0x9c, 0x06,
+  0x3f, 0x9a, 0x1b, 0x56, 0x97, 0x7d, 0xd5, 0x2b, 0xa5, 0x7f, 0x46, 0x97, 0xaf, 0xf1, 0xe2, 0x5d, 0x1a, 0x55, 0x26, 0x74,
+  0xb1, 0xe4, 0x1b, 0x7b, 0xa6, 0xd9, 0x75, 0xad, 0xe5, 0x3f, 0x02, 0xea, 0x33, 0xd4, 0xbe, 0xe7, 0xf5, 0x9d, 0x3f, 0x57,
+  0x30, 0x57, 0xf4, 0x70, 0x52, 0x8f, 0xe5, 0x55, 0x7d, 0xf5, 0xc4, 0x2e, 0x33, 0xa1, 0xb6, 0x9e, 0x7b, 0x37, 0x57, 0x73,
+  0x52, 0x13, 0x6c, 0xb0, 0x29, 0x3b, 0xa8, 0xaa, 0xad, 0x8e, 0x7e, 0xc1, 0x2a, 0x1a, 0x4f, 0xe6, 0xce, 0xab, 0x6a, 0xd3,
+  0x2d, 0x9a, 0xbe, 0x46, 0xeb, 0x10, 0xff, 0xa9, 0xf5, 0xff, 0xb7, 0x6a, 0x3b, 0x6e, 0xd5, 0x10, 0x62, 0xa8, 0x4d, 0x57,
+  0x6d, 0xee, 0x39, 0x19, 0xe8, 0xeb, 0xd2, 0xa1, 0xb8, 0xbc, 0xfe, 0xc4, 0x96, 0x48, 0xa4, 0xc0, 0x1a, 0xdc, 0x2a, 0x1d,
+  0xb8, 0x00, 0xac, 0x1e, 0xbe, 0xb4, 0xe0, 0x89, 0x7b, 0xe6, 0x32, 0xb4, 0xee, 0xc1, 0xab, 0xf2, 0x9b, 0xa0, 0x77, 0x6e,
+  0xa7, 0x67, 0x96, 0x78, 0xa5, 0x34, 0x28, 0x73, 0x42, 0x3d, 0x5c, 0xaa, 0x7f, 0x81, 0x04, 0xcd, 0xc4, 0x94, 0x15, 0x25,
+  0x7f, 0xa3, 0xae, 0x01, 0xed, 0xad, 0xf2, 0x9f, 0x76, 0x99, 0xf8, 0x44, 0xdd, 0x26, 0xc2, 0x12, 0xce, 0xb2, 0x15, 0x35,
+  0x4a, 0x1a, 0x04, 0xe1, 0x35, 0x50, 0x62, 0x34, 0xc2, 0x7d, 0x35, 0xde, 0x0c, 0x39, 0x8b, 0x91, 0xb7, 0xdd, 0x8b, 0x7f,
+  0x5b, 0x69, 0x8c, 0xa3, 0x1a, 0x0a, 0x47, 0x04, 0xb6, 0x13, 0xee, 0x57, 0xff, 0xa2, 0xd1, 0x33, 0x8e, 0xf7, 0xc8, 0x02,
+  0x19, 0x80, 0x40, 0x49, 0xa7, 0xf5, 0x72, 0x54, 0x4b, 0xb2, 0xa7, 0x9c, 0x87, 0xf0, 0xe8, 0x13, 0x60, 0xa5, 0xc6, 0x93,
+  0x1a, 0x63, 0x53, 0xfd, 0x23, 0x59, 0x7c, 0x65, 0xd3, 0xf1, 0x5f, 0x53, 0x9e, 0x34, 0xd5, 0x45, 0xcd, 0xcb, 0x66, 0x98,
+  0xe3, 0x03, 0x48, 0x1a, 0xe2, 0xc7, 0x00, 0x62, 0x6f, 0x48, 0xec, 0x04, 0xc5, 0x37, 0xc2, 0xa2, 0x29, 0x32, 0x6a, 0xe6,
+  0xe3, 0x62, 0xb2, 0xd5, 0x63, 0x41, 0xbd, 0x52, 0x26, 0x15, 0xc5, 0x4d, 0x77, 0x27, 0x87, 0x4e, 0x77, 0x52, 0xb1, 0x6f,
+  0xb4, 0xfb, 0x66, 0xba, 0xee, 0x2d, 0x67, 0x46, 0xb9, 0x7d, 0x26, 0x0a, 0xdf, 0xbb, 0xbe, 0xe5, 0xad, 0xab, 0xf6, 0x9d,
+  0x6b, 0xbf, 0x37, 0x2e, 0x47, 0x57, 0xb3, 0x46, 0x2a, 0xfc, 0x70, 0xf0, 0x6f, 0x66, 0x49, 0x9a, 0x80, 0xb9, 0x31, 0x00,
+  0x00,
+};
+
+static const web_asset_t web_asset_tiny_line_plot_js = {
+  "application/javascript", web_asset_tiny_line_plot_js_gz, sizeof(web_asset_tiny_line_plot_js_gz), "\"5608bfeea819821f\""
+};
+
+#endif // WEB_ASSETS_H
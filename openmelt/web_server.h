@@ -4,11 +4,19 @@
 #include <Arduino.h>
 
 void init_web_server();
-void update_web_data(const String &telemetry, const String &logs);
+void update_web_logs(const String &logs);
+uint32_t web_get_log_version();
+size_t web_copy_logs(char *buffer, size_t buffer_size);
 void web_server_task(void *pvParameters);
-String parseTelemetryToJSON(const String &telemetryData);
 void handleEEPROM();
 void handleNotFound();
 void handleToggleConfigMode();
+void handleGetCurves();
+void handleSetCurves();
+void handleLatency();
+void handleLatencyReset();
+void handleFlightLog();
+void handleLogModulesGet();
+void handleLogModulesSet();
 
 #endif